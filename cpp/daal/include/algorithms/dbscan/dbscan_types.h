@@ -558,6 +558,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     size_t rightBlocks; /*!< Number of blocks that will process observations with value of selected
                                        split feature greater than selected split value */
 
+    size_t memoryLimit; /*!< Upper bound in bytes of the memory used to store the neighborhoods of observations.
+                             If non-zero then neighborhoods are computed in parallel blocks that fit the bound.
+                             Zero means that the bound is not set */
+
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [Parameter source code] */
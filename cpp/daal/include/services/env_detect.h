@@ -153,6 +153,14 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     *  Enables NUMA-aware first-touch initialization of the large memory blocks allocated by the library.
+     *  In this mode the memory is zero-filled by the same threads that later process it,
+     *  so on multi-socket systems the memory pages are placed on the NUMA nodes of those threads
+     *  \param[in] enableFirstTouchFlag   Flag to first-touch initialization enable
+     */
+    void enableNumaFirstTouch(bool enableFirstTouchFlag = true);
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
@@ -384,6 +384,132 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
     return s;
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemLimit(const NumericTable * ntData, const NumericTable * ntWeights,
+                                                                        NumericTable * ntAssignments, NumericTable * ntNClusters,
+                                                                        NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                                        const Parameter * par)
+{
+    Status s;
+
+    const algorithmFPType epsilon         = par->epsilon;
+    const algorithmFPType minObservations = par->minObservations;
+    const algorithmFPType minkowskiPower  = (algorithmFPType)2.0;
+    const size_t memoryLimit              = par->memoryLimit;
+
+    const size_t nRows = ntData->getNumberOfRows();
+
+    NeighborhoodEngine<method, algorithmFPType, cpu> nEngine(ntData, ntData, ntWeights, epsilon, minkowskiPower);
+
+    WriteRows<int, cpu> assignRows(ntAssignments, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(assignRows);
+    int * const assignments = assignRows.get();
+
+    service_memset<int, cpu>(assignments, undefined, nRows);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(size_t));
+
+    TArray<int, cpu> isCoreArray(nRows);
+    DAAL_CHECK_MALLOC(isCoreArray.get());
+    int * const isCore = isCoreArray.get();
+
+    TArray<algorithmFPType, cpu> neighWeightsArray(nRows);
+    DAAL_CHECK_MALLOC(neighWeightsArray.get());
+    algorithmFPType * const neighWeights = neighWeightsArray.get();
+
+    TArray<size_t, cpu> neighSizesArray(nRows);
+    DAAL_CHECK_MALLOC(neighSizesArray.get());
+    size_t * const neighSizes = neighSizesArray.get();
+
+    /* The first pass finds the core observations without storing the neighborhoods */
+    DAAL_CHECK_STATUS_VAR(nEngine.queryWeights(neighWeights, neighSizes));
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        isCore[i] = (neighWeights[i] >= minObservations);
+    }
+    neighWeightsArray.reset(0);
+
+    /* Each prefetched neighborhood takes the object itself, the slot for its index
+     * and at least one entry, the rest of the limit is left for the entries */
+    const size_t minNeighBytes = sizeof(Neighborhood<algorithmFPType, cpu>) + 2 * sizeof(size_t);
+    const size_t maxPrefetched = services::internal::max<cpu, size_t>(1, services::internal::min<cpu, size_t>(nRows, memoryLimit / minNeighBytes));
+    const size_t fixedBytes    = maxPrefetched * (sizeof(Neighborhood<algorithmFPType, cpu>) + sizeof(size_t));
+    const size_t entriesLimit  = memoryLimit > fixedBytes ? memoryLimit - fixedBytes : 0;
+
+    TArray<Neighborhood<algorithmFPType, cpu>, cpu> prefetchedNeighs(maxPrefetched);
+    DAAL_CHECK_MALLOC(prefetchedNeighs.get());
+
+    TArray<size_t, cpu> prefetchedIndicesArray(maxPrefetched);
+    DAAL_CHECK_MALLOC(prefetchedIndicesArray.get());
+    size_t * const prefetchedIndices = prefetchedIndicesArray.get();
+
+    size_t nClusters = 0;
+    Queue<size_t, cpu> qu;
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (assignments[i] != undefined) continue;
+
+        if (!isCore[i])
+        {
+            assignments[i] = noise;
+            continue;
+        }
+
+        nClusters++;
+        assignments[i] = nClusters - 1;
+
+        qu.reset();
+        DAAL_CHECK_STATUS_VAR(qu.push(i));
+
+        while (!qu.empty())
+        {
+            /* Collect the queued core observations whose neighborhoods fit the memory limit,
+             * at least one neighborhood is always prefetched */
+            size_t nPrefetched  = 0;
+            size_t entriesBytes = 0;
+            size_t lastPos      = qu.head();
+            for (; lastPos < qu.tail() && nPrefetched < maxPrefetched; lastPos++)
+            {
+                const size_t obs = *qu.getInternalPtr(lastPos);
+                if (!isCore[obs]) continue;
+
+                const size_t bytes = neighSizes[obs] * sizeof(size_t);
+                if (nPrefetched > 0 && entriesBytes + bytes > entriesLimit) break;
+
+                DAAL_CHECK_MALLOC(!prefetchedNeighs[nPrefetched].reserve(neighSizes[obs]));
+                prefetchedIndices[nPrefetched++] = obs;
+                entriesBytes += bytes;
+            }
+
+            DAAL_CHECK_STATUS_VAR(nEngine.queryReserved(prefetchedIndices, nPrefetched, prefetchedNeighs.get()));
+
+            size_t prefetchedPos = 0;
+            while (qu.head() < lastPos)
+            {
+                const size_t curObs = qu.pop();
+                if (!isCore[curObs]) continue;
+
+                DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, prefetchedNeighs[prefetchedPos], qu));
+                prefetchedNeighs[prefetchedPos].clear();
+                prefetchedPos++;
+            }
+        }
+    }
+
+    WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nClustersRows);
+    nClustersRows.get()[0] = nClusters;
+
+    if (par->resultsToCompute & (computeCoreIndices | computeCoreObservations))
+    {
+        DAAL_CHECK_STATUS_VAR(processResultsToCompute(par->resultsToCompute, isCore, ntData, ntCoreIndices, ntCoreObservations));
+    }
+
+    return s;
+}
+
 } // namespace internal
 } // namespace dbscan
 } // namespace algorithms
@@ -51,6 +51,10 @@ public:
                                     NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
                                     const Parameter * par);
 
+    services::Status computeMemLimit(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                     NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                     const Parameter * par);
+
 private:
     services::Status processNeighborhood(size_t clusterId, int * assignments, const Neighborhood<algorithmFPType, cpu> & neigh,
                                          Queue<size_t, cpu> & qu);
@@ -40,7 +40,15 @@ namespace interface1
  *  Constructs parameters of the DBSCAN algorithm
  */
 Parameter::Parameter()
-    : epsilon(0.5), minObservations(5), memorySavingMode(false), resultsToCompute(0), blockIndex(0), nBlocks(1), leftBlocks(1), rightBlocks(1)
+    : epsilon(0.5),
+      minObservations(5),
+      memorySavingMode(false),
+      resultsToCompute(0),
+      blockIndex(0),
+      nBlocks(1),
+      leftBlocks(1),
+      rightBlocks(1),
+      memoryLimit(0)
 {}
 
 /**
@@ -56,7 +64,8 @@ Parameter::Parameter(double _epsilon, size_t _minObservations)
       blockIndex(0),
       nBlocks(1),
       leftBlocks(1),
-      rightBlocks(1)
+      rightBlocks(1),
+      memoryLimit(0)
 {}
 
 /**
@@ -71,7 +80,8 @@ Parameter::Parameter(const Parameter & other)
       blockIndex(other.blockIndex),
       nBlocks(other.nBlocks),
       leftBlocks(other.leftBlocks),
-      rightBlocks(other.rightBlocks)
+      rightBlocks(other.rightBlocks),
+      memoryLimit(other.memoryLimit)
 {}
 
 services::Status Parameter::check() const
@@ -272,7 +272,34 @@ public:
         return result;
     }
 
-    // allocateNewEntries() should be called
+    // Allocates exactly the requested number of entries, so the memory
+    // consumed by the neighborhood is known in advance
+    int reserve(size_t capacity)
+    {
+        if (capacity <= _capacity)
+        {
+            return 0;
+        }
+
+        size_t * const newValues = daal::services::internal::service_scalable_malloc<size_t, cpu>(capacity);
+        if (!newValues)
+        {
+            return 1;
+        }
+
+        int result = 0;
+        if (_values != nullptr)
+        {
+            result = services::internal::daal_memcpy_s(newValues, _size * sizeof(size_t), _values, _size * sizeof(size_t));
+            daal::services::internal::service_scalable_free<size_t, cpu>(_values);
+        }
+        _values   = newValues;
+        _capacity = capacity;
+
+        return !!result;
+    }
+
+    // allocateNewEntries() or reserve() should be called
     void fastAdd(const size_t & value, FPType w)
     {
         _values[_size] = value;
@@ -399,6 +426,10 @@ public:
     services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false);
 
     services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false);
+
+    services::Status queryWeights(FPType * neighWeights, size_t * neighSizes);
+
+    services::Status queryReserved(const size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs);
 };
 
 template <typename FPType, CpuType cpu>
@@ -624,6 +655,142 @@ public:
         return s;
     }
 
+    // Computes the total weight and the number of observations in the neighborhood
+    // of every observation without storing the neighborhoods
+    services::Status queryWeights(FPType * neighWeights, size_t * neighSizes)
+    {
+        SafeStatus safeStat;
+
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        const size_t dim    = _inTable->getNumberOfColumns();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= dim);
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t inBlockSize = 128;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        const size_t outBlockSize = 256;
+        const size_t nOutBlocks   = outRows / outBlockSize + (outRows % outBlockSize > 0);
+
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            const size_t i1    = inBlock * inBlockSize;
+            const size_t i2    = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            for (size_t i = 0; i < iSize; i++)
+            {
+                neighWeights[i + i1] = FPType(0);
+                neighSizes[i + i1]   = 0;
+            }
+
+            for (size_t outBlock = 0; outBlock < nOutBlocks; outBlock++)
+            {
+                const size_t j1    = outBlock * outBlockSize;
+                const size_t j2    = (outBlock + 1 == nOutBlocks ? outRows : j1 + outBlockSize);
+                const size_t jSize = j2 - j1;
+
+                ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, jSize);
+                DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
+                const FPType * const outData = outDataRows.get();
+
+                ReadRows<FPType, cpu> weightsRows;
+                if (_weights)
+                {
+                    weightsRows.set(const_cast<NumericTable *>(_weights), j1, jSize);
+                    DAAL_CHECK_BLOCK_STATUS_THR(weightsRows);
+                }
+                const FPType * const weights = weightsRows.get();
+
+                for (size_t i = 0; i < iSize; i++)
+                {
+                    FPType weight = FPType(0);
+                    size_t size   = 0;
+                    for (size_t j = 0; j < jSize; j++)
+                    {
+                        const FPType dist = distancePow2<FPType, cpu>(&inData[i * dim], &outData[j * outDim], dim);
+                        if (dist <= epsP)
+                        {
+                            weight += (weights ? weights[j] : FPType(1));
+                            size++;
+                        }
+                    }
+                    neighWeights[i + i1] += weight;
+                    neighSizes[i + i1] += size;
+                }
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    // Computes the neighborhoods of the observations with the given indices in parallel.
+    // Each neighborhood should have been reserved with the size computed by queryWeights()
+    services::Status queryReserved(const size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs)
+    {
+        SafeStatus safeStat;
+
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        const size_t dim    = _inTable->getNumberOfColumns();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= dim);
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t queryBlockSize = 16;
+        const size_t nQueryBlocks   = n / queryBlockSize + (n % queryBlockSize > 0);
+
+        const size_t outBlockSize = 256;
+        const size_t nOutBlocks   = outRows / outBlockSize + (outRows % outBlockSize > 0);
+
+        daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t queryBlock) {
+            const size_t i1    = queryBlock * queryBlockSize;
+            const size_t i2    = (queryBlock + 1 == nQueryBlocks ? n : i1 + queryBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> queryRows[queryBlockSize];
+            for (size_t i = 0; i < iSize; i++)
+            {
+                queryRows[i].set(const_cast<NumericTable *>(_inTable), indices[i + i1], 1);
+                DAAL_CHECK_BLOCK_STATUS_THR(queryRows[i]);
+                neighs[i + i1].reset();
+            }
+
+            for (size_t outBlock = 0; outBlock < nOutBlocks; outBlock++)
+            {
+                const size_t j1    = outBlock * outBlockSize;
+                const size_t j2    = (outBlock + 1 == nOutBlocks ? outRows : j1 + outBlockSize);
+                const size_t jSize = j2 - j1;
+
+                ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, jSize);
+                DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
+                const FPType * const outData = outDataRows.get();
+
+                for (size_t i = 0; i < iSize; i++)
+                {
+                    for (size_t j = 0; j < jSize; j++)
+                    {
+                        const FPType dist = distancePow2<FPType, cpu>(queryRows[i].get(), &outData[j * outDim], dim);
+                        if (dist <= epsP)
+                        {
+                            neighs[i + i1].fastAdd(j + j1, FPType(0));
+                        }
+                    }
+                }
+            }
+        });
+
+        return safeStat.detach();
+    }
+
 private:
     const NumericTable * _inTable;
     const NumericTable * _outTable;
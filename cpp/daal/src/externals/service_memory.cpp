@@ -26,17 +26,29 @@
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
-    return daal::internal::Service<>::serv_malloc(size, alignment);
+    void * ptr = daal::internal::Service<>::serv_malloc(size, alignment);
+    if (ptr != NULL && daal::services::internal::isFirstTouchRequired(size))
+    {
+        daal::services::internal::service_first_touch<daal::sse2>(ptr, size);
+    }
+    return ptr;
 }
 
 void * daal::services::daal_calloc(size_t size, size_t alignment)
 {
-    void * ptr = daal::services::daal_malloc(size, alignment);
+    void * ptr = daal::internal::Service<>::serv_malloc(size, alignment);
     if (ptr == NULL)
     {
         return NULL;
     }
 
+    /* The mode is checked once, so the buffer is zero-filled even if the mode is switched concurrently */
+    if (daal::services::internal::isFirstTouchRequired(size))
+    {
+        daal::services::internal::service_first_touch<daal::sse2>(ptr, size);
+        return ptr;
+    }
+
     char * cptr = (char *)ptr;
 
     for (size_t i = 0; i < size; i++)
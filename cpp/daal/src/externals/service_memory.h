@@ -35,24 +35,48 @@ namespace services
 {
 namespace internal
 {
-template <typename T, CpuType cpu>
-T * service_calloc(size_t size, size_t alignment = 64)
+/* Buffers smaller than this size are initialized by the calling thread
+ * even if the first-touch mode is enabled */
+const size_t firstTouchMinSizeInBytes  = 4 * 1024 * 1024;
+const size_t firstTouchPageSizeInBytes = 4096;
+
+/* Returns true if the buffer is large enough to be initialized in the
+ * NUMA-aware first-touch mode, and the mode is enabled. Buffers allocated
+ * inside a parallel region are per-thread scratch, they are initialized by
+ * the calling thread to stay on its NUMA node */
+inline bool isFirstTouchRequired(size_t sizeInBytes)
 {
-    T * ptr = (T *)daal::services::daal_malloc(size * sizeof(T), alignment);
-    if (ptr == NULL)
-    {
-        return NULL;
-    }
+    return sizeInBytes >= firstTouchMinSizeInBytes && threader_is_first_touch_enabled() && !is_in_parallel();
+}
 
-    char * const cptr        = (char *)ptr;
-    const size_t sizeInBytes = size * sizeof(T);
+/* Zero-fills the buffer page by page with the same static partitioning of
+ * the pages between the threads as static_threader_for uses for the kernels,
+ * so on NUMA systems each page is placed on the node of the thread that
+ * processes it later */
+template <CpuType cpu>
+void service_first_touch(void * const ptr, const size_t sizeInBytes)
+{
+    char * const cptr   = (char *)ptr;
+    const size_t nPages = sizeInBytes / firstTouchPageSizeInBytes + !!(sizeInBytes % firstTouchPageSizeInBytes);
 
-    for (size_t i = 0; i < sizeInBytes; i++)
-    {
-        cptr[i] = '\0';
-    }
+    static_threader_for(nPages, [&](size_t page, size_t tid) {
+        const size_t begin = page * firstTouchPageSizeInBytes;
+        const size_t end   = (begin + firstTouchPageSizeInBytes < sizeInBytes) ? begin + firstTouchPageSizeInBytes : sizeInBytes;
 
-    return ptr;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = begin; i < end; i++)
+        {
+            cptr[i] = '\0';
+        }
+    });
+}
+
+template <typename T, CpuType cpu>
+T * service_calloc(size_t size, size_t alignment = 64)
+{
+    /* daal_calloc checks the first-touch mode once and zero-fills the buffer in either mode */
+    return (T *)daal::services::daal_calloc(size * sizeof(T), alignment);
 }
 
 template <typename T, CpuType cpu>
@@ -80,6 +104,12 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
     char * const cptr        = (char *)ptr;
     const size_t sizeInBytes = size * sizeof(T);
 
+    if (isFirstTouchRequired(sizeInBytes))
+    {
+        service_first_touch<cpu>(ptr, sizeInBytes);
+        return ptr;
+    }
+
     for (size_t i = 0; i < sizeInBytes; i++)
     {
         cptr[i] = '\0';
@@ -91,7 +121,12 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
 template <typename T, CpuType cpu>
 T * service_scalable_malloc(size_t size, size_t alignment = 64)
 {
-    return (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    T * ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    if (ptr != NULL && isFirstTouchRequired(size * sizeof(T)))
+    {
+        service_first_touch<cpu>(ptr, size * sizeof(T));
+    }
+    return ptr;
 }
 
 template <typename T, CpuType cpu>
@@ -23,10 +23,14 @@ namespace internal
 {
 ProfilerTask Profiler::startTask(const char * taskName)
 {
+    enterTask(taskName, "daal");
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::endTask(const char * taskName)
+{
+    leaveTask(taskName);
+}
 
 ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
 
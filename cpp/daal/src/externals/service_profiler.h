@@ -24,6 +24,8 @@
 #ifndef __SERVICE_PROFILER_H__
 #define __SERVICE_PROFILER_H__
 
+#include "services/daal_defines.h"
+
 #define DAAL_ITTNOTIFY_CONCAT2(x, y) x##y
 #define DAAL_ITTNOTIFY_CONCAT(x, y)  DAAL_ITTNOTIFY_CONCAT2(x, y)
 
@@ -36,7 +38,7 @@ namespace daal
 {
 namespace internal
 {
-class ProfilerTask
+class DAAL_EXPORT ProfilerTask
 {
 public:
     ProfilerTask(const char * taskName);
@@ -46,12 +48,49 @@ private:
     const char * _taskName;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
-class Profiler
+enum ProfilerMode
+{
+    profilerDisabled = 0, /*!< Tasks are not recorded */
+    profilerReport   = 1, /*!< Hierarchical report with wall time and call counts per task */
+    profilerTrace    = 2  /*!< Chrome trace JSON with one event per task execution */
+};
+
+/*
+ * Single collector for the tasks of both DAAL and oneAPI layers.
+ * Tasks are recorded per thread together with their parent, so a oneAPI call
+ * and the DAAL kernels it delegates to appear on one timeline.
+ * The initial mode is taken from the ONEDAL_PROFILER environment variable
+ * (report or trace), the output is written at process exit to the file given
+ * in ONEDAL_PROFILER_OUTPUT, or to stderr for the report and to
+ * onedal_trace.json for the trace.
+ *
+ * startTask, endTask and ProfilerTask are defined in service_profiler.cpp
+ * apart from the collector, so benchmarks can still redefine them.
+ */
+class DAAL_EXPORT Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
     static void endTask(const char * taskName);
+
+    /* Records the beginning of the task that belongs to the given layer ("daal", "onedal") */
+    static void enterTask(const char * taskName, const char * category);
+    static void leaveTask(const char * taskName);
+
+    static bool isEnabled();
+    static ProfilerMode getMode();
+    static void setMode(ProfilerMode mode);
+
+    /* Drops all recorded timings, tasks that are still running are kept */
+    static void reset();
+
+    /* Writes the zero-terminated hierarchical report to the buffer if it has
+     * enough space, returns the length of the report without the terminator */
+    static size_t getReport(char * buffer, size_t bufferSize);
+
+    /* Writes the zero-terminated Chrome trace JSON to the buffer if it has
+     * enough space, returns the length of the trace without the terminator */
+    static size_t getTrace(char * buffer, size_t bufferSize);
 };
 
 } // namespace internal
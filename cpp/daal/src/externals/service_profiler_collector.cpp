@@ -0,0 +1,571 @@
+/* file: service_profiler_collector.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Collector of the profiler tasks
+//--
+*/
+
+#include "src/externals/service_profiler.h"
+#include "src/algorithms/service_threading.h"
+#include "services/daal_atomic_int.h"
+#include "services/daal_memory.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <Windows.h>
+#else
+    #include <time.h>
+#endif
+
+namespace daal
+{
+namespace internal
+{
+namespace
+{
+int64_t getTimeNs()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return int64_t(double(counter.QuadPart) * 1e9 / double(frequency.QuadPart));
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return int64_t(time.tv_sec) * 1000000000 + int64_t(time.tv_nsec);
+#endif
+}
+
+bool isSameName(const char * first, const char * second)
+{
+    return first == second || strcmp(first, second) == 0;
+}
+
+/* Node of the task tree, children are kept in the order of the first call */
+template <typename Node>
+struct TreeNode
+{
+    TreeNode() : firstChild(NULL), lastChild(NULL), nextSibling(NULL) {}
+
+    ~TreeNode()
+    {
+        Node * child = firstChild;
+        while (child)
+        {
+            Node * next = child->nextSibling;
+            delete child;
+            child = next;
+        }
+    }
+
+    void addChild(Node * child)
+    {
+        if (lastChild)
+        {
+            lastChild->nextSibling = child;
+        }
+        else
+        {
+            firstChild = child;
+        }
+        lastChild = child;
+    }
+
+    Node * firstChild;
+    Node * lastChild;
+    Node * nextSibling;
+};
+
+struct TaskNode : public TreeNode<TaskNode>
+{
+    TaskNode(const char * taskName, const char * taskCategory, TaskNode * parentNode)
+        : name(taskName), category(taskCategory), parent(parentNode), count(0), totalNs(0), startNs(0)
+    {}
+
+    TaskNode * getChild(const char * taskName, const char * taskCategory)
+    {
+        for (TaskNode * child = firstChild; child; child = child->nextSibling)
+        {
+            if (isSameName(child->name, taskName)) return child;
+        }
+        TaskNode * child = new TaskNode(taskName, taskCategory, this);
+        addChild(child);
+        return child;
+    }
+
+    void reset()
+    {
+        count   = 0;
+        totalNs = 0;
+        for (TaskNode * child = firstChild; child; child = child->nextSibling)
+        {
+            child->reset();
+        }
+    }
+
+    const char * name;
+    const char * category;
+    TaskNode * parent;
+    int64_t count;
+    int64_t totalNs;
+    /* Start time of the running call, the running calls of a thread form
+     * the path from the root to the current node */
+    int64_t startNs;
+};
+
+/* Task trees of all threads merged by the task path */
+struct ReportNode : public TreeNode<ReportNode>
+{
+    ReportNode(const char * taskName, const char * taskCategory) : name(taskName), category(taskCategory), count(0), totalNs(0) {}
+
+    ReportNode * getChild(const char * taskName, const char * taskCategory)
+    {
+        for (ReportNode * child = firstChild; child; child = child->nextSibling)
+        {
+            if (isSameName(child->name, taskName)) return child;
+        }
+        ReportNode * child = new ReportNode(taskName, taskCategory);
+        addChild(child);
+        return child;
+    }
+
+    void merge(const TaskNode & src)
+    {
+        count += src.count;
+        totalNs += src.totalNs;
+        for (const TaskNode * child = src.firstChild; child; child = child->nextSibling)
+        {
+            getChild(child->name, child->category)->merge(*child);
+        }
+    }
+
+    bool hasRecords() const
+    {
+        if (count > 0) return true;
+        for (const ReportNode * child = firstChild; child; child = child->nextSibling)
+        {
+            if (child->hasRecords()) return true;
+        }
+        return false;
+    }
+
+    const char * name;
+    const char * category;
+    int64_t count;
+    int64_t totalNs;
+};
+
+struct TraceEvent
+{
+    const TaskNode * node;
+    int64_t startNs;
+    int64_t durationNs;
+};
+
+struct TraceChunk
+{
+    static const size_t capacity = 1024;
+
+    TraceChunk() : count(0), next(NULL) {}
+
+    TraceEvent events[capacity];
+    size_t count;
+    TraceChunk * next;
+};
+
+/* Tasks recorded by a single thread. The log is owned by the collector,
+ * so it outlives the thread and can be reported at process exit. */
+struct ThreadLog
+{
+    explicit ThreadLog(int64_t id) : threadId(id), root("", "", NULL), current(&root), firstChunk(NULL), lastChunk(NULL), next(NULL) {}
+
+    ~ThreadLog() { clearEvents(); }
+
+    void addEvent(const TaskNode * node, int64_t startNs, int64_t durationNs)
+    {
+        if (!lastChunk || lastChunk->count == TraceChunk::capacity)
+        {
+            TraceChunk * chunk = new TraceChunk();
+            if (lastChunk)
+            {
+                lastChunk->next = chunk;
+            }
+            else
+            {
+                firstChunk = chunk;
+            }
+            lastChunk = chunk;
+        }
+        TraceEvent & event = lastChunk->events[lastChunk->count++];
+        event.node         = node;
+        event.startNs      = startNs;
+        event.durationNs   = durationNs;
+    }
+
+    void clearEvents()
+    {
+        while (firstChunk)
+        {
+            TraceChunk * next = firstChunk->next;
+            delete firstChunk;
+            firstChunk = next;
+        }
+        lastChunk = NULL;
+    }
+
+    int64_t threadId;
+    TaskNode root;
+    TaskNode * current;
+    TraceChunk * firstChunk;
+    TraceChunk * lastChunk;
+    Mutex mutex;
+    ThreadLog * next;
+};
+
+/* Growing zero-terminated text */
+class TextBuffer
+{
+public:
+    TextBuffer() : _data(NULL), _size(0), _capacity(0) {}
+
+    ~TextBuffer() { daal::services::daal_free(_data); }
+
+    void append(const char * format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        const int length = vsnprintf(NULL, 0, format, args);
+        va_end(args);
+
+        if (length > 0 && reserve(_size + size_t(length) + 1))
+        {
+            vsnprintf(_data + _size, _capacity - _size, format, argsCopy);
+            _size += size_t(length);
+        }
+        va_end(argsCopy);
+    }
+
+    void appendJsonString(const char * str)
+    {
+        append("\"");
+        for (const char * c = str; *c; ++c)
+        {
+            append((*c == '"' || *c == '\\') ? "\\%c" : "%c", *c);
+        }
+        append("\"");
+    }
+
+    size_t copyTo(char * buffer, size_t bufferSize) const
+    {
+        if (buffer && bufferSize > _size)
+        {
+            if (_size > 0) memcpy(buffer, _data, _size);
+            buffer[_size] = '\0';
+        }
+        return _size;
+    }
+
+    const char * c_str() const { return _data ? _data : ""; }
+
+private:
+    bool reserve(size_t capacity)
+    {
+        if (capacity <= _capacity) return true;
+
+        const size_t newCapacity = (capacity > 2 * _capacity) ? capacity : 2 * _capacity;
+        char * newData           = (char *)daal::services::daal_malloc(newCapacity);
+        if (!newData) return false;
+
+        if (_size > 0) memcpy(newData, _data, _size);
+        daal::services::daal_free(_data);
+        _data     = newData;
+        _capacity = newCapacity;
+        return true;
+    }
+
+    char * _data;
+    size_t _size;
+    size_t _capacity;
+};
+
+void printNode(TextBuffer & text, const ReportNode & node, size_t depth)
+{
+    if (!node.hasRecords()) return;
+
+    const double totalMs   = double(node.totalNs) * 1e-6;
+    const double averageMs = node.count > 0 ? totalMs / double(node.count) : 0.0;
+
+    text.append("%14.3f %10lld %14.3f %8s  %*s%s\n", totalMs, static_cast<long long>(node.count), averageMs, node.category, int(2 * depth), "",
+                node.name);
+
+    for (const ReportNode * child = node.firstChild; child; child = child->nextSibling)
+    {
+        printNode(text, *child, depth + 1);
+    }
+}
+
+ProfilerMode getModeFromEnv()
+{
+    const char * value = getenv("ONEDAL_PROFILER");
+    if (value == NULL) return profilerDisabled;
+    if (strcmp(value, "trace") == 0) return profilerTrace;
+    if (strcmp(value, "report") == 0 || strcmp(value, "1") == 0) return profilerReport;
+    return profilerDisabled;
+}
+
+class Collector
+{
+public:
+    Collector() : _mode(int(getModeFromEnv())), _origin(getTimeNs()), _firstLog(NULL), _lastLog(NULL), _logCount(0) {}
+
+    ~Collector()
+    {
+        dump();
+        while (_firstLog)
+        {
+            ThreadLog * next = _firstLog->next;
+            delete _firstLog;
+            _firstLog = next;
+        }
+    }
+
+    ProfilerMode getMode() const { return ProfilerMode(_mode.get()); }
+
+    void setMode(ProfilerMode mode) { _mode.set(int(mode)); }
+
+    int64_t now() const { return getTimeNs() - _origin; }
+
+    ThreadLog & getLocalLog()
+    {
+        ThreadLog *& localLog = getLocalLogPtr();
+        if (!localLog)
+        {
+            AUTOLOCK(_mutex);
+            localLog = new ThreadLog(_logCount++);
+            if (_lastLog)
+            {
+                _lastLog->next = localLog;
+            }
+            else
+            {
+                _firstLog = localLog;
+            }
+            _lastLog = localLog;
+        }
+        return *localLog;
+    }
+
+    void enterTask(const char * taskName, const char * category)
+    {
+        ThreadLog & log = getLocalLog();
+        AUTOLOCK(log.mutex);
+        TaskNode * node = log.current->getChild(taskName, category);
+        node->startNs   = now();
+        log.current     = node;
+    }
+
+    /* Called in any mode, so the task that was entered is popped even if
+     * the profiler has been disabled meanwhile */
+    void leaveTask(const char * taskName)
+    {
+        ThreadLog * localLog = getLocalLogPtr();
+        /* Only the owning thread changes current, so it is read without the lock */
+        if (localLog == NULL || localLog->current == &localLog->root) return;
+
+        ThreadLog & log = *localLog;
+        AUTOLOCK(log.mutex);
+        TaskNode * node = log.current;
+        /* The task was started before the profiler has been enabled */
+        if (!isSameName(node->name, taskName)) return;
+        log.current = node->parent;
+
+        const int64_t durationNs = now() - node->startNs;
+        node->count++;
+        node->totalNs += durationNs;
+        if (getMode() == profilerTrace)
+        {
+            log.addEvent(node, node->startNs, durationNs);
+        }
+    }
+
+    void reset()
+    {
+        AUTOLOCK(_mutex);
+        for (ThreadLog * log = _firstLog; log; log = log->next)
+        {
+            AUTOLOCK(log->mutex);
+            log->root.reset();
+            log->clearEvents();
+        }
+    }
+
+    void getReport(TextBuffer & text)
+    {
+        ReportNode merged("", "");
+        {
+            AUTOLOCK(_mutex);
+            for (ThreadLog * log = _firstLog; log; log = log->next)
+            {
+                AUTOLOCK(log->mutex);
+                merged.merge(log->root);
+            }
+        }
+
+        text.append("oneDAL profiler report\n");
+        text.append("    total (ms)      calls       avg (ms)    layer  task\n");
+        for (const ReportNode * child = merged.firstChild; child; child = child->nextSibling)
+        {
+            printNode(text, *child, 0);
+        }
+    }
+
+    void getTrace(TextBuffer & text)
+    {
+        text.append("{\"traceEvents\":[");
+        bool isFirst = true;
+
+        AUTOLOCK(_mutex);
+        for (ThreadLog * log = _firstLog; log; log = log->next)
+        {
+            AUTOLOCK(log->mutex);
+            for (const TraceChunk * chunk = log->firstChunk; chunk; chunk = chunk->next)
+            {
+                for (size_t i = 0; i < chunk->count; ++i)
+                {
+                    const TraceEvent & event = chunk->events[i];
+                    text.append(isFirst ? "\n{\"name\":" : ",\n{\"name\":");
+                    text.appendJsonString(event.node->name);
+                    text.append(",\"cat\":");
+                    text.appendJsonString(event.node->category);
+                    text.append(",\"ph\":\"X\",\"pid\":0,\"tid\":%lld,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"parent\":",
+                                static_cast<long long>(log->threadId), double(event.startNs) * 1e-3, double(event.durationNs) * 1e-3);
+                    text.appendJsonString(event.node->parent ? event.node->parent->name : "");
+                    text.append("}}");
+                    isFirst = false;
+                }
+            }
+        }
+        text.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+    }
+
+private:
+    void dump()
+    {
+        const ProfilerMode mode = getMode();
+        if (mode == profilerDisabled) return;
+
+        TextBuffer text;
+        if (mode == profilerTrace)
+        {
+            getTrace(text);
+        }
+        else
+        {
+            getReport(text);
+        }
+
+        const char * output = getenv("ONEDAL_PROFILER_OUTPUT");
+        if (output == NULL && mode == profilerReport)
+        {
+            fputs(text.c_str(), stderr);
+            return;
+        }
+
+        FILE * file = fopen(output ? output : "onedal_trace.json", "w");
+        if (file == NULL) return;
+        fputs(text.c_str(), file);
+        fclose(file);
+    }
+
+    static ThreadLog *& getLocalLogPtr()
+    {
+        static thread_local ThreadLog * localLog = NULL;
+        return localLog;
+    }
+
+    daal::services::Atomic<int> _mode;
+    int64_t _origin;
+    Mutex _mutex;
+    ThreadLog * _firstLog;
+    ThreadLog * _lastLog;
+    int64_t _logCount;
+};
+
+Collector & getCollector()
+{
+    static Collector instance;
+    return instance;
+}
+
+} // namespace
+
+void Profiler::enterTask(const char * taskName, const char * category)
+{
+    Collector & collector = getCollector();
+    if (collector.getMode() != profilerDisabled) collector.enterTask(taskName, category);
+}
+
+void Profiler::leaveTask(const char * taskName)
+{
+    getCollector().leaveTask(taskName);
+}
+
+bool Profiler::isEnabled()
+{
+    return getCollector().getMode() != profilerDisabled;
+}
+
+ProfilerMode Profiler::getMode()
+{
+    return getCollector().getMode();
+}
+
+void Profiler::setMode(ProfilerMode mode)
+{
+    getCollector().setMode(mode);
+}
+
+void Profiler::reset()
+{
+    getCollector().reset();
+}
+
+size_t Profiler::getReport(char * buffer, size_t bufferSize)
+{
+    TextBuffer text;
+    getCollector().getReport(text);
+    return text.copyTo(buffer, bufferSize);
+}
+
+size_t Profiler::getTrace(char * buffer, size_t bufferSize)
+{
+    TextBuffer text;
+    getCollector().getTrace(text);
+    return text.copyTo(buffer, bufferSize);
+}
+
+} // namespace internal
+} // namespace daal
@@ -177,6 +177,12 @@ DAAL_EXPORT int daal::services::Environment::setMemoryLimit(MemType type, size_t
     return daal::internal::Service<>::serv_set_memory_limit(type, limit);
 }
 
+DAAL_EXPORT void daal::services::Environment::enableNumaFirstTouch(const bool enableFirstTouchFlag)
+{
+    initNumberOfThreads();
+    daal::threader_env()->enableFirstTouch(enableFirstTouchFlag);
+}
+
 DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool enableThreadPinningFlag)
 {
     initNumberOfThreads();
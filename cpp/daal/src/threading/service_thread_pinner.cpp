@@ -335,6 +335,70 @@ thread_pinner_impl_t::~thread_pinner_impl_t()
     return;
 } /* ~thread_pinner_impl_t() */
 
+/* Pins the threads entering the arena to the CPUs from the list in order of
+ * their slot indices in the arena. Unlike the global pinner, it is created for
+ * a single arena, so independent arenas can be pinned to disjoint sets of CPUs. */
+class arena_pinner_t : public tbb::task_scheduler_observer
+{
+    AtomicInt status; /* Negative if the affinity of any thread could not be changed */
+    const int * cpu_ids;
+    int cpu_count;
+    tbb::enumerable_thread_specific<cpu_mask_t *> thread_mask;
+
+public:
+    arena_pinner_t(tbb::task_arena & arena, const int * cpu_idsToSet, int cpu_countToSet)
+        : tbb::task_scheduler_observer(arena), status(0), cpu_ids(cpu_idsToSet), cpu_count(cpu_countToSet)
+    {
+        observe(true);
+    }
+
+    void on_scheduler_entry(bool) /*override*/
+    {
+        if (status.get() < 0) return;
+
+        const int thr_idx = tbb::this_task_arena::current_thread_index();
+        const int cpu_idx = cpu_ids[thr_idx % cpu_count];
+
+        cpu_mask_t * source_mask = thread_mask.local();
+        if (source_mask == NULL)
+        {
+            source_mask         = new cpu_mask_t();
+            thread_mask.local() = source_mask;
+        }
+        if (source_mask->get_thread_affinity() < 0)
+        {
+            status.set(-1);
+            return;
+        }
+
+        cpu_mask_t target_mask;
+        if (target_mask.set_cpu_index(cpu_idx) < 0 || target_mask.set_thread_affinity() < 0) status.set(-1);
+    }
+
+    void on_scheduler_exit(bool) /*override*/
+    {
+        cpu_mask_t * source_mask = thread_mask.local();
+        if (source_mask == NULL) return;
+        if (source_mask->set_thread_affinity() < 0) status.set(-1);
+    }
+
+    ~arena_pinner_t()
+    {
+        observe(false);
+        thread_mask.combine_each([](cpu_mask_t *& source_mask) { delete source_mask; });
+    }
+};
+
+DAAL_EXPORT void * _thread_pinner_new_arena_pinner(void * arena, const int * cpu_ids, int cpu_count)
+{
+    return new arena_pinner_t(*static_cast<tbb::task_arena *>(arena), cpu_ids, cpu_count);
+}
+
+DAAL_EXPORT void _thread_pinner_del_arena_pinner(void * arenaPinner)
+{
+    delete static_cast<arena_pinner_t *>(arenaPinner);
+}
+
 DAAL_EXPORT void * _getThreadPinner(bool create_pinner, void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *))
 {
     static bool pinner_created = false;
@@ -416,6 +480,12 @@ DAAL_EXPORT int _thread_pinner_get_status()
 DAAL_EXPORT void _thread_pinner_on_scheduler_entry(bool p) {}
 DAAL_EXPORT void _thread_pinner_on_scheduler_exit(bool p) {}
 
+DAAL_EXPORT void * _thread_pinner_new_arena_pinner(void * arena, const int * cpu_ids, int cpu_count)
+{
+    return NULL;
+}
+DAAL_EXPORT void _thread_pinner_del_arena_pinner(void * arenaPinner) {}
+
     #endif /* if __DO_TBB_LAYER__ is not defined */
 
 #endif /* #if !defined (DAAL_THREAD_PINNING_DISABLED) */
@@ -99,6 +99,9 @@ extern "C"
     DAAL_EXPORT bool _thread_pinner_set_pinning(bool p);
 
     DAAL_EXPORT void * _getThreadPinner(bool create_pinner, void(int &, int &, int &, int **), void (*deleter)(void *));
+
+    DAAL_EXPORT void * _thread_pinner_new_arena_pinner(void * arena, const int * cpu_ids, int cpu_count);
+    DAAL_EXPORT void _thread_pinner_del_arena_pinner(void * arenaPinner);
 }
 
 namespace daal
@@ -22,6 +22,7 @@
 */
 
 #include "src/threading/threading.h"
+#include "src/threading/service_thread_pinner.h"
 #include "services/daal_memory.h"
 
 #if defined(__DO_TBB_LAYER__)
@@ -458,6 +459,45 @@ DAAL_EXPORT void * _daal_threader_env()
     return &env;
 }
 
+#if defined(__DO_TBB_LAYER__) && !defined(DAAL_THREAD_PINNING_DISABLED)
+/* Releases the arena pinner even if the executed function throws. The arena is
+ * terminated first, so the pinner observes the threads leaving the arena and
+ * is not destroyed while the arena can still call it */
+class ArenaPinnerOwner
+{
+public:
+    ArenaPinnerOwner(tbb::task_arena & arena, void * pinner) : _arena(arena), _pinner(pinner) {}
+    ~ArenaPinnerOwner()
+    {
+        if (_pinner)
+        {
+            _arena.terminate();
+            _thread_pinner_del_arena_pinner(_pinner);
+        }
+    }
+
+private:
+    tbb::task_arena & _arena;
+    void * _pinner;
+};
+#endif
+
+DAAL_EXPORT void _daal_execute_in_arena(int max_concurrency, const int * cpu_ids, int cpu_count, const void * a, daal::functype_arena func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (max_concurrency <= 0) max_concurrency = (cpu_count > 0) ? cpu_count : tbb::task_arena::automatic;
+
+    tbb::task_arena arena(max_concurrency);
+    arena.initialize();
+    #if !defined(DAAL_THREAD_PINNING_DISABLED)
+    ArenaPinnerOwner pinner(arena, (cpu_count > 0) ? _thread_pinner_new_arena_pinner(&arena, cpu_ids, cpu_count) : NULL);
+    #endif
+    arena.execute([&]() { func(a); });
+#elif defined(__DO_SEQ_LAYER__)
+    func(a);
+#endif
+}
+
 #if defined(__DO_TBB_LAYER__)
 template <typename T, typename Key, typename Pred>
 //Returns an index of the first element in the range[ar, ar + n) that is not less than(i.e.greater or equal to) value.
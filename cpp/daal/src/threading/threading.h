@@ -26,6 +26,7 @@
 
 #include <stdint.h>
 #include "services/daal_defines.h"
+#include "services/daal_atomic_int.h"
 
 namespace daal
 {
@@ -51,6 +52,7 @@ typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t e
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
 typedef int64_t (*reduction_functype_int64)(int64_t a, int64_t b, const void * reduction);
+typedef void (*functype_arena)(const void * a);
 
 class task;
 } // namespace daal
@@ -104,6 +106,8 @@ extern "C"
 
     DAAL_EXPORT void * _daal_threader_env();
 
+    DAAL_EXPORT void _daal_execute_in_arena(int max_concurrency, const int * cpu_ids, int cpu_count, const void * a, daal::functype_arena func);
+
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
 
@@ -163,12 +167,16 @@ inline void threaded_scalable_free(void * ptr)
 class ThreaderEnvironment
 {
 public:
-    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()) {}
+    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()), _firstTouchEnabled(0) {}
     size_t getNumberOfThreads() const { return _numberOfThreads; }
     void setNumberOfThreads(size_t value) { _numberOfThreads = value; }
+    bool isFirstTouchEnabled() const { return _firstTouchEnabled.get() != 0; }
+    void enableFirstTouch(bool value) { _firstTouchEnabled.set(value ? 1 : 0); }
 
 private:
     size_t _numberOfThreads;
+    /* Read by the allocations made from any thread, so the flag is atomic */
+    services::Atomic<int> _firstTouchEnabled;
 };
 
 inline ThreaderEnvironment * threader_env()
@@ -181,6 +189,11 @@ inline size_t threader_get_threads_number()
     return threader_env()->getNumberOfThreads();
 }
 
+inline bool threader_is_first_touch_enabled()
+{
+    return threader_env()->isFirstTouchEnabled();
+}
+
 inline size_t setNumberOfThreads(const size_t numThreads, void ** globalControl)
 {
     return _setNumberOfThreads(numThreads, globalControl);
@@ -21,7 +21,10 @@
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/compute.hpp"
 #include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/finalize_compute.hpp"
 #include "oneapi/dal/infer.hpp"
+#include "oneapi/dal/partial_compute.hpp"
+#include "oneapi/dal/partial_train.hpp"
 #include "oneapi/dal/read.hpp"
 #include "oneapi/dal/train.hpp"
 
@@ -39,6 +42,7 @@
 
 /* I/O */
 #include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/io/graph_snapshot.hpp"
 
 /* Algos */
 #include "oneapi/dal/algo/connected_components.hpp"
@@ -15,9 +15,12 @@
 *******************************************************************************/
 
 #include "oneapi/dal/algo/basic_statistics/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/finalize_compute_kernel.hpp"
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/partial_compute_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/algo/basic_statistics/backend/basic_statistics_interop.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
@@ -32,6 +35,8 @@ using task_t = task::compute;
 using input_t = compute_input<task_t>;
 using result_t = compute_result<task_t>;
 using descriptor_t = detail::descriptor_base<task_t>;
+using partial_result_t = partial_compute_result<task_t>;
+using comm_t = dal::backend::communicator<spmd::device_memory_access::none>;
 
 namespace daal_lom = daal::algorithms::low_order_moments;
 namespace interop = dal::backend::interop;
@@ -72,8 +77,74 @@ static result_t call_daal_kernel(const context_cpu& ctx,
     return result;
 }
 
+template <typename Float>
+static array<Float> pull_mutable(const table& t) {
+    const auto arr = row_accessor<const Float>{ t }.pull();
+    auto copy = array<Float>::empty(arr.get_count());
+    dal::backend::copy(copy.get_mutable_data(), arr.get_data(), arr.get_count());
+    return copy;
+}
+
+/// Reduces the partial results computed on the local data of all the ranks.
+/// The local sums of squared deviations are taken from the local means, so they
+/// are shifted to the global mean before the summation.
+template <typename Float>
+static partial_result_t allreduce_partial_results(const comm_t& comm,
+                                                  const partial_result_t& local) {
+    const std::int64_t column_count = local.get_partial_sum().get_column_count();
+
+    auto arr_n_rows = pull_mutable<Float>(local.get_partial_n_rows());
+    auto arr_min = pull_mutable<Float>(local.get_partial_min());
+    auto arr_max = pull_mutable<Float>(local.get_partial_max());
+    auto arr_sum = pull_mutable<Float>(local.get_partial_sum());
+    auto arr_sum2 = pull_mutable<Float>(local.get_partial_sum_squares());
+    auto arr_sum2_cent = pull_mutable<Float>(local.get_partial_sum_squares_centered());
+
+    const Float local_n_rows = arr_n_rows[0];
+    const auto local_sum = row_accessor<const Float>{ local.get_partial_sum() }.pull();
+
+    comm.allreduce(arr_n_rows).wait();
+    comm.allreduce(arr_min, spmd::reduce_op::min).wait();
+    comm.allreduce(arr_max, spmd::reduce_op::max).wait();
+    comm.allreduce(arr_sum).wait();
+    comm.allreduce(arr_sum2).wait();
+
+    const Float n_rows = arr_n_rows[0];
+    Float* sum2_cent = arr_sum2_cent.get_mutable_data();
+    if (local_n_rows > Float(0)) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            const Float shift = local_sum[j] / local_n_rows - arr_sum[j] / n_rows;
+            sum2_cent[j] += local_n_rows * shift * shift;
+        }
+    }
+    comm.allreduce(arr_sum2_cent).wait();
+
+    return partial_result_t{}
+        .set_partial_n_rows(homogen_table::wrap(arr_n_rows, 1, 1))
+        .set_partial_min(homogen_table::wrap(arr_min, 1, column_count))
+        .set_partial_max(homogen_table::wrap(arr_max, 1, column_count))
+        .set_partial_sum(homogen_table::wrap(arr_sum, 1, column_count))
+        .set_partial_sum_squares(homogen_table::wrap(arr_sum2, 1, column_count))
+        .set_partial_sum_squares_centered(homogen_table::wrap(arr_sum2_cent, 1, column_count));
+}
+
+template <typename Float>
+static result_t call_daal_spmd_kernel(const context_cpu& ctx,
+                                      const descriptor_t& desc,
+                                      const table& data) {
+    const auto local = partial_compute_kernel_cpu<Float, method_t, task_t>{}(
+        ctx,
+        desc,
+        partial_compute_input<task_t>{ data });
+    const auto global = allreduce_partial_results<Float>(ctx.get_communicator(), local);
+    return finalize_compute_kernel_cpu<Float, method_t, task_t>{}(ctx, desc, global);
+}
+
 template <typename Float>
 static result_t compute(const context_cpu& ctx, const descriptor_t& desc, const input_t& input) {
+    if (ctx.get_communicator().is_distributed()) {
+        return call_daal_spmd_kernel<Float>(ctx, desc, input.get_data());
+    }
     return call_daal_kernel<Float>(ctx, desc, input.get_data());
 }
 
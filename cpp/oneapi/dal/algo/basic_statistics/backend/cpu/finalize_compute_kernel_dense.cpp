@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/finalize_compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using dal::backend::context_cpu;
+using method_t = method::dense;
+using task_t = task::compute;
+using input_t = partial_compute_result<task_t>;
+using result_t = compute_result<task_t>;
+using descriptor_t = detail::descriptor_base<task_t>;
+
+namespace daal_lom = daal::algorithms::low_order_moments;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, daal_lom::defaultDense, Cpu>;
+
+template <typename Float>
+static result_t call_daal_kernel_finalize(const context_cpu& ctx,
+                                          const descriptor_t& desc,
+                                          const input_t& input) {
+    const std::int64_t column_count = input.get_partial_sum().get_column_count();
+
+    auto daal_parameter = daal_lom::Parameter(daal_lom::estimatesAll);
+
+    const auto daal_n_rows = interop::convert_to_daal_table<Float>(input.get_partial_n_rows());
+    const auto daal_sum = interop::convert_to_daal_table<Float>(input.get_partial_sum());
+    const auto daal_sum2 = interop::convert_to_daal_table<Float>(input.get_partial_sum_squares());
+    const auto daal_sum2_cent =
+        interop::convert_to_daal_table<Float>(input.get_partial_sum_squares_centered());
+
+    auto arr_mean = array<Float>::empty(column_count);
+    auto arr_raw2_mom = array<Float>::empty(column_count);
+    auto arr_variance = array<Float>::empty(column_count);
+    auto arr_std_dev = array<Float>::empty(column_count);
+    auto arr_variation = array<Float>::empty(column_count);
+
+    const auto daal_mean = interop::convert_to_daal_homogen_table(arr_mean, 1, column_count);
+    const auto daal_raw2_mom =
+        interop::convert_to_daal_homogen_table(arr_raw2_mom, 1, column_count);
+    const auto daal_variance =
+        interop::convert_to_daal_homogen_table(arr_variance, 1, column_count);
+    const auto daal_std_dev = interop::convert_to_daal_homogen_table(arr_std_dev, 1, column_count);
+    const auto daal_variation =
+        interop::convert_to_daal_homogen_table(arr_variation, 1, column_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel_finalize_compute<Float, daal_lom_online_kernel_t>(
+            ctx,
+            daal_n_rows.get(),
+            daal_sum.get(),
+            daal_sum2.get(),
+            daal_sum2_cent.get(),
+            daal_mean.get(),
+            daal_raw2_mom.get(),
+            daal_variance.get(),
+            daal_std_dev.get(),
+            daal_variation.get(),
+            &daal_parameter));
+
+    const auto res_op = desc.get_result_options();
+    auto result = result_t{}.set_result_options(res_op);
+
+    if (res_op.test(result_options::min)) {
+        result.set_min(input.get_partial_min());
+    }
+    if (res_op.test(result_options::max)) {
+        result.set_max(input.get_partial_max());
+    }
+    if (res_op.test(result_options::sum)) {
+        result.set_sum(input.get_partial_sum());
+    }
+    if (res_op.test(result_options::sum_squares)) {
+        result.set_sum_squares(input.get_partial_sum_squares());
+    }
+    if (res_op.test(result_options::sum_squares_centered)) {
+        result.set_sum_squares_centered(input.get_partial_sum_squares_centered());
+    }
+    if (res_op.test(result_options::mean)) {
+        result.set_mean(homogen_table::wrap(arr_mean, 1, column_count));
+    }
+    if (res_op.test(result_options::second_order_raw_moment)) {
+        result.set_second_order_raw_moment(homogen_table::wrap(arr_raw2_mom, 1, column_count));
+    }
+    if (res_op.test(result_options::variance)) {
+        result.set_variance(homogen_table::wrap(arr_variance, 1, column_count));
+    }
+    if (res_op.test(result_options::standard_deviation)) {
+        result.set_standard_deviation(homogen_table::wrap(arr_std_dev, 1, column_count));
+    }
+    if (res_op.test(result_options::variation)) {
+        result.set_variation(homogen_table::wrap(arr_variation, 1, column_count));
+    }
+
+    return result;
+}
+
+template <typename Float>
+static result_t finalize_compute(const context_cpu& ctx,
+                                 const descriptor_t& desc,
+                                 const input_t& input) {
+    return call_daal_kernel_finalize<Float>(ctx, desc, input);
+}
+
+template <typename Float>
+struct finalize_compute_kernel_cpu<Float, method_t, task_t> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return finalize_compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct finalize_compute_kernel_cpu<float, method_t, task_t>;
+template struct finalize_compute_kernel_cpu<double, method_t, task_t>;
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/backend/cpu/partial_compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include <daal/src/algorithms/low_order_moments/low_order_moments_kernel.h>
+
+namespace oneapi::dal::basic_statistics::backend {
+
+using dal::backend::context_cpu;
+using method_t = method::dense;
+using task_t = task::compute;
+using input_t = partial_compute_input<task_t>;
+using result_t = partial_compute_result<task_t>;
+using descriptor_t = detail::descriptor_base<task_t>;
+
+namespace daal_lom = daal::algorithms::low_order_moments;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_lom_online_kernel_t =
+    daal_lom::internal::LowOrderMomentsOnlineKernel<Float, daal_lom::defaultDense, Cpu>;
+
+/// Returns a mutable copy of the partial statistic, as the online kernel
+/// accumulates the new block in place
+template <typename Float>
+static array<Float> copy_partial(const table& partial, std::int64_t count) {
+    auto arr = array<Float>::empty(count);
+    if (partial.has_data()) {
+        const auto prev = row_accessor<const Float>{ partial }.pull();
+        ONEDAL_ASSERT(prev.get_count() == count);
+        dal::backend::copy(arr.get_mutable_data(), prev.get_data(), count);
+    }
+    return arr;
+}
+
+template <typename Float>
+static result_t call_daal_kernel(const context_cpu& ctx,
+                                 const descriptor_t& desc,
+                                 const result_t& prev,
+                                 const table& data) {
+    const std::int64_t column_count = data.get_column_count();
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+
+    // The partial result must hold all the statistics to be finalized later,
+    // so the estimates requested by the descriptor are not taken into account
+    auto daal_parameter = daal_lom::Parameter(daal_lom::estimatesAll);
+
+    // The kernel initializes the partial result on the first block
+    const bool is_online = prev.get_partial_n_rows().has_data();
+
+    auto arr_n_rows = copy_partial<Float>(prev.get_partial_n_rows(), 1);
+    auto arr_min = copy_partial<Float>(prev.get_partial_min(), column_count);
+    auto arr_max = copy_partial<Float>(prev.get_partial_max(), column_count);
+    auto arr_sum = copy_partial<Float>(prev.get_partial_sum(), column_count);
+    auto arr_sum2 = copy_partial<Float>(prev.get_partial_sum_squares(), column_count);
+    auto arr_sum2_cent = copy_partial<Float>(prev.get_partial_sum_squares_centered(), column_count);
+
+    daal_lom::PartialResult daal_partial;
+    daal_partial.set(daal_lom::nObservations,
+                     interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1));
+    daal_partial.set(daal_lom::partialMinimum,
+                     interop::convert_to_daal_homogen_table(arr_min, 1, column_count));
+    daal_partial.set(daal_lom::partialMaximum,
+                     interop::convert_to_daal_homogen_table(arr_max, 1, column_count));
+    daal_partial.set(daal_lom::partialSum,
+                     interop::convert_to_daal_homogen_table(arr_sum, 1, column_count));
+    daal_partial.set(daal_lom::partialSumSquares,
+                     interop::convert_to_daal_homogen_table(arr_sum2, 1, column_count));
+    daal_partial.set(daal_lom::partialSumSquaresCentered,
+                     interop::convert_to_daal_homogen_table(arr_sum2_cent, 1, column_count));
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_lom_online_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   &daal_partial,
+                                                                   &daal_parameter,
+                                                                   is_online));
+
+    return result_t{}
+        .set_partial_n_rows(homogen_table::wrap(arr_n_rows, 1, 1))
+        .set_partial_min(homogen_table::wrap(arr_min, 1, column_count))
+        .set_partial_max(homogen_table::wrap(arr_max, 1, column_count))
+        .set_partial_sum(homogen_table::wrap(arr_sum, 1, column_count))
+        .set_partial_sum_squares(homogen_table::wrap(arr_sum2, 1, column_count))
+        .set_partial_sum_squares_centered(homogen_table::wrap(arr_sum2_cent, 1, column_count));
+}
+
+template <typename Float>
+static result_t partial_compute(const context_cpu& ctx,
+                                const descriptor_t& desc,
+                                const input_t& input) {
+    return call_daal_kernel<Float>(ctx, desc, input.get_prev(), input.get_data());
+}
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method_t, task_t> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return partial_compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct partial_compute_kernel_cpu<float, method_t, task_t>;
+template struct partial_compute_kernel_cpu<double, method_t, task_t>;
+
+} // namespace oneapi::dal::basic_statistics::backend
@@ -0,0 +1,236 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/partial_compute_types.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#include <algorithm>
+
+namespace oneapi::dal::basic_statistics {
+
+template <typename Task>
+class detail::v1::partial_compute_input_impl : public base {
+public:
+    partial_compute_input_impl(const partial_compute_result<Task>& prev, const table& data)
+            : prev(prev),
+              data(data) {}
+
+    partial_compute_result<Task> prev;
+    table data;
+};
+
+template <typename Task>
+class detail::v1::partial_compute_result_impl : public base {
+public:
+    table partial_n_rows;
+    table partial_min;
+    table partial_max;
+    table partial_sum;
+    table partial_sum_squares;
+    table partial_sum_squares_centered;
+};
+
+using detail::v1::partial_compute_input_impl;
+using detail::v1::partial_compute_result_impl;
+
+namespace v1 {
+
+template <typename Task>
+partial_compute_result<Task>::partial_compute_result()
+        : impl_(new partial_compute_result_impl<Task>{}) {}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_n_rows() const {
+    return impl_->partial_n_rows;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_n_rows_impl(const table& value) {
+    impl_->partial_n_rows = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_min() const {
+    return impl_->partial_min;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_min_impl(const table& value) {
+    impl_->partial_min = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_max() const {
+    return impl_->partial_max;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_max_impl(const table& value) {
+    impl_->partial_max = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum() const {
+    return impl_->partial_sum;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_impl(const table& value) {
+    impl_->partial_sum = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum_squares() const {
+    return impl_->partial_sum_squares;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_squares_impl(const table& value) {
+    impl_->partial_sum_squares = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum_squares_centered() const {
+    return impl_->partial_sum_squares_centered;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_squares_centered_impl(const table& value) {
+    impl_->partial_sum_squares_centered = value;
+}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(const table& data)
+        : impl_(new partial_compute_input_impl<Task>(partial_compute_result<Task>{}, data)) {}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(const partial_compute_result<Task>& prev,
+                                                   const table& data)
+        : impl_(new partial_compute_input_impl<Task>(prev, data)) {}
+
+template <typename Task>
+const table& partial_compute_input<Task>::get_data() const {
+    return impl_->data;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+template <typename Task>
+const partial_compute_result<Task>& partial_compute_input<Task>::get_prev() const {
+    return impl_->prev;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_prev_impl(const partial_compute_result<Task>& value) {
+    impl_->prev = value;
+}
+
+template <typename Float>
+static array<Float> pull_row(const table& t) {
+    return row_accessor<const Float>{ t }.pull();
+}
+
+template <typename Float, typename Task>
+static partial_compute_result<Task> merge_partial_results_impl(
+    const partial_compute_result<Task>& lhs,
+    const partial_compute_result<Task>& rhs) {
+    const std::int64_t column_count = lhs.get_partial_sum().get_column_count();
+
+    const Float n1 = pull_row<Float>(lhs.get_partial_n_rows())[0];
+    const Float n2 = pull_row<Float>(rhs.get_partial_n_rows())[0];
+    const Float n = n1 + n2;
+
+    const auto lhs_min = pull_row<Float>(lhs.get_partial_min());
+    const auto rhs_min = pull_row<Float>(rhs.get_partial_min());
+    const auto lhs_max = pull_row<Float>(lhs.get_partial_max());
+    const auto rhs_max = pull_row<Float>(rhs.get_partial_max());
+    const auto lhs_sum = pull_row<Float>(lhs.get_partial_sum());
+    const auto rhs_sum = pull_row<Float>(rhs.get_partial_sum());
+    const auto lhs_sum2 = pull_row<Float>(lhs.get_partial_sum_squares());
+    const auto rhs_sum2 = pull_row<Float>(rhs.get_partial_sum_squares());
+    const auto lhs_sum2_cent = pull_row<Float>(lhs.get_partial_sum_squares_centered());
+    const auto rhs_sum2_cent = pull_row<Float>(rhs.get_partial_sum_squares_centered());
+
+    auto n_rows = array<Float>::full(1, n);
+    auto min = array<Float>::empty(column_count);
+    auto max = array<Float>::empty(column_count);
+    auto sum = array<Float>::empty(column_count);
+    auto sum2 = array<Float>::empty(column_count);
+    auto sum2_cent = array<Float>::empty(column_count);
+
+    Float* min_ptr = min.get_mutable_data();
+    Float* max_ptr = max.get_mutable_data();
+    Float* sum_ptr = sum.get_mutable_data();
+    Float* sum2_ptr = sum2.get_mutable_data();
+    Float* sum2_cent_ptr = sum2_cent.get_mutable_data();
+
+    // Sums of squared deviations are merged with the pairwise update by
+    // Chan et al., which corrects them by the difference of the block means
+    const Float weight = (n > Float(0)) ? n1 * n2 / n : Float(0);
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        min_ptr[j] = std::min(lhs_min[j], rhs_min[j]);
+        max_ptr[j] = std::max(lhs_max[j], rhs_max[j]);
+        sum_ptr[j] = lhs_sum[j] + rhs_sum[j];
+        sum2_ptr[j] = lhs_sum2[j] + rhs_sum2[j];
+
+        const Float delta = rhs_sum[j] / n2 - lhs_sum[j] / n1;
+        sum2_cent_ptr[j] = lhs_sum2_cent[j] + rhs_sum2_cent[j] + weight * delta * delta;
+    }
+
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(n_rows, 1, 1))
+        .set_partial_min(homogen_table::wrap(min, 1, column_count))
+        .set_partial_max(homogen_table::wrap(max, 1, column_count))
+        .set_partial_sum(homogen_table::wrap(sum, 1, column_count))
+        .set_partial_sum_squares(homogen_table::wrap(sum2, 1, column_count))
+        .set_partial_sum_squares_centered(homogen_table::wrap(sum2_cent, 1, column_count));
+}
+
+template <typename Task>
+partial_compute_result<Task> merge_partial_results(const partial_compute_result<Task>& lhs,
+                                                   const partial_compute_result<Task>& rhs) {
+    if (!rhs.get_partial_n_rows().has_data()) {
+        return lhs;
+    }
+    if (!lhs.get_partial_n_rows().has_data()) {
+        return rhs;
+    }
+    if (lhs.get_partial_sum().get_column_count() != rhs.get_partial_sum().get_column_count()) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_partial_results());
+    }
+
+    const auto& meta = lhs.get_partial_sum().get_metadata();
+    if (meta.get_data_type(0) == data_type::float32) {
+        return merge_partial_results_impl<float>(lhs, rhs);
+    }
+    return merge_partial_results_impl<double>(lhs, rhs);
+}
+
+template class ONEDAL_EXPORT partial_compute_input<task::compute>;
+template class ONEDAL_EXPORT partial_compute_result<task::compute>;
+
+template ONEDAL_EXPORT partial_compute_result<task::compute> merge_partial_results(
+    const partial_compute_result<task::compute>&,
+    const partial_compute_result<task::compute>&);
+
+} // namespace v1
+} // namespace oneapi::dal::basic_statistics
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/basic_statistics/compute_types.hpp"
+
+namespace oneapi::dal::basic_statistics {
+
+namespace detail {
+namespace v1 {
+template <typename Task>
+class partial_compute_input_impl;
+
+template <typename Task>
+class partial_compute_result_impl;
+} // namespace v1
+
+using v1::partial_compute_input_impl;
+using v1::partial_compute_result_impl;
+
+} // namespace detail
+
+namespace v1 {
+
+/// Statistics of the data processed so far, from which the basic statistics can
+/// be computed without the data itself. The partial results computed on disjoint
+/// parts of the data can be merged with :expr:`merge_partial_results`.
+///
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::compute`.
+template <typename Task = task::by_default>
+class partial_compute_result : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the default property values.
+    partial_compute_result();
+
+    /// A $1 \\times 1$ table with the number of the processed observations.
+    /// @remark default = table{}
+    const table& get_partial_n_rows() const;
+
+    auto& set_partial_n_rows(const table& value) {
+        set_partial_n_rows_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times p$ table with the minimums of the features over the
+    /// processed observations.
+    /// @remark default = table{}
+    const table& get_partial_min() const;
+
+    auto& set_partial_min(const table& value) {
+        set_partial_min_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times p$ table with the maximums of the features over the
+    /// processed observations.
+    /// @remark default = table{}
+    const table& get_partial_max() const;
+
+    auto& set_partial_max(const table& value) {
+        set_partial_max_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times p$ table with the sums of the features over the
+    /// processed observations.
+    /// @remark default = table{}
+    const table& get_partial_sum() const;
+
+    auto& set_partial_sum(const table& value) {
+        set_partial_sum_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times p$ table with the sums of squares of the features over the
+    /// processed observations.
+    /// @remark default = table{}
+    const table& get_partial_sum_squares() const;
+
+    auto& set_partial_sum_squares(const table& value) {
+        set_partial_sum_squares_impl(value);
+        return *this;
+    }
+
+    /// A $1 \\times p$ table with the sums of squared differences of the features
+    /// from their means over the processed observations.
+    /// @remark default = table{}
+    const table& get_partial_sum_squares_centered() const;
+
+    auto& set_partial_sum_squares_centered(const table& value) {
+        set_partial_sum_squares_centered_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_partial_n_rows_impl(const table&);
+    void set_partial_min_impl(const table&);
+    void set_partial_max_impl(const table&);
+    void set_partial_sum_impl(const table&);
+    void set_partial_sum_squares_impl(const table&);
+    void set_partial_sum_squares_centered_impl(const table&);
+
+private:
+    dal::detail::pimpl<detail::partial_compute_result_impl<Task>> impl_;
+};
+
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::compute`.
+template <typename Task = task::by_default>
+class partial_compute_input : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the given :literal:`data`
+    /// property value and the empty partial result
+    partial_compute_input(const table& data);
+
+    /// Creates a new instance of the class with the given :literal:`prev` and
+    /// :literal:`data` property values
+    partial_compute_input(const partial_compute_result<Task>& prev, const table& data);
+
+    /// An $n \\times p$ table with the next block of the data, where each row
+    /// stores one feature vector.
+    /// @remark default = table{}
+    const table& get_data() const;
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+    /// The partial result computed on the previous blocks of the data. If it
+    /// is empty, the data is the first block.
+    /// @remark default = partial_compute_result<Task>{}
+    const partial_compute_result<Task>& get_prev() const;
+
+    auto& set_prev(const partial_compute_result<Task>& value) {
+        set_prev_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_data_impl(const table& value);
+    void set_prev_impl(const partial_compute_result<Task>& value);
+
+private:
+    dal::detail::pimpl<detail::partial_compute_input_impl<Task>> impl_;
+};
+
+/// Merges two partial results computed on disjoint blocks of the data, for
+/// example, by different threads or processes. The result is equal to the
+/// partial result computed on both blocks.
+template <typename Task>
+partial_compute_result<Task> merge_partial_results(const partial_compute_result<Task>& lhs,
+                                                   const partial_compute_result<Task>& rhs);
+
+} // namespace v1
+
+using v1::partial_compute_input;
+using v1::partial_compute_result;
+using v1::merge_partial_results;
+
+} // namespace oneapi::dal::basic_statistics
@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/basic_statistics/finalize_compute.hpp"
+#include "oneapi/dal/algo/basic_statistics/partial_compute.hpp"
+#include "oneapi/dal/algo/basic_statistics/test/fixture.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::basic_statistics::test {
+
+namespace te = dal::test::engine;
+namespace bs = oneapi::dal::basic_statistics;
+
+template <typename TestType>
+class basic_statistics_online_test
+        : public basic_statistics_test<TestType, basic_statistics_online_test<TestType>> {
+public:
+    using base_t = basic_statistics_test<TestType, basic_statistics_online_test<TestType>>;
+    using float_t = typename base_t::float_t;
+    using partial_result_t = bs::partial_compute_result<>;
+
+    void online_checks(const te::dataframe& data_fr,
+                       bs::result_option_id compute_mode,
+                       std::int64_t block_count) {
+        CAPTURE(compute_mode, block_count);
+        const table data = data_fr.get_table(this->get_policy(), this->get_homogen_table_id());
+        const auto bs_desc = this->get_descriptor(compute_mode);
+        const auto blocks =
+            te::split_table_by_rows<float_t>(this->get_policy(), data, block_count);
+
+        partial_result_t partial_result;
+        for (const auto& block : blocks) {
+            partial_result = dal::partial_compute(bs_desc, partial_result, block);
+        }
+
+        const auto compute_result = dal::finalize_compute(bs_desc, partial_result);
+        this->check_compute_result(compute_mode, data, compute_result);
+    }
+
+    void merge_checks(const te::dataframe& data_fr,
+                      bs::result_option_id compute_mode,
+                      std::int64_t block_count) {
+        CAPTURE(compute_mode, block_count);
+        const table data = data_fr.get_table(this->get_policy(), this->get_homogen_table_id());
+        const auto bs_desc = this->get_descriptor(compute_mode);
+        const auto blocks =
+            te::split_table_by_rows<float_t>(this->get_policy(), data, block_count);
+
+        partial_result_t merged;
+        for (const auto& block : blocks) {
+            merged = bs::merge_partial_results(merged, dal::partial_compute(bs_desc, block));
+        }
+
+        const auto compute_result = dal::finalize_compute(bs_desc, merged);
+        this->check_compute_result(compute_mode, data, compute_result);
+    }
+};
+
+TEMPLATE_LIST_TEST_M(basic_statistics_online_test,
+                     "basic_statistics online common flow",
+                     "[basic_statistics][integration][online]",
+                     basic_statistics_types) {
+    SKIP_IF(this->get_policy().is_gpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_normal(-30, 30, 7777),
+                           te::dataframe_builder{ 200, 20 }.fill_normal(-30, 30, 7777),
+                           te::dataframe_builder{ 6000, 20 }.fill_normal(-30, 30, 7777));
+
+    bs::result_option_id res_min_max = result_options::min | result_options::max;
+    bs::result_option_id res_mean_varc = result_options::mean | result_options::variance;
+    bs::result_option_id res_all = bs::result_option_id(dal::result_option_id_base(mask_full));
+
+    const bs::result_option_id compute_mode = GENERATE_COPY(res_min_max, res_mean_varc, res_all);
+    const std::int64_t block_count = GENERATE(1, 3, 16);
+
+    this->online_checks(data, compute_mode, block_count);
+}
+
+TEMPLATE_LIST_TEST_M(basic_statistics_online_test,
+                     "basic_statistics merge of partial results",
+                     "[basic_statistics][integration][online]",
+                     basic_statistics_types) {
+    SKIP_IF(this->get_policy().is_gpu());
+
+    const te::dataframe data =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_normal(-30, 30, 7777),
+                           te::dataframe_builder{ 6000, 20 }.fill_normal(-30, 30, 7777));
+
+    bs::result_option_id res_all = bs::result_option_id(dal::result_option_id_base(mask_full));
+    const std::int64_t block_count = GENERATE(2, 5);
+
+    this->merge_checks(data, res_all, block_count);
+}
+
+} // namespace oneapi::dal::basic_statistics::test
@@ -88,7 +88,7 @@ TEMPLATE_LIST_TEST_M(basic_statistics_spmd_test,
                      "basic_statistics common flow",
                      "[basic_statistics][integration][spmd]",
                      basic_statistics_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     const te::dataframe data =
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 
 #include "oneapi/dal/algo/connected_components/common.hpp"
@@ -63,57 +64,86 @@ void compress(const std::int32_t &u, std::atomic<std::int32_t> *components) {
     }
 }
 
+//Numbers the component trees in the increasing order of their roots. Every block of vertices
+//counts its roots, the block offsets are scanned, then every root gets its number and
+//every other vertex takes the number of its root
 template <typename Cpu>
 void order_component_ids(const std::int64_t &vertex_count,
                          std::int64_t &component_count,
-                         std::atomic<std::int32_t> *components,
-                         std::int32_t *labels) {
-    std::int32_t ordered_comp_id = 0;
-    std::int32_t root_u = 0;
-    for (std::int32_t u = 0; u < vertex_count; ++u) {
-        root_u = components[u].load();
-        if (root_u == u) {
-            labels[u] = ordered_comp_id;
-            component_count++;
-            ordered_comp_id++;
+                         const std::atomic<std::int32_t> *components,
+                         std::int32_t *labels,
+                         inner_alloc<std::int64_t> &offset_allocator) {
+    const std::int64_t block_size = 1 << 14;
+    const std::int64_t block_count = (vertex_count + block_size - 1) / block_size;
+    std::int64_t *block_offsets = allocate(offset_allocator, block_count + 1);
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * block_size;
+        const std::int64_t end = std::min(begin + block_size, vertex_count);
+        std::int64_t root_count = 0;
+        for (std::int64_t u = begin; u < end; ++u) {
+            root_count += components[u].load(std::memory_order_relaxed) == u;
         }
-        else {
+        block_offsets[block + 1] = root_count;
+    });
+
+    block_offsets[0] = 0;
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_offsets[block + 1] += block_offsets[block];
+    }
+    component_count = block_offsets[block_count];
+
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * block_size;
+        const std::int64_t end = std::min(begin + block_size, vertex_count);
+        std::int32_t ordered_comp_id = block_offsets[block];
+        for (std::int64_t u = begin; u < end; ++u) {
+            if (components[u].load(std::memory_order_relaxed) == u) {
+                labels[u] = ordered_comp_id++;
+            }
+        }
+    });
+    deallocate(offset_allocator, block_offsets, block_count + 1);
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+        const std::int32_t root_u = components[u].load(std::memory_order_relaxed);
+        if (root_u != u) {
             labels[u] = labels[root_u];
         }
-    }
+    });
 }
 
+//Returns the root of the largest component among the roots of the randomly sampled vertices
 template <typename Cpu>
 std::int32_t most_frequent_element(const std::atomic<std::int32_t> *components,
                                    const std::int64_t &vertex_count,
                                    inner_alloc<std::int32_t> &vertex_allocator,
                                    const std::int64_t &samples_count = 1024) {
-    std::int32_t *rnd_vertex_ids = allocate(vertex_allocator, samples_count);
+    std::int32_t *sample_roots = allocate(vertex_allocator, samples_count);
 
     dal::backend::primitives::engine eng;
     dal::backend::primitives::rng<std::int32_t> rn_gen;
-    rn_gen.uniform(samples_count, rnd_vertex_ids, eng.get_state(), 0, vertex_count);
+    rn_gen.uniform(samples_count, sample_roots, eng.get_state(), 0, vertex_count);
 
-    std::int32_t *root_sample_counts = allocate(vertex_allocator, vertex_count);
-
-    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
-        root_sample_counts[u] = 0;
+    dal::detail::threader_for(samples_count, samples_count, [&](std::int32_t i) {
+        sample_roots[i] = components[sample_roots[i]].load(std::memory_order_relaxed);
     });
+    dal::detail::parallel_sort(sample_roots, sample_roots + samples_count);
 
-    for (std::int32_t i = 0; i < samples_count; ++i) {
-        root_sample_counts[components[rnd_vertex_ids[i]]]++;
-    }
-    deallocate(vertex_allocator, rnd_vertex_ids, samples_count);
-
-    std::int32_t max_root_sample_count = 0;
+    std::int64_t max_root_sample_count = 0;
     std::int32_t most_frequent_root = 0;
-    for (std::int32_t u = 0; u < vertex_count; ++u) {
-        if (root_sample_counts[u] > max_root_sample_count) {
-            max_root_sample_count = root_sample_counts[u];
-            most_frequent_root = u;
+    for (std::int64_t i = 0; i < samples_count;) {
+        std::int64_t j = i + 1;
+        while (j < samples_count && sample_roots[j] == sample_roots[i]) {
+            ++j;
         }
+        if (j - i > max_root_sample_count) {
+            max_root_sample_count = j - i;
+            most_frequent_root = sample_roots[i];
+        }
+        i = j;
     }
-    deallocate(vertex_allocator, root_sample_counts, vertex_count);
+    deallocate(vertex_allocator, sample_roots, samples_count);
 
     return most_frequent_root;
 }
@@ -144,9 +174,9 @@ struct afforest {
             new (components + u) atomic_type(u);
         });
 
-        const std::int32_t neighbors_round = 2;
+        const std::int64_t neighbors_round = desc.get_neighbor_round_count();
 
-        for (std::int32_t i = 0; i < neighbors_round; ++i) {
+        for (std::int64_t i = 0; i < neighbors_round; ++i) {
             dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
                 if (i < t.get_vertex_degree(u)) {
                     link<Cpu>(u, t.get_vertex_neighbors_begin(u)[i], components);
@@ -159,7 +189,10 @@ struct afforest {
         }
 
         const std::int32_t sample_comp =
-            most_frequent_element<Cpu>(components, vertex_count, vertex_allocator);
+            most_frequent_element<Cpu>(components,
+                                       vertex_count,
+                                       vertex_allocator,
+                                       desc.get_sample_count());
 
         dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
             if (components[u] != sample_comp) {
@@ -180,8 +213,15 @@ struct afforest {
         auto labels_arr = array<std::int32_t>::empty(vertex_count);
         std::int32_t *labels = labels_arr.get_mutable_data();
 
+        using offset_allocator_type = inner_alloc<std::int64_t>;
+        offset_allocator_type offset_allocator(alloc_ptr);
+
         std::int64_t component_count = 0;
-        order_component_ids<Cpu>(vertex_count, component_count, components, labels);
+        order_component_ids<Cpu>(vertex_count,
+                                 component_count,
+                                 components,
+                                 labels,
+                                 offset_allocator);
 
         return vertex_partitioning_result<task::vertex_partitioning>()
             .set_labels(homogen_table::wrap(labels_arr, vertex_count, 1))
@@ -27,11 +27,34 @@ public:
             static_assert("Unsupported task");
         }
     }
+
+    std::int64_t neighbor_round_count = 2;
+    std::int64_t sample_count = 1024;
 };
 
 template <typename Task>
 descriptor_base<Task>::descriptor_base() : impl_(new descriptor_impl<Task>{}) {}
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_neighbor_round_count() const {
+    return impl_->neighbor_round_count;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_sample_count() const {
+    return impl_->sample_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_neighbor_round_count(std::int64_t neighbor_round_count) {
+    impl_->neighbor_round_count = neighbor_round_count;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_sample_count(std::int64_t sample_count) {
+    impl_->sample_count = sample_count;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::vertex_partitioning>;
 
 } // namespace oneapi::dal::preview::connected_components::detail
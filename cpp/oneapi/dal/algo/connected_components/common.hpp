@@ -66,7 +66,13 @@ public:
 
     descriptor_base();
 
+    std::int64_t get_neighbor_round_count() const;
+    std::int64_t get_sample_count() const;
+
 protected:
+    void set_neighbor_round_count(std::int64_t value);
+    void set_sample_count(std::int64_t value);
+
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
 };
 
@@ -100,6 +106,45 @@ public:
         alloc_ = allocator;
     }
 
+    /// Returns the number of the neighbor sampling rounds. On each round, every
+    /// vertex is linked with one more of its neighbors before the largest
+    /// intermediate component is estimated
+    ///
+    /// @remark default = 2
+    std::int64_t get_neighbor_round_count() const {
+        return base_t::get_neighbor_round_count();
+    }
+
+    /// Sets the number of the neighbor sampling rounds
+    ///
+    /// @param [in] neighbor_round_count  Number of the neighbor sampling rounds
+    /// @invariant :expr:`neighbor_round_count >= 0`
+    /// @remark default = 2
+    auto& set_neighbor_round_count(std::int64_t neighbor_round_count) {
+        base_t::set_neighbor_round_count(neighbor_round_count);
+        return *this;
+    }
+
+    /// Returns the number of the randomly sampled vertices used to estimate the
+    /// largest intermediate component. The remaining edges of the vertices from
+    /// this component are skipped
+    ///
+    /// @remark default = 1024
+    std::int64_t get_sample_count() const {
+        return base_t::get_sample_count();
+    }
+
+    /// Sets the number of the randomly sampled vertices used to estimate the
+    /// largest intermediate component
+    ///
+    /// @param [in] sample_count  Number of the sampled vertices
+    /// @invariant :expr:`sample_count > 0`
+    /// @remark default = 1024
+    auto& set_sample_count(std::int64_t sample_count) {
+        base_t::set_sample_count(sample_count);
+        return *this;
+    }
+
     /// Returns a copy of the allocator used in the algorithm for internal memory management.
     Allocator get_allocator() const {
         return alloc_;
@@ -27,7 +27,7 @@ operator()(const dal::detail::host_policy& policy,
            const detail::descriptor_base<task::vertex_partitioning>& desc,
            const dal::preview::detail::topology<std::int32_t>& t,
            byte_alloc_iface* alloc_ptr) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::afforest<decltype(cpu)>{}(desc, t, alloc_ptr);
     });
 }
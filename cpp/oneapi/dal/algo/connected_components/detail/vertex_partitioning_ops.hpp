@@ -48,8 +48,22 @@ struct vertex_partitioning_ops {
     using result_t = vertex_partitioning_result<task_t>;
     using descriptor_base_t = descriptor_base<task_t>;
 
+    void check_preconditions(const Descriptor &desc) const {
+        using msg = dal::detail::error_messages;
+        if (desc.get_neighbor_round_count() < 0) {
+            throw invalid_argument(msg::neighbor_round_count_lt_zero());
+        }
+        if (desc.get_sample_count() <= 0) {
+            throw invalid_argument(msg::sample_count_leq_zero());
+        }
+        if (desc.get_sample_count() > dal::detail::limits<std::int32_t>::max()) {
+            throw invalid_argument(msg::sample_count_gt_max_int32());
+        }
+    }
+
     template <typename Policy>
     auto operator()(const Policy &policy, const Descriptor &desc, input_t &input) const {
+        check_preconditions(desc);
         return vertex_partitioning_ops_dispatcher<Policy, Descriptor, Graph>()(policy, desc, input);
     }
 };
@@ -412,16 +412,21 @@ public:
         REQUIRE(corrently_labeled);
     }
 
-    void check_connected_components(const graph_base_data& graph_data) {
+    void check_connected_components(const graph_base_data& graph_data,
+                                    std::int64_t neighbor_round_count = 2,
+                                    std::int64_t sample_count = 1024) {
         const graph_type graph = create_graph(graph_data);
         allocated_bytes_count = 0;
         {
             CountingAllocator<char> alloc;
-            const auto desc = dal::preview::connected_components::descriptor<
-                float,
-                oneapi::dal::preview::connected_components::method::afforest,
-                oneapi::dal::preview::connected_components::task::vertex_partitioning,
-                CountingAllocator<char>>(alloc);
+            const auto desc =
+                dal::preview::connected_components::descriptor<
+                    float,
+                    oneapi::dal::preview::connected_components::method::afforest,
+                    oneapi::dal::preview::connected_components::task::vertex_partitioning,
+                    CountingAllocator<char>>(alloc)
+                    .set_neighbor_round_count(neighbor_round_count)
+                    .set_sample_count(sample_count);
             const auto result = dal::preview::vertex_partitioning(desc, graph);
 
             REQUIRE(graph_data.components_count == result.get_component_count());
@@ -508,4 +513,55 @@ CONNECTED_COMPONENTS_TEST(
     this->check_connected_components(graph_data);
 }
 
+CONNECTED_COMPONENTS_TEST("Check correctness for different neighbor round counts") {
+    combined_graph_data graph_data;
+    graph_data.add_graph(lolipop_graph_data(1000, 500));
+    graph_data.add_graph(grid_graph_data(10, 15));
+    for (std::int32_t i = 0; i < 100; ++i) {
+        graph_data.add_graph(reindexed_binary_tree_graph_data(4));
+    }
+    graph_data.add_graph(single_vertices_data(100));
+    for (std::int64_t neighbor_round_count : { 0, 1, 3, 16 }) {
+        this->check_connected_components(graph_data, neighbor_round_count);
+    }
+}
+
+CONNECTED_COMPONENTS_TEST("Check correctness for different sample counts") {
+    combined_graph_data graph_data;
+    graph_data.add_graph(star_graph_data(100));
+    for (std::int32_t i = 0; i < 300; ++i) {
+        graph_data.add_graph(complete_graph_data(3));
+    }
+    graph_data.add_graph(single_vertices_data(100));
+    for (std::int64_t sample_count : { 1, 7, 100000 }) {
+        this->check_connected_components(graph_data, 2, sample_count);
+    }
+}
+
+CONNECTED_COMPONENTS_TEST(
+    "Check correctness of the parallel order_component_ids: Line-1025 + 50000 Single vertices") {
+    combined_graph_data graph_data;
+    graph_data.add_graph(single_vertices_data(20000));
+    graph_data.add_graph(line_graph_data(1025));
+    graph_data.add_graph(single_vertices_data(30000));
+    this->check_connected_components(graph_data);
+}
+
+CONNECTED_COMPONENTS_TEST("Throws if neighbor round count is negative") {
+    line_graph_data graph_data(17);
+    REQUIRE_THROWS_AS(this->check_connected_components(graph_data, -1), invalid_argument);
+}
+
+CONNECTED_COMPONENTS_TEST("Throws if sample count is not positive") {
+    line_graph_data graph_data(17);
+    REQUIRE_THROWS_AS(this->check_connected_components(graph_data, 2, 0), invalid_argument);
+}
+
+CONNECTED_COMPONENTS_TEST("Throws if sample count is greater than max int32 value") {
+    line_graph_data graph_data(17);
+    const std::int64_t sample_count = std::int64_t(dal::detail::limits<std::int32_t>::max()) + 1;
+    REQUIRE_THROWS_AS(this->check_connected_components(graph_data, 2, sample_count),
+                      invalid_argument);
+}
+
 } // namespace oneapi::dal::algo::connected_components::test
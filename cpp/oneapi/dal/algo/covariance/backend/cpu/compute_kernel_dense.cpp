@@ -17,9 +17,12 @@
 #include "daal/src/algorithms/covariance/covariance_kernel.h"
 
 #include "oneapi/dal/algo/covariance/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/finalize_compute_kernel.hpp"
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_compute_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
 
 #include "oneapi/dal/table/row_accessor.hpp"
 
@@ -27,6 +30,7 @@ namespace oneapi::dal::covariance::backend {
 
 using dal::backend::context_cpu;
 using descriptor_t = detail::descriptor_base<task::compute>;
+using comm_t = dal::backend::communicator<spmd::device_memory_access::none>;
 
 namespace daal_covariance = daal::algorithms::covariance;
 namespace interop = dal::backend::interop;
@@ -106,10 +110,78 @@ static compute_result<Task> call_daal_kernel(const context_cpu& ctx,
     return result;
 }
 
+template <typename Float>
+static array<Float> pull_mutable(const table& t) {
+    const auto arr = row_accessor<const Float>{ t }.pull();
+    auto copy = array<Float>::empty(arr.get_count());
+    dal::backend::copy(copy.get_mutable_data(), arr.get_data(), arr.get_count());
+    return copy;
+}
+
+/// Sums up the partial results computed on the local data of all the ranks.
+/// The local cross-products are centered by the local means, so they are shifted
+/// to the global mean before the summation.
+template <typename Float, typename Task>
+static partial_compute_result<Task> allreduce_partial_results(
+    const comm_t& comm,
+    const partial_compute_result<Task>& local) {
+    const std::int64_t column_count = local.get_partial_sum().get_column_count();
+
+    auto arr_n_rows = pull_mutable<Float>(local.get_partial_n_rows());
+    auto arr_sum = pull_mutable<Float>(local.get_partial_sum());
+    auto arr_crossproduct = pull_mutable<Float>(local.get_partial_crossproduct());
+
+    const Float local_n_rows = arr_n_rows[0];
+    const auto local_sum = row_accessor<const Float>{ local.get_partial_sum() }.pull();
+
+    comm.allreduce(arr_n_rows).wait();
+    comm.allreduce(arr_sum).wait();
+
+    const Float n_rows = arr_n_rows[0];
+    auto arr_shift = array<Float>::zeros(column_count);
+    Float* shift = arr_shift.get_mutable_data();
+    if (local_n_rows > Float(0)) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            shift[j] = local_sum[j] / local_n_rows - arr_sum[j] / n_rows;
+        }
+    }
+
+    Float* crossproduct = arr_crossproduct.get_mutable_data();
+    for (std::int64_t i = 0; i < column_count; ++i) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            crossproduct[i * column_count + j] += local_n_rows * shift[i] * shift[j];
+        }
+    }
+    comm.allreduce(arr_crossproduct).wait();
+
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(arr_n_rows, 1, 1))
+        .set_partial_crossproduct(
+            homogen_table::wrap(arr_crossproduct, column_count, column_count))
+        .set_partial_sum(homogen_table::wrap(arr_sum, 1, column_count));
+}
+
+template <typename Float, typename Task>
+static compute_result<Task> call_daal_spmd_kernel(const context_cpu& ctx,
+                                                  const descriptor_t& desc,
+                                                  const table& data) {
+    using method_t = method::dense;
+
+    const auto local = partial_compute_kernel_cpu<Float, method_t, Task>{}(
+        ctx,
+        desc,
+        partial_compute_input<Task>{ data });
+    const auto global = allreduce_partial_results<Float>(ctx.get_communicator(), local);
+    return finalize_compute_kernel_cpu<Float, method_t, Task>{}(ctx, desc, global);
+}
+
 template <typename Float, typename Task>
 static compute_result<Task> compute(const context_cpu& ctx,
                                     const descriptor_t& desc,
                                     const compute_input<Task>& input) {
+    if (ctx.get_communicator().is_distributed()) {
+        return call_daal_spmd_kernel<Float, Task>(ctx, desc, input.get_data());
+    }
     return call_daal_kernel<Float, Task>(ctx, desc, input.get_data());
 }
 
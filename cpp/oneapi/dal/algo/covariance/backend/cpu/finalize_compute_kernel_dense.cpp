@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "daal/src/algorithms/covariance/covariance_kernel.h"
+
+#include "oneapi/dal/algo/covariance/backend/cpu/finalize_compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::compute>;
+
+namespace daal_covariance = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_covariance_kernel_t = daal_covariance::internal::
+    CovarianceDenseOnlineKernel<Float, daal_covariance::Method::defaultDense, Cpu>;
+
+template <typename Float, typename Task>
+static compute_result<Task> call_daal_kernel_finalize(const context_cpu& ctx,
+                                                      const descriptor_t& desc,
+                                                      const partial_compute_result<Task>& input) {
+    const std::int64_t component_count = input.get_partial_sum().get_column_count();
+    dal::detail::check_mul_overflow(component_count, component_count);
+
+    daal_covariance::Parameter daal_parameter;
+
+    const auto daal_n_rows = interop::convert_to_daal_table<Float>(input.get_partial_n_rows());
+    const auto daal_crossproduct =
+        interop::convert_to_daal_table<Float>(input.get_partial_crossproduct());
+    const auto daal_sum = interop::convert_to_daal_table<Float>(input.get_partial_sum());
+
+    auto arr_means = array<Float>::empty(component_count);
+    const auto daal_means = interop::convert_to_daal_homogen_table(arr_means, 1, component_count);
+
+    auto result = compute_result<Task>{}.set_result_options(desc.get_result_options());
+
+    const auto finalize = [&](daal_covariance::OutputMatrixType matrix_type) {
+        auto arr_matrix = array<Float>::empty(component_count * component_count);
+        const auto daal_matrix =
+            interop::convert_to_daal_homogen_table(arr_matrix, component_count, component_count);
+
+        daal_parameter.outputMatrixType = matrix_type;
+        interop::status_to_exception(
+            interop::call_daal_kernel_finalize_compute<Float, daal_covariance_kernel_t>(
+                ctx,
+                daal_n_rows.get(),
+                daal_crossproduct.get(),
+                daal_sum.get(),
+                daal_matrix.get(),
+                daal_means.get(),
+                &daal_parameter));
+        return homogen_table::wrap(arr_matrix, component_count, component_count);
+    };
+
+    bool is_mean_computed = false;
+    if (desc.get_result_options().test(result_options::cov_matrix)) {
+        result.set_cov_matrix(finalize(daal_covariance::covarianceMatrix));
+        is_mean_computed = true;
+    }
+    if (desc.get_result_options().test(result_options::cor_matrix)) {
+        result.set_cor_matrix(finalize(daal_covariance::correlationMatrix));
+        is_mean_computed = true;
+    }
+    if (desc.get_result_options().test(result_options::means)) {
+        if (!is_mean_computed) {
+            finalize(daal_covariance::covarianceMatrix);
+        }
+        result.set_means(homogen_table::wrap(arr_means, 1, component_count));
+    }
+    return result;
+}
+
+template <typename Float, typename Task>
+static compute_result<Task> finalize_compute(const context_cpu& ctx,
+                                             const descriptor_t& desc,
+                                             const partial_compute_result<Task>& input) {
+    return call_daal_kernel_finalize<Float, Task>(ctx, desc, input);
+}
+
+template <typename Float>
+struct finalize_compute_kernel_cpu<Float, method::by_default, task::compute> {
+    compute_result<task::compute> operator()(
+        const context_cpu& ctx,
+        const descriptor_t& desc,
+        const partial_compute_result<task::compute>& input) const {
+        return finalize_compute<Float, task::compute>(ctx, desc, input);
+    }
+};
+
+template struct finalize_compute_kernel_cpu<float, method::dense, task::compute>;
+template struct finalize_compute_kernel_cpu<double, method::dense, task::compute>;
+
+} // namespace oneapi::dal::covariance::backend
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "daal/src/algorithms/covariance/covariance_kernel.h"
+
+#include "oneapi/dal/algo/covariance/backend/cpu/partial_compute_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::covariance::backend {
+
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::compute>;
+
+namespace daal_covariance = daal::algorithms::covariance;
+namespace interop = dal::backend::interop;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_covariance_kernel_t = daal_covariance::internal::
+    CovarianceDenseOnlineKernel<Float, daal_covariance::Method::defaultDense, Cpu>;
+
+/// Returns a mutable copy of the partial statistic, or zeros if there is none,
+/// as the online kernel accumulates the new block in place
+template <typename Float>
+static array<Float> copy_or_zeros(const table& partial, std::int64_t count) {
+    if (!partial.has_data()) {
+        return array<Float>::zeros(count);
+    }
+    auto arr = array<Float>::empty(count);
+    const auto prev = row_accessor<const Float>{ partial }.pull();
+    ONEDAL_ASSERT(prev.get_count() == count);
+    dal::backend::copy(arr.get_mutable_data(), prev.get_data(), count);
+    return arr;
+}
+
+template <typename Float, typename Task>
+static partial_compute_result<Task> call_daal_kernel(const context_cpu& ctx,
+                                                     const descriptor_t& desc,
+                                                     const partial_compute_result<Task>& prev,
+                                                     const table& data) {
+    const std::int64_t component_count = data.get_column_count();
+    dal::detail::check_mul_overflow(component_count, component_count);
+
+    daal_covariance::Parameter daal_parameter;
+    daal_parameter.outputMatrixType = daal_covariance::covarianceMatrix;
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+
+    auto arr_n_rows = copy_or_zeros<Float>(prev.get_partial_n_rows(), 1);
+    auto arr_crossproduct = copy_or_zeros<Float>(prev.get_partial_crossproduct(),
+                                                 component_count * component_count);
+    auto arr_sum = copy_or_zeros<Float>(prev.get_partial_sum(), component_count);
+
+    const auto daal_n_rows = interop::convert_to_daal_homogen_table(arr_n_rows, 1, 1);
+    const auto daal_crossproduct = interop::convert_to_daal_homogen_table(arr_crossproduct,
+                                                                          component_count,
+                                                                          component_count);
+    const auto daal_sum = interop::convert_to_daal_homogen_table(arr_sum, 1, component_count);
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_covariance_kernel_t>(ctx,
+                                                                   daal_data.get(),
+                                                                   daal_n_rows.get(),
+                                                                   daal_crossproduct.get(),
+                                                                   daal_sum.get(),
+                                                                   &daal_parameter));
+
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(arr_n_rows, 1, 1))
+        .set_partial_crossproduct(
+            homogen_table::wrap(arr_crossproduct, component_count, component_count))
+        .set_partial_sum(homogen_table::wrap(arr_sum, 1, component_count));
+}
+
+template <typename Float, typename Task>
+static partial_compute_result<Task> partial_compute(const context_cpu& ctx,
+                                                    const descriptor_t& desc,
+                                                    const partial_compute_input<Task>& input) {
+    return call_daal_kernel<Float, Task>(ctx, desc, input.get_prev(), input.get_data());
+}
+
+template <typename Float>
+struct partial_compute_kernel_cpu<Float, method::by_default, task::compute> {
+    partial_compute_result<task::compute> operator()(
+        const context_cpu& ctx,
+        const descriptor_t& desc,
+        const partial_compute_input<task::compute>& input) const {
+        return partial_compute<Float, task::compute>(ctx, desc, input);
+    }
+};
+
+template struct partial_compute_kernel_cpu<float, method::dense, task::compute>;
+template struct partial_compute_kernel_cpu<double, method::dense, task::compute>;
+
+} // namespace oneapi::dal::covariance::backend
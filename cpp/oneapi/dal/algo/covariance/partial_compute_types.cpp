@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/partial_compute_types.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::covariance {
+
+template <typename Task>
+class detail::v1::partial_compute_input_impl : public base {
+public:
+    partial_compute_input_impl(const partial_compute_result<Task>& prev, const table& data)
+            : prev(prev),
+              data(data) {}
+
+    partial_compute_result<Task> prev;
+    table data;
+};
+
+template <typename Task>
+class detail::v1::partial_compute_result_impl : public base {
+public:
+    table partial_n_rows;
+    table partial_crossproduct;
+    table partial_sum;
+};
+
+using detail::v1::partial_compute_input_impl;
+using detail::v1::partial_compute_result_impl;
+
+namespace v1 {
+
+template <typename Task>
+partial_compute_result<Task>::partial_compute_result()
+        : impl_(new partial_compute_result_impl<Task>{}) {}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_n_rows() const {
+    return impl_->partial_n_rows;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_n_rows_impl(const table& value) {
+    impl_->partial_n_rows = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_crossproduct() const {
+    return impl_->partial_crossproduct;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_crossproduct_impl(const table& value) {
+    impl_->partial_crossproduct = value;
+}
+
+template <typename Task>
+const table& partial_compute_result<Task>::get_partial_sum() const {
+    return impl_->partial_sum;
+}
+
+template <typename Task>
+void partial_compute_result<Task>::set_partial_sum_impl(const table& value) {
+    impl_->partial_sum = value;
+}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(const table& data)
+        : impl_(new partial_compute_input_impl<Task>(partial_compute_result<Task>{}, data)) {}
+
+template <typename Task>
+partial_compute_input<Task>::partial_compute_input(const partial_compute_result<Task>& prev,
+                                                   const table& data)
+        : impl_(new partial_compute_input_impl<Task>(prev, data)) {}
+
+template <typename Task>
+const table& partial_compute_input<Task>::get_data() const {
+    return impl_->data;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+template <typename Task>
+const partial_compute_result<Task>& partial_compute_input<Task>::get_prev() const {
+    return impl_->prev;
+}
+
+template <typename Task>
+void partial_compute_input<Task>::set_prev_impl(const partial_compute_result<Task>& value) {
+    impl_->prev = value;
+}
+
+template <typename Float, typename Task>
+static partial_compute_result<Task> merge_partial_results_impl(
+    const partial_compute_result<Task>& lhs,
+    const partial_compute_result<Task>& rhs) {
+    const std::int64_t column_count = lhs.get_partial_sum().get_column_count();
+
+    const auto lhs_n_rows = row_accessor<const Float>{ lhs.get_partial_n_rows() }.pull();
+    const auto rhs_n_rows = row_accessor<const Float>{ rhs.get_partial_n_rows() }.pull();
+    const auto lhs_sum = row_accessor<const Float>{ lhs.get_partial_sum() }.pull();
+    const auto rhs_sum = row_accessor<const Float>{ rhs.get_partial_sum() }.pull();
+    const auto lhs_cp = row_accessor<const Float>{ lhs.get_partial_crossproduct() }.pull();
+    const auto rhs_cp = row_accessor<const Float>{ rhs.get_partial_crossproduct() }.pull();
+
+    const Float n1 = lhs_n_rows[0];
+    const Float n2 = rhs_n_rows[0];
+    const Float n = n1 + n2;
+
+    auto n_rows = array<Float>::full(1, n);
+    auto sum = array<Float>::empty(column_count);
+    auto cp = array<Float>::empty(column_count * column_count);
+
+    Float* sum_ptr = sum.get_mutable_data();
+    Float* cp_ptr = cp.get_mutable_data();
+
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        sum_ptr[j] = lhs_sum[j] + rhs_sum[j];
+    }
+
+    // Cross-products are centered by the means of their own blocks, so the merged
+    // one is corrected by the difference of those means and the common mean
+    const Float inv_n1 = (n1 > Float(0)) ? Float(1) / n1 : Float(0);
+    const Float inv_n2 = (n2 > Float(0)) ? Float(1) / n2 : Float(0);
+    const Float inv_n = (n > Float(0)) ? Float(1) / n : Float(0);
+    for (std::int64_t i = 0; i < column_count; ++i) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            const std::int64_t k = i * column_count + j;
+            cp_ptr[k] = lhs_cp[k] + rhs_cp[k] + lhs_sum[i] * lhs_sum[j] * inv_n1 +
+                        rhs_sum[i] * rhs_sum[j] * inv_n2 - sum_ptr[i] * sum_ptr[j] * inv_n;
+        }
+    }
+
+    return partial_compute_result<Task>{}
+        .set_partial_n_rows(homogen_table::wrap(n_rows, 1, 1))
+        .set_partial_sum(homogen_table::wrap(sum, 1, column_count))
+        .set_partial_crossproduct(homogen_table::wrap(cp, column_count, column_count));
+}
+
+template <typename Task>
+partial_compute_result<Task> merge_partial_results(const partial_compute_result<Task>& lhs,
+                                                   const partial_compute_result<Task>& rhs) {
+    if (!rhs.get_partial_n_rows().has_data()) {
+        return lhs;
+    }
+    if (!lhs.get_partial_n_rows().has_data()) {
+        return rhs;
+    }
+    if (lhs.get_partial_sum().get_column_count() != rhs.get_partial_sum().get_column_count()) {
+        throw invalid_argument(dal::detail::error_messages::incompatible_partial_results());
+    }
+
+    const auto& meta = lhs.get_partial_crossproduct().get_metadata();
+    if (meta.get_data_type(0) == data_type::float32) {
+        return merge_partial_results_impl<float>(lhs, rhs);
+    }
+    return merge_partial_results_impl<double>(lhs, rhs);
+}
+
+template class ONEDAL_EXPORT partial_compute_input<task::compute>;
+template class ONEDAL_EXPORT partial_compute_result<task::compute>;
+
+template ONEDAL_EXPORT partial_compute_result<task::compute> merge_partial_results(
+    const partial_compute_result<task::compute>&,
+    const partial_compute_result<task::compute>&);
+
+} // namespace v1
+} // namespace oneapi::dal::covariance
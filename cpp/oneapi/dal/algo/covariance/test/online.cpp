@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/covariance/finalize_compute.hpp"
+#include "oneapi/dal/algo/covariance/partial_compute.hpp"
+#include "oneapi/dal/algo/covariance/test/fixture.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
+
+namespace oneapi::dal::covariance::test {
+
+namespace te = dal::test::engine;
+namespace cov = oneapi::dal::covariance;
+
+template <typename TestType>
+class covariance_online_test : public covariance_test<TestType, covariance_online_test<TestType>> {
+public:
+    using base_t = covariance_test<TestType, covariance_online_test<TestType>>;
+    using Float = typename base_t::Float;
+    using Method = typename base_t::Method;
+    using partial_result_t = cov::partial_compute_result<>;
+
+    std::vector<partial_result_t> compute_partial_results(const table& data,
+                                                          std::int64_t block_count) {
+        const auto desc = this->get_descriptor(cov::result_options::cov_matrix);
+        const auto blocks = te::split_table_by_rows<Float>(this->get_policy(), data, block_count);
+
+        std::vector<partial_result_t> partial_results;
+        for (const auto& block : blocks) {
+            partial_results.push_back(dal::partial_compute(desc, block));
+        }
+        return partial_results;
+    }
+
+    void online_checks(const te::dataframe& input, std::int64_t block_count) {
+        const table data = input.get_table(this->get_policy(), this->get_homogen_table_id());
+        const auto desc = this->get_descriptor(cov::result_options::cov_matrix |
+                                               cov::result_options::cor_matrix |
+                                               cov::result_options::means);
+        const auto blocks = te::split_table_by_rows<Float>(this->get_policy(), data, block_count);
+
+        INFO("run partial compute block by block");
+        partial_result_t partial_result;
+        for (const auto& block : blocks) {
+            partial_result = dal::partial_compute(desc, partial_result, block);
+        }
+        REQUIRE(partial_result.get_partial_crossproduct().get_row_count() ==
+                data.get_column_count());
+
+        INFO("run finalize compute");
+        const auto result = dal::finalize_compute(desc, partial_result);
+        this->check_compute_result(data, result);
+    }
+
+    void merge_checks(const te::dataframe& input, std::int64_t block_count) {
+        const table data = input.get_table(this->get_policy(), this->get_homogen_table_id());
+        const auto desc = this->get_descriptor(cov::result_options::cov_matrix |
+                                               cov::result_options::means);
+
+        INFO("merge partial results computed on separate blocks");
+        partial_result_t merged;
+        for (const auto& partial_result : compute_partial_results(data, block_count)) {
+            merged = cov::merge_partial_results(merged, partial_result);
+        }
+
+        INFO("run finalize compute");
+        const auto result = dal::finalize_compute(desc, merged);
+        this->check_compute_result(data, result);
+    }
+};
+
+TEMPLATE_LIST_TEST_M(covariance_online_test,
+                     "covariance online fill_uniform common flow",
+                     "[covariance][integration][online]",
+                     covariance_types) {
+    SKIP_IF(this->get_policy().is_gpu());
+
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_uniform(-10, 10, 7777),
+                           te::dataframe_builder{ 1000, 20 }.fill_uniform(-30, 30, 7777),
+                           te::dataframe_builder{ 500, 40 }.fill_uniform(-100, 100, 7777));
+    const std::int64_t block_count = GENERATE(1, 3, 16);
+
+    this->online_checks(input, block_count);
+}
+
+TEMPLATE_LIST_TEST_M(covariance_online_test,
+                     "covariance merge of partial results",
+                     "[covariance][integration][online]",
+                     covariance_types) {
+    SKIP_IF(this->get_policy().is_gpu());
+
+    const te::dataframe input =
+        GENERATE_DATAFRAME(te::dataframe_builder{ 100, 10 }.fill_uniform(-10, 10, 7777),
+                           te::dataframe_builder{ 1000, 20 }.fill_uniform(-30, 30, 7777));
+    const std::int64_t block_count = GENERATE(2, 5);
+
+    this->merge_checks(input, block_count);
+}
+
+} // namespace oneapi::dal::covariance::test
@@ -86,7 +86,7 @@ TEMPLATE_LIST_TEST_M(covariance_spmd_test,
                      "covariance common flow",
                      "[covariance][integration][spmd]",
                      covariance_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     const te::dataframe data =
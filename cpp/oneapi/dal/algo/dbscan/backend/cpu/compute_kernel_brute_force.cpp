@@ -43,6 +43,10 @@ public:
     auto compute(Args&&... args) {
         const daal_dbscan::Parameter* par =
             std::get<sizeof...(Args) - 1>(std::forward_as_tuple(args...));
+        if (par->memoryLimit > 0) {
+            return daal_dbscan::internal::DBSCANBatchKernel<Float, daal_dbscan::defaultDense, Cpu>{}
+                .computeMemLimit(std::forward<Args>(args)...);
+        }
         if (par->memorySavingMode == false) {
             return daal_dbscan::internal::DBSCANBatchKernel<Float, daal_dbscan::defaultDense, Cpu>{}
                 .computeNoMemSave(std::forward<Args>(args)...);
@@ -65,6 +69,7 @@ static result_t call_daal_kernel(const context_cpu& ctx,
 
     daal_dbscan::Parameter par(epsilon, dal::detail::integral_cast<std::size_t>(min_observations));
     par.memorySavingMode = desc.get_mem_save_mode();
+    par.memoryLimit = dal::detail::integral_cast<std::size_t>(desc.get_memory_limit());
     if (desc.get_result_options().test(result_options::core_observation_indices)) {
         par.resultsToCompute = daal_dbscan::computeCoreIndices;
     }
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <limits>
+#include <memory>
+
+#include "oneapi/dal/algo/dbscan/backend/cpu/compute_kernel.hpp"
+#include "oneapi/dal/algo/dbscan/backend/cpu/kd_tree.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::dbscan::backend {
+
+using dal::backend::context_cpu;
+
+using descriptor_t = detail::descriptor_base<task::clustering>;
+using result_t = compute_result<task::clustering>;
+using input_t = compute_input<task::clustering>;
+
+using atomic_index_t = std::atomic<std::int32_t>;
+
+constexpr std::int32_t noise = -1;
+constexpr std::int64_t row_block_size = 256;
+
+//Given two core observations, ensures that they are within the same cluster tree
+inline void link(std::int32_t u, std::int32_t v, atomic_index_t* parents) {
+    std::int32_t p1 = parents[u];
+    std::int32_t p2 = parents[v];
+    while (p1 != p2) {
+        std::int32_t high = std::max(p1, p2);
+        const std::int32_t low = std::min(p1, p2);
+        if (parents[high].compare_exchange_strong(high, low)) {
+            break;
+        }
+        p1 = parents[parents[high]];
+        p2 = parents[low];
+    }
+}
+
+//Reduces cluster trees to single-level depth
+inline void compress(std::int32_t u, atomic_index_t* parents) {
+    while (parents[parents[u]] != parents[u]) {
+        parents[u].store(parents[parents[u]]);
+    }
+}
+
+template <typename Block>
+inline void for_each_row_block(std::int64_t row_count, Block&& block) {
+    const std::int64_t block_count = (row_count + row_block_size - 1) / row_block_size;
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block_index) {
+        const std::int64_t begin = block_index * row_block_size;
+        const std::int64_t end = std::min(begin + row_block_size, row_count);
+        block(begin, end);
+    });
+}
+
+template <typename Float>
+static result_t compute(const context_cpu& ctx, const descriptor_t& desc, const input_t& input) {
+    const table& data = input.get_data();
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+    if (row_count > std::numeric_limits<std::int32_t>::max()) {
+        throw domain_error(dal::detail::error_messages::row_count_gt_max_int32());
+    }
+
+    const Float radius_sq = Float(desc.get_epsilon() * desc.get_epsilon());
+    const Float min_observations = Float(desc.get_min_observations());
+
+    const auto arr_data = row_accessor<const Float>(data).pull();
+    array<Float> arr_weights;
+    if (input.get_weights().has_data()) {
+        arr_weights = row_accessor<const Float>(input.get_weights()).pull();
+    }
+    const Float* weights = arr_weights.get_count() > 0 ? arr_weights.get_data() : nullptr;
+
+    const kd_tree<Float> tree(arr_data.get_data(), row_count, column_count);
+
+    // An observation is a core one if the total weight of its neighborhood
+    // reaches the threshold, so the search stops as soon as it does
+    auto arr_core_flags = array<std::int32_t>::empty(row_count);
+    std::int32_t* core_flags = arr_core_flags.get_mutable_data();
+    for_each_row_block(row_count, [&](std::int64_t begin, std::int64_t end) {
+        for (std::int64_t position = begin; position < end; ++position) {
+            Float neighborhood_weight = 0;
+            tree.for_each_in_radius(tree.get_row(position), radius_sq, [&](std::int32_t j) {
+                neighborhood_weight += weights ? weights[j] : Float(1);
+                return neighborhood_weight < min_observations;
+            });
+            core_flags[tree.get_index(position)] = neighborhood_weight >= min_observations;
+        }
+    });
+
+    // Core observations within epsilon of each other belong to the same
+    // cluster. The root of every cluster tree is its core observation with
+    // the minimal index
+    std::unique_ptr<atomic_index_t[]> parents(new atomic_index_t[row_count]);
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        parents[i].store(i, std::memory_order_relaxed);
+    });
+    for_each_row_block(row_count, [&](std::int64_t begin, std::int64_t end) {
+        for (std::int64_t position = begin; position < end; ++position) {
+            const std::int32_t i = tree.get_index(position);
+            if (!core_flags[i]) {
+                continue;
+            }
+            tree.for_each_in_radius(tree.get_row(position), radius_sq, [&](std::int32_t j) {
+                if (j < i && core_flags[j]) {
+                    link(i, j, parents.get());
+                }
+                return true;
+            });
+        }
+    });
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        compress(i, parents.get());
+    });
+
+    // Clusters are numbered in the order of their roots, as in the brute force
+    // method that starts a new cluster from the first unassigned core observation
+    const std::int64_t block_count = (row_count + row_block_size - 1) / row_block_size;
+    auto arr_block_offsets = array<std::int64_t>::zeros(block_count + 1);
+    std::int64_t* block_offsets = arr_block_offsets.get_mutable_data();
+    auto arr_core_counts = array<std::int64_t>::zeros(block_count + 1);
+    std::int64_t* core_counts = arr_core_counts.get_mutable_data();
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * row_block_size;
+        const std::int64_t end = std::min(begin + row_block_size, row_count);
+        for (std::int64_t i = begin; i < end; ++i) {
+            block_offsets[block + 1] += core_flags[i] && parents[i] == i;
+            core_counts[block + 1] += core_flags[i];
+        }
+    });
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_offsets[block + 1] += block_offsets[block];
+        core_counts[block + 1] += core_counts[block];
+    }
+    const std::int64_t cluster_count = block_offsets[block_count];
+    const std::int64_t core_count = core_counts[block_count];
+
+    auto arr_responses = array<std::int32_t>::empty(row_count);
+    std::int32_t* responses = arr_responses.get_mutable_data();
+    dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * row_block_size;
+        const std::int64_t end = std::min(begin + row_block_size, row_count);
+        std::int32_t cluster_index = block_offsets[block];
+        for (std::int64_t i = begin; i < end; ++i) {
+            if (core_flags[i] && parents[i] == i) {
+                responses[i] = cluster_index++;
+            }
+        }
+    });
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+        if (core_flags[i] && parents[i] != i) {
+            responses[i] = responses[parents[i]];
+        }
+    });
+
+    // A border observation joins the cluster with the minimal index among the
+    // clusters of its core neighbors, like in the sequential expansion order
+    for_each_row_block(row_count, [&](std::int64_t begin, std::int64_t end) {
+        for (std::int64_t position = begin; position < end; ++position) {
+            const std::int32_t i = tree.get_index(position);
+            if (core_flags[i]) {
+                continue;
+            }
+            std::int32_t cluster_index = std::numeric_limits<std::int32_t>::max();
+            tree.for_each_in_radius(tree.get_row(position), radius_sq, [&](std::int32_t j) {
+                if (core_flags[j]) {
+                    cluster_index = std::min(cluster_index, responses[parents[j]]);
+                }
+                return true;
+            });
+            responses[i] =
+                cluster_index == std::numeric_limits<std::int32_t>::max() ? noise : cluster_index;
+        }
+    });
+    parents.reset();
+
+    auto results =
+        result_t().set_cluster_count(cluster_count).set_result_options(desc.get_result_options());
+
+    if (desc.get_result_options().test(result_options::responses)) {
+        results.set_responses(dal::homogen_table::wrap(arr_responses, row_count, 1));
+    }
+    if (desc.get_result_options().test(result_options::core_flags)) {
+        results.set_core_flags(dal::homogen_table::wrap(arr_core_flags, row_count, 1));
+    }
+
+    const bool compute_core_indices =
+        desc.get_result_options().test(result_options::core_observation_indices);
+    const bool compute_core_observations =
+        desc.get_result_options().test(result_options::core_observations);
+    if ((compute_core_indices || compute_core_observations) && core_count > 0) {
+        auto arr_core_indices = array<std::int32_t>::empty(core_count);
+        auto arr_core_observations = array<Float>::empty(core_count * column_count);
+        std::int32_t* core_indices = arr_core_indices.get_mutable_data();
+        Float* core_observations = arr_core_observations.get_mutable_data();
+        const Float* rows = arr_data.get_data();
+        dal::detail::threader_for(block_count, block_count, [&](std::int32_t block) {
+            const std::int64_t begin = block * row_block_size;
+            const std::int64_t end = std::min(begin + row_block_size, row_count);
+            std::int64_t core_index = core_counts[block];
+            for (std::int64_t i = begin; i < end; ++i) {
+                if (!core_flags[i]) {
+                    continue;
+                }
+                core_indices[core_index] = i;
+                std::copy(rows + i * column_count,
+                          rows + (i + 1) * column_count,
+                          core_observations + core_index * column_count);
+                ++core_index;
+            }
+        });
+        if (compute_core_indices) {
+            results.set_core_observation_indices(
+                dal::homogen_table::wrap(arr_core_indices, core_count, 1));
+        }
+        if (compute_core_observations) {
+            results.set_core_observations(
+                dal::homogen_table::wrap(arr_core_observations, core_count, column_count));
+        }
+    }
+
+    return results;
+}
+
+template <typename Float>
+struct compute_kernel_cpu<Float, method::kd_tree, task::clustering> {
+    result_t operator()(const context_cpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        return compute<Float>(ctx, desc, input);
+    }
+};
+
+template struct compute_kernel_cpu<float, method::kd_tree, task::clustering>;
+template struct compute_kernel_cpu<double, method::kd_tree, task::clustering>;
+
+} // namespace oneapi::dal::dbscan::backend
@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::dbscan::backend {
+
+/// Kd-tree over the rows of a dense row-major data block for the fixed-radius
+/// neighbor queries. The tree is complete and implicit: the node `i` has the
+/// children `2 * i + 1` and `2 * i + 2` and owns a contiguous range of rows,
+/// split in halves by the median of the widest dimension of its bounding box.
+/// The rows are copied in the tree order, so the leaves are scanned
+/// sequentially.
+template <typename Float>
+class kd_tree {
+public:
+    kd_tree(const Float* data,
+            std::int64_t row_count,
+            std::int64_t column_count,
+            std::int64_t leaf_size = 32)
+            : row_count_(row_count),
+              column_count_(column_count) {
+        ONEDAL_ASSERT(row_count > 0);
+        ONEDAL_ASSERT(column_count > 0);
+        ONEDAL_ASSERT(leaf_size > 0);
+
+        depth_ = 0;
+        while (depth_ < max_depth && ((row_count - 1) >> depth_) + 1 > leaf_size) {
+            ++depth_;
+        }
+        const std::int64_t node_count = (std::int64_t(2) << depth_) - 1;
+
+        indices_ = array<std::int32_t>::empty(row_count);
+        node_ranges_ = array<std::int64_t>::empty(2 * node_count);
+        bounds_ = array<Float>::empty(2 * node_count * column_count);
+
+        std::int32_t* indices = indices_.get_mutable_data();
+        std::int64_t* ranges = node_ranges_.get_mutable_data();
+        Float* bounds = bounds_.get_mutable_data();
+
+        dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+            indices[i] = i;
+        });
+        ranges[0] = 0;
+        ranges[1] = row_count;
+
+        for (std::int64_t level = 0; level <= depth_; ++level) {
+            const std::int64_t first_node = (std::int64_t(1) << level) - 1;
+            const std::int64_t level_node_count = std::int64_t(1) << level;
+            dal::detail::threader_for(level_node_count, level_node_count, [&](std::int32_t k) {
+                const std::int64_t node = first_node + k;
+                const std::int64_t begin = ranges[2 * node];
+                const std::int64_t end = ranges[2 * node + 1];
+                Float* lower = bounds + 2 * node * column_count;
+                Float* upper = lower + column_count;
+
+                std::fill(lower, upper, std::numeric_limits<Float>::max());
+                std::fill(upper, upper + column_count, std::numeric_limits<Float>::lowest());
+                for (std::int64_t i = begin; i < end; ++i) {
+                    const Float* row = data + indices[i] * column_count;
+                    for (std::int64_t j = 0; j < column_count; ++j) {
+                        lower[j] = std::min(lower[j], row[j]);
+                        upper[j] = std::max(upper[j], row[j]);
+                    }
+                }
+                if (level == depth_) {
+                    return;
+                }
+
+                std::int64_t split_dim = 0;
+                for (std::int64_t j = 1; j < column_count; ++j) {
+                    if (upper[j] - lower[j] > upper[split_dim] - lower[split_dim]) {
+                        split_dim = j;
+                    }
+                }
+                const std::int64_t middle = begin + (end - begin) / 2;
+                std::nth_element(indices + begin,
+                                 indices + middle,
+                                 indices + end,
+                                 [&](std::int32_t a, std::int32_t b) {
+                                     return data[a * column_count + split_dim] <
+                                            data[b * column_count + split_dim];
+                                 });
+                ranges[2 * (2 * node + 1)] = begin;
+                ranges[2 * (2 * node + 1) + 1] = middle;
+                ranges[2 * (2 * node + 2)] = middle;
+                ranges[2 * (2 * node + 2) + 1] = end;
+            });
+        }
+
+        rows_ = array<Float>::empty(row_count * column_count);
+        Float* rows = rows_.get_mutable_data();
+        dal::detail::threader_for(row_count, row_count, [&](std::int32_t i) {
+            std::copy(data + indices[i] * column_count,
+                      data + (indices[i] + 1) * column_count,
+                      rows + i * column_count);
+        });
+    }
+
+    std::int64_t get_row_count() const {
+        return row_count_;
+    }
+
+    std::int64_t get_column_count() const {
+        return column_count_;
+    }
+
+    /// Returns the index of the row at the given position in the tree order
+    std::int32_t get_index(std::int64_t position) const {
+        return indices_[position];
+    }
+
+    /// Returns the row at the given position in the tree order
+    const Float* get_row(std::int64_t position) const {
+        return rows_.get_data() + position * column_count_;
+    }
+
+    /// Calls `op(index)` for the index of every row within the squared
+    /// Euclidean distance `radius_sq` from the `query`, including the query row
+    /// itself. The search stops as soon as `op` returns false.
+    template <typename Op>
+    void for_each_in_radius(const Float* query, Float radius_sq, Op&& op) const {
+        const std::int32_t* indices = indices_.get_data();
+        const std::int64_t* ranges = node_ranges_.get_data();
+        const Float* bounds = bounds_.get_data();
+        const Float* rows = rows_.get_data();
+        const std::int64_t column_count = column_count_;
+
+        std::int64_t stack[max_depth + 2];
+        std::int64_t stack_size = 0;
+        stack[stack_size++] = 0;
+
+        while (stack_size > 0) {
+            const std::int64_t node = stack[--stack_size];
+            const std::int64_t begin = ranges[2 * node];
+            const std::int64_t end = ranges[2 * node + 1];
+            if (begin == end) {
+                continue;
+            }
+
+            const Float* lower = bounds + 2 * node * column_count;
+            const Float* upper = lower + column_count;
+            Float min_dist = 0;
+            Float max_dist = 0;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                const Float to_lower = query[j] - lower[j];
+                const Float to_upper = upper[j] - query[j];
+                const Float outside = std::max(Float(0), std::max(-to_lower, -to_upper));
+                const Float farthest = std::max(to_lower, to_upper);
+                min_dist += outside * outside;
+                max_dist += farthest * farthest;
+            }
+            if (min_dist > radius_sq) {
+                continue;
+            }
+
+            // The whole node is inside the ball
+            if (max_dist <= radius_sq) {
+                for (std::int64_t i = begin; i < end; ++i) {
+                    if (!op(indices[i])) {
+                        return;
+                    }
+                }
+                continue;
+            }
+
+            if (node >= (std::int64_t(1) << depth_) - 1) {
+                for (std::int64_t i = begin; i < end; ++i) {
+                    const Float* row = rows + i * column_count;
+                    Float dist = 0;
+                    for (std::int64_t j = 0; j < column_count; ++j) {
+                        const Float diff = row[j] - query[j];
+                        dist += diff * diff;
+                    }
+                    if (dist <= radius_sq && !op(indices[i])) {
+                        return;
+                    }
+                }
+                continue;
+            }
+
+            stack[stack_size++] = 2 * node + 2;
+            stack[stack_size++] = 2 * node + 1;
+        }
+    }
+
+private:
+    static constexpr std::int64_t max_depth = 40;
+
+    std::int64_t row_count_;
+    std::int64_t column_count_;
+    std::int64_t depth_;
+    array<std::int32_t> indices_;
+    array<std::int64_t> node_ranges_;
+    array<Float> bounds_;
+    array<Float> rows_;
+};
+
+} // namespace oneapi::dal::dbscan::backend
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/dbscan/backend/gpu/compute_kernel.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+
+namespace oneapi::dal::dbscan::backend {
+
+using dal::backend::context_gpu;
+
+using descriptor_t = detail::descriptor_base<task::clustering>;
+using result_t = compute_result<task::clustering>;
+using input_t = compute_input<task::clustering>;
+
+template <typename Float>
+struct compute_kernel_gpu<Float, method::kd_tree, task::clustering> {
+    result_t operator()(const context_gpu& ctx,
+                        const descriptor_t& desc,
+                        const input_t& input) const {
+        throw unimplemented(
+            dal::detail::error_messages::dbscan_kd_tree_method_is_not_implemented_for_gpu());
+    }
+};
+
+template struct compute_kernel_gpu<float, method::kd_tree, task::clustering>;
+template struct compute_kernel_gpu<double, method::kd_tree, task::clustering>;
+
+} // namespace oneapi::dal::dbscan::backend
@@ -47,6 +47,7 @@ public:
     std::int64_t min_observations;
     double epsilon;
     bool mem_save_mode;
+    std::int64_t memory_limit = 0;
     result_option_id result_options = default_result_options<Task>;
 };
 
@@ -74,6 +75,11 @@ bool descriptor_base<Task>::get_mem_save_mode() const {
     return impl_->mem_save_mode;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_memory_limit() const {
+    return impl_->memory_limit;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_epsilon_impl(double value) {
     if (value <= 0) {
@@ -92,6 +98,14 @@ void descriptor_base<Task>::set_mem_save_mode_impl(bool value) {
     impl_->mem_save_mode = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_memory_limit_impl(std::int64_t value) {
+    if (value < 0) {
+        throw domain_error(dal::detail::error_messages::memory_limit_lt_zero());
+    }
+    impl_->memory_limit = value;
+}
+
 template <typename Task>
 result_option_id descriptor_base<Task>::get_result_options() const {
     return impl_->result_options;
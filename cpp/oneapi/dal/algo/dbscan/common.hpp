@@ -39,12 +39,20 @@ using v1::by_default;
 
 namespace method {
 namespace v1 {
+/// Tag-type that denotes the method that computes the neighborhoods
+/// by the brute force search.
 struct brute_force {};
 
+/// Tag-type that denotes the method that computes the neighborhoods
+/// by the k-d tree search. The neighborhoods are not stored, so the memory
+/// consumption is linear in the number of observations.
+struct kd_tree {};
+
 using by_default = brute_force;
 } // namespace v1
 
 using v1::brute_force;
+using v1::kd_tree;
 using v1::by_default;
 
 } // namespace method
@@ -88,7 +96,8 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method, method::brute_force>;
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method, method::brute_force, method::kd_tree>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::clustering>;
@@ -107,12 +116,14 @@ public:
     double get_epsilon() const;
     std::int64_t get_min_observations() const;
     bool get_mem_save_mode() const;
+    std::int64_t get_memory_limit() const;
     result_option_id get_result_options() const;
 
 protected:
     void set_min_observations_impl(std::int64_t);
     void set_epsilon_impl(double);
     void set_mem_save_mode_impl(bool);
+    void set_memory_limit_impl(std::int64_t);
     void set_result_options_impl(const result_option_id& value);
 
 private:
@@ -137,7 +148,8 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::brute_force`.
+///                be :expr:`method::brute_force` or
+///                :expr:`method::kd_tree`.
 /// @tparam Task   Tag-type that specifies the type of the problem to solve. Can
 ///                be :expr:`task::clustering`.
 template <typename Float = float,
@@ -192,6 +204,21 @@ public:
         return *this;
     }
 
+    /// The upper bound in bytes of the memory used to store the neighborhoods.
+    /// If non-zero, the neighborhoods are computed in parallel blocks that fit
+    /// the bound instead of being stored for all observations at once.
+    /// Applies to :expr:`method::brute_force` on CPU.
+    /// @remark default = 0 (no bound)
+    /// @invariant :expr:`memory_limit >= 0`
+    std::int64_t get_memory_limit() const {
+        return base_t::get_memory_limit();
+    }
+
+    auto& set_memory_limit(std::int64_t value) {
+        base_t::set_memory_limit_impl(value);
+        return *this;
+    }
+
     /// Choose which results should be computed and returned.
     result_option_id get_result_options() const {
         return base_t::get_result_options();
@@ -27,12 +27,14 @@ namespace oneapi::dal::dbscan::test {
 template <typename TestType>
 class dbscan_batch_test : public dbscan_test<TestType, dbscan_batch_test<TestType>> {};
 
-using dbscan_types = COMBINE_TYPES((float, double), (dbscan::method::brute_force));
+using dbscan_types = COMBINE_TYPES((float, double),
+                                   (dbscan::method::brute_force, dbscan::method::kd_tree));
 
 TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan compute mode check",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -58,6 +60,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan degenerated test",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -78,6 +81,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
 }
 
 TEMPLATE_LIST_TEST_M(dbscan_batch_test, "dbscan boundary test", "[dbscan][batch]", dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -103,6 +107,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test, "dbscan boundary test", "[dbscan][batch]
 }
 
 TEMPLATE_LIST_TEST_M(dbscan_batch_test, "dbscan weight test", "[dbscan][batch]", dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -140,6 +145,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan simple core observations test #1",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -159,6 +165,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan simple core observations test #2",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -178,6 +185,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan simple core observations test #3",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -197,6 +205,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "dbscan simple core observations test #4",
                      "[dbscan][batch]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -212,10 +221,52 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
     this->run_checks(x, table{}, epsilon, min_observations, r);
 }
 
+TEMPLATE_LIST_TEST_M(dbscan_batch_test,
+                     "dbscan kd_tree against brute force on grid data",
+                     "[dbscan][batch]",
+                     dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto [x, w] = this->get_grid_data(3000, 3, 29);
+
+    this->check_against_brute_force(x, table{}, 1.5, 3);
+    this->check_against_brute_force(x, table{}, 2.5, 12);
+    this->check_against_brute_force(x, w, 1.5, 6);
+}
+
+TEMPLATE_LIST_TEST_M(dbscan_batch_test,
+                     "dbscan memory limit against brute force on grid data",
+                     "[dbscan][batch]",
+                     dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto [x, w] = this->get_grid_data(2000, 2, 49);
+
+    // The smallest limit prefetches a single neighborhood at a time
+    for (std::int64_t memory_limit : { 1, 4096, 1 << 20 }) {
+        this->check_against_brute_force(x, table{}, 1.5, 4, memory_limit);
+        this->check_against_brute_force(x, w, 2.5, 15, memory_limit);
+    }
+}
+
+TEMPLATE_LIST_TEST_M(dbscan_batch_test,
+                     "dbscan throws if memory limit is negative",
+                     "[dbscan][batch]",
+                     dbscan_types) {
+    using float_t = std::tuple_element_t<0, TestType>;
+    using method_t = std::tuple_element_t<1, TestType>;
+    using descriptor_t = dbscan::descriptor<float_t, method_t>;
+
+    REQUIRE_THROWS_AS(descriptor_t(1.0, 3).set_memory_limit(-1), domain_error);
+}
+
 TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "mnist: samples=10K, epsilon=1.7e3, min_observations=3",
                      "[dbscan][nightly][batch][external-dataset]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
     constexpr bool is_double = std::is_same_v<float_t, double>;
@@ -238,6 +289,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "hepmass: samples=10K, epsilon=5, min_observations=3",
                      "[dbscan][nightly][batch][external-dataset]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -256,6 +308,7 @@ TEMPLATE_LIST_TEST_M(dbscan_batch_test,
                      "road_network: samples=20K, epsilon=1.0e3, min_observations=220",
                      "[dbscan][nightly][batch][external-dataset]",
                      dbscan_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     using float_t = std::tuple_element_t<0, TestType>;
 
@@ -14,8 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <limits>
 #include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
 
 #include "oneapi/dal/algo/dbscan/compute.hpp"
 
@@ -41,6 +45,12 @@ public:
     using result_t = compute_result<task::clustering>;
     using input_t = compute_input<task::clustering>;
 
+    static constexpr bool is_kd_tree = std::is_same_v<method_t, dbscan::method::kd_tree>;
+
+    bool not_available_on_device() {
+        return this->get_policy().is_gpu() && is_kd_tree;
+    }
+
     auto get_descriptor(float_t epsilon, std::int64_t min_observations) const {
         return dbscan::descriptor<float_t, method_t>(epsilon, min_observations)
             .set_mem_save_mode(true)
@@ -64,6 +74,76 @@ public:
         check_responses_against_ref(compute_result.get_responses(), ref_responses);
     }
 
+    // Integer coordinates keep the squared distances exact, so all the methods
+    // see the same neighborhoods
+    std::tuple<table, table> get_grid_data(std::int64_t row_count,
+                                           std::int64_t column_count,
+                                           std::int32_t max_coordinate) {
+        std::mt19937 generator(7777);
+        std::uniform_int_distribution<std::int32_t> coordinate(0, max_coordinate);
+        std::uniform_int_distribution<std::int32_t> weight(1, 3);
+
+        auto data = array<float_t>::empty(row_count * column_count);
+        auto weights = array<float_t>::empty(row_count);
+        float_t* data_ptr = data.get_mutable_data();
+        float_t* weights_ptr = weights.get_mutable_data();
+        for (std::int64_t i = 0; i < row_count * column_count; i++) {
+            data_ptr[i] = float_t(coordinate(generator));
+        }
+        for (std::int64_t i = 0; i < row_count; i++) {
+            weights_ptr[i] = float_t(weight(generator));
+        }
+        return { homogen_table::wrap(data, row_count, column_count),
+                 homogen_table::wrap(weights, row_count, 1) };
+    }
+
+    void check_against_brute_force(const table& data,
+                                   const table& weights,
+                                   float_t epsilon,
+                                   std::int64_t min_observations,
+                                   std::int64_t memory_limit = 0) {
+        CAPTURE(epsilon, min_observations, memory_limit);
+        // The brute force method derives the core flags from the core indices
+        const auto options = result_options::responses | result_options::core_flags |
+                             result_options::core_observation_indices;
+
+        INFO("run compute");
+        const auto desc = get_descriptor(epsilon, min_observations)
+                              .set_memory_limit(memory_limit)
+                              .set_result_options(options);
+        const auto result =
+            oneapi::dal::test::engine::compute(this->get_policy(), desc, data, weights);
+
+        INFO("run brute force compute");
+        const auto ref_desc =
+            dbscan::descriptor<float_t, method::brute_force>(epsilon, min_observations)
+                .set_result_options(options);
+        const auto ref_result =
+            oneapi::dal::test::engine::compute(this->get_policy(), ref_desc, data, weights);
+
+        REQUIRE(result.get_cluster_count() == ref_result.get_cluster_count());
+        check_responses_against_ref(result.get_responses(), ref_result.get_responses());
+        check_responses_against_ref(result.get_core_flags(), ref_result.get_core_flags());
+        check_core_indices_against_ref(result.get_core_observation_indices(),
+                                       ref_result.get_core_observation_indices());
+    }
+
+    void check_core_indices_against_ref(const table& indices, const table& ref_indices) {
+        const auto core_count = ref_indices.get_row_count();
+        REQUIRE(indices.get_row_count() == core_count);
+        if (core_count == 0) {
+            return;
+        }
+        // The order of the core observations is not specified
+        const auto rows = row_accessor<const std::int32_t>(indices).pull({ 0, -1 });
+        const auto ref_rows = row_accessor<const std::int32_t>(ref_indices).pull({ 0, -1 });
+        std::vector<std::int32_t> sorted(rows.get_data(), rows.get_data() + core_count);
+        std::vector<std::int32_t> ref_sorted(ref_rows.get_data(), ref_rows.get_data() + core_count);
+        std::sort(sorted.begin(), sorted.end());
+        std::sort(ref_sorted.begin(), ref_sorted.end());
+        REQUIRE(sorted == ref_sorted);
+    }
+
     void check_responses_against_ref(const table& responses, const table& ref_responses) {
         ONEDAL_ASSERT(responses.get_row_count() == ref_responses.get_row_count());
         ONEDAL_ASSERT(responses.get_column_count() == ref_responses.get_column_count());
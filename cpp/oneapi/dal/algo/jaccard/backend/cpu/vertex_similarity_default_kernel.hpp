@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstring>
+#include <functional>
 #include <memory>
 
 #include "oneapi/dal/algo/jaccard/common.hpp"
@@ -23,18 +25,144 @@
 #include "oneapi/dal/algo/jaccard/detail/service.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/primitives/heap.hpp"
 #include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::preview::jaccard::backend {
 
+/// Packs the Jaccard coefficient and the vertex into the key, so that the keys of more similar
+/// vertices are greater and the vertices with equal coefficients are ordered by the index
+ONEDAL_FORCEINLINE std::uint64_t pack_similar_vertex(float coeff, std::int32_t vertex) {
+    // The bit representations of non-negative floats are ordered as the values
+    std::uint32_t coeff_bits;
+    std::memcpy(&coeff_bits, &coeff, sizeof(float));
+    return (static_cast<std::uint64_t>(coeff_bits) << 32) |
+           static_cast<std::uint32_t>(dal::detail::limits<std::int32_t>::max() - vertex);
+}
+
+ONEDAL_FORCEINLINE void unpack_similar_vertex(std::uint64_t key,
+                                              float &coeff,
+                                              std::int32_t &vertex) {
+    const auto coeff_bits = static_cast<std::uint32_t>(key >> 32);
+    std::memcpy(&coeff, &coeff_bits, sizeof(float));
+    vertex = dal::detail::limits<std::int32_t>::max() -
+             static_cast<std::int32_t>(key & 0xFFFFFFFFull);
+}
+
+/// Computes the `top_k` most similar vertices of the column range for each vertex of the
+/// row range. Each thread keeps a bounded min-heap of the best vertices of the current row,
+/// the rows are written to the fixed size slots of the result and compacted at the end.
+template <typename Cpu>
+vertex_similarity_result<task::all_vertex_pairs> jaccard_top_k(
+    const detail::descriptor_base<task::all_vertex_pairs> &desc,
+    const dal::preview::detail::topology<std::int32_t> &t,
+    void *result_ptr) {
+    namespace pr = dal::backend::primitives;
+
+    const auto row_begin = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_begin());
+    const auto row_end = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_end());
+    const auto column_begin =
+        dal::detail::integral_cast<std::int32_t>(desc.get_column_range_begin());
+    const auto column_end = dal::detail::integral_cast<std::int32_t>(desc.get_column_range_end());
+    const std::int64_t number_elements_in_block =
+        detail::compute_number_elements_in_top_k_block(row_begin,
+                                                       row_end,
+                                                       column_begin,
+                                                       column_end,
+                                                       desc.get_top_k());
+    const std::int32_t row_count = row_end - row_begin;
+    const std::int64_t top_k = number_elements_in_block / row_count;
+
+    std::int32_t *first_vertices = reinterpret_cast<std::int32_t *>(result_ptr);
+    std::int32_t *second_vertices = first_vertices + number_elements_in_block;
+    float *jaccard = reinterpret_cast<float *>(second_vertices + number_elements_in_block);
+
+    const std::int64_t thread_count = dal::detail::threader_get_max_threads();
+    auto heaps_arr = array<std::uint64_t>::empty(thread_count * top_k);
+    auto row_sizes_arr = array<std::int64_t>::empty(row_count);
+    std::uint64_t *heaps = heaps_arr.get_mutable_data();
+    std::int64_t *row_sizes = row_sizes_arr.get_mutable_data();
+
+    dal::detail::threader_for(row_count, row_count, [&](std::int32_t row) {
+        const std::int32_t i = row_begin + row;
+        const std::int32_t i_neighbor_size = t.get_vertex_degree(i);
+        const auto i_neighbors = t.get_vertex_neighbors_begin(i);
+        const std::int64_t thread_id = dal::detail::threader_get_current_thread_index();
+        std::uint64_t *heap = heaps + thread_id * top_k;
+        std::int64_t heap_size = 0;
+
+        for (std::int32_t j = column_begin; j < column_end && i_neighbor_size > 0; j++) {
+            const std::int32_t j_neighbor_size = t.get_vertex_degree(j);
+            const auto j_neighbors = t.get_vertex_neighbors_begin(j);
+            if (j == i || j_neighbor_size == 0 ||
+                i_neighbors[0] > j_neighbors[j_neighbor_size - 1] ||
+                j_neighbors[0] > i_neighbors[i_neighbor_size - 1]) {
+                continue;
+            }
+            const auto intersection_value = preview::backend::intersection<Cpu>(i_neighbors,
+                                                                                j_neighbors,
+                                                                                i_neighbor_size,
+                                                                                j_neighbor_size);
+            if (intersection_value == 0) {
+                continue;
+            }
+            const float coeff = float(intersection_value) /
+                                float(i_neighbor_size + j_neighbor_size - intersection_value);
+            const std::uint64_t key = pack_similar_vertex(coeff, j);
+            if (heap_size < top_k) {
+                heap[heap_size++] = key;
+                pr::push_heap(heap, heap + heap_size, std::greater<std::uint64_t>{});
+            }
+            else if (key > heap[0]) {
+                pr::pop_heap(heap, heap + heap_size, std::greater<std::uint64_t>{});
+                heap[heap_size - 1] = key;
+                pr::push_heap(heap, heap + heap_size, std::greater<std::uint64_t>{});
+            }
+        }
+
+        // The most similar vertices go first
+        pr::sort_heap(heap, heap + heap_size, std::greater<std::uint64_t>{});
+        const std::int64_t offset = row * top_k;
+        for (std::int64_t index = 0; index < heap_size; index++) {
+            first_vertices[offset + index] = i;
+            unpack_similar_vertex(heap[index],
+                                  jaccard[offset + index],
+                                  second_vertices[offset + index]);
+        }
+        row_sizes[row] = heap_size;
+    });
+
+    // Move the rows to the beginning of the result
+    std::int64_t nnz = 0;
+    for (std::int32_t row = 0; row < row_count; row++) {
+        const std::int64_t offset = row * top_k;
+        for (std::int64_t index = 0; index < row_sizes[row]; index++) {
+            first_vertices[nnz] = first_vertices[offset + index];
+            second_vertices[nnz] = second_vertices[offset + index];
+            jaccard[nnz] = jaccard[offset + index];
+            nnz++;
+        }
+    }
+
+    vertex_similarity_result res(
+        homogen_table::wrap(first_vertices, number_elements_in_block, 2, data_layout::column_major),
+        homogen_table::wrap(jaccard, number_elements_in_block, 1, data_layout::column_major),
+        nnz);
+    return res;
+}
+
 template <typename Cpu>
 vertex_similarity_result<task::all_vertex_pairs> jaccard(
     const detail::descriptor_base<task::all_vertex_pairs> &desc,
     const dal::preview::detail::topology<int32_t> &t,
     void *result_ptr) {
+    if (desc.get_top_k() > 0) {
+        return jaccard_top_k<Cpu>(desc, t, result_ptr);
+    }
     const auto row_begin = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_begin());
     const auto row_end = dal::detail::integral_cast<std::int32_t>(desc.get_row_range_end());
     const auto column_begin =
@@ -37,6 +37,9 @@ vertex_similarity_result<task::all_vertex_pairs> jaccard<dal::backend::cpu_dispa
     const detail::descriptor_base<task::all_vertex_pairs>& desc,
     const dal::preview::detail::topology<int32_t>& t,
     void* result_ptr) {
+    if (desc.get_top_k() > 0) {
+        return jaccard_top_k<dal::backend::cpu_dispatch_avx512>(desc, t, result_ptr);
+    }
     return jaccard_avx512<dal::backend::cpu_dispatch_avx512>(desc, t, result_ptr);
 }
 
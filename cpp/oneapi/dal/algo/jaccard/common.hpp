@@ -60,12 +60,14 @@ public:
     auto get_row_range_end() const -> std::int64_t;
     auto get_column_range_begin() const -> std::int64_t;
     auto get_column_range_end() const -> std::int64_t;
+    auto get_top_k() const -> std::int64_t;
 
 protected:
     void set_row_range_impl(std::int64_t begin, std::int64_t end);
     void set_column_range_impl(std::int64_t begin, std::int64_t end);
     void set_block_impl(const std::initializer_list<std::int64_t>& row_range,
                         const std::initializer_list<std::int64_t>& column_range);
+    void set_top_k_impl(std::int64_t top_k);
 
     dal::detail::pimpl<detail::descriptor_impl<task_t>> impl_;
 };
@@ -113,6 +115,11 @@ public:
         return base_t::get_column_range_end();
     }
 
+    /// Returns the number of the most similar vertices computed for each row of the block
+    std::int64_t get_top_k() const {
+        return base_t::get_top_k();
+    }
+
     /// Sets the range of the rows of the graph block for Jaccard similarity computation
     ///
     /// @param [in] begin  The begin of the row of the graph block
@@ -141,6 +148,18 @@ public:
         base_t::set_block_impl(row_range, column_range);
         return *this;
     }
+
+    /// Sets the number of the most similar vertices computed for each row of the graph
+    /// block. If the value is positive, only the vertex pairs with the `top_k` largest
+    /// non-zero Jaccard coefficients are returned for each row, ordered by the coefficient
+    /// in descending order, and the pair of the vertex with itself is not returned.
+    /// If the value is zero, all the vertex pairs with non-zero coefficients are returned.
+    ///
+    /// @param [in] top_k  The number of the most similar vertices for each row
+    auto& set_top_k(std::int64_t top_k) {
+        base_t::set_top_k_impl(top_k);
+        return *this;
+    }
 };
 
 /// Structure for the caching builder
@@ -44,6 +44,22 @@ ONEDAL_FORCEINLINE std::int64_t compute_number_elements_in_block(
     return vertex_pairs_count;
 }
 
+ONEDAL_FORCEINLINE std::int64_t compute_number_elements_in_top_k_block(
+    const std::int64_t &row_range_begin,
+    const std::int64_t &row_range_end,
+    const std::int64_t &column_range_begin,
+    const std::int64_t &column_range_end,
+    const std::int64_t &top_k) {
+    ONEDAL_ASSERT(top_k > 0, "Top-k parameter is not positive");
+    const std::int64_t column_count = column_range_end - column_range_begin;
+    // each row of the block keeps at most top_k vertex pairs
+    const std::int64_t row_element_count = (top_k < column_count) ? top_k : column_count;
+    return compute_number_elements_in_block(row_range_begin,
+                                            row_range_end,
+                                            0,
+                                            row_element_count);
+}
+
 template <typename Float, typename Index>
 ONEDAL_FORCEINLINE std::int64_t compute_max_block_size(const std::int64_t &vertex_pairs_count) {
     const std::int64_t vertex_pair_element_count = 2; // 2 elements in the vertex pair
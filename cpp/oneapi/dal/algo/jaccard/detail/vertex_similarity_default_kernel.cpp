@@ -28,7 +28,7 @@ operator()(const dal::detail::host_policy& ctx,
            const detail::descriptor_base<task::all_vertex_pairs>& desc,
            const dal::preview::detail::topology<std::int32_t>& t,
            void* result_ptr) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ ctx }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(ctx, [&](auto cpu) {
         return backend::jaccard<decltype(cpu)>(desc, t, result_ptr);
     });
 }
@@ -61,8 +61,17 @@ struct vertex_similarity_kernel_cpu<float, method::fast, task::all_vertex_pairs,
         const std::int64_t row_end = desc.get_row_range_end();
         const std::int64_t column_begin = desc.get_column_range_begin();
         const std::int64_t column_end = desc.get_column_range_end();
+        const std::int64_t top_k = desc.get_top_k();
         const std::int64_t number_elements_in_block =
-            compute_number_elements_in_block(row_begin, row_end, column_begin, column_end);
+            (top_k > 0) ? compute_number_elements_in_top_k_block(row_begin,
+                                                                  row_end,
+                                                                  column_begin,
+                                                                  column_end,
+                                                                  top_k)
+                        : compute_number_elements_in_block(row_begin,
+                                                           row_end,
+                                                           column_begin,
+                                                           column_end);
         if (number_elements_in_block == 0) {
             return vertex_similarity_result<task::all_vertex_pairs>();
         }
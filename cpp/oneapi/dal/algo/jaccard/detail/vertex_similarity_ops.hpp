@@ -66,6 +66,9 @@ struct vertex_similarity_ops {
         if (column_begin > column_end) {
             throw invalid_argument(msg::column_begin_gt_column_end());
         }
+        if (param.get_top_k() < 0) {
+            throw invalid_argument(msg::top_k_lt_zero());
+        }
         const std::int64_t vertex_count =
             dal::detail::get_impl(input.get_graph()).get_topology()._vertex_count;
         // Safe conversion as ranges were checked
@@ -102,6 +102,15 @@ JACCARD_BADARG_TEST("throws if column_range_begin is greater than column_range_e
     REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 2, 3, 0), invalid_argument);
 }
 
+JACCARD_BADARG_TEST("throws if top_k is negative") {
+    const auto jaccard_desc =
+        dal::preview::jaccard::descriptor<>().set_block({ 0, 2 }, { 0, 3 }).set_top_k(-1);
+    const auto g = this->create_graph();
+    dal::preview::jaccard::caching_builder builder;
+    REQUIRE_THROWS_AS(oneapi::dal::preview::vertex_similarity(jaccard_desc, g, builder),
+                      invalid_argument);
+}
+
 JACCARD_BADARG_TEST("throws if block ranges is greater than vertex count") {
     REQUIRE_THROWS_AS(this->check_vertex_similarity(0, 8, 0, 8), out_of_range);
 }
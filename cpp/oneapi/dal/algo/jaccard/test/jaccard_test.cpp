@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <array>
+#include <tuple>
+#include <vector>
 
 #include "oneapi/dal/algo/jaccard/vertex_similarity.hpp"
 #include "oneapi/dal/table/homogen.hpp"
@@ -135,6 +138,19 @@ public:
                                           24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34 };
 };
 
+class small_graph_type : public graph_base_data {
+public:
+    small_graph_type() {
+        vertex_count = 7;
+        edge_count = 8;
+        cols_count = edge_count * 2;
+        rows_count = vertex_count + 1;
+    }
+    std::array<std::int32_t, 7> degrees = { 1, 3, 4, 2, 3, 1, 2 };
+    std::array<std::int32_t, 16> cols = { 1, 0, 2, 4, 1, 3, 4, 5, 2, 6, 1, 2, 6, 2, 3, 4 };
+    std::array<std::int64_t, 8> rows = { 0, 1, 4, 8, 10, 13, 14, 16 };
+};
+
 class jaccard_test {
 public:
     template <typename GraphType>
@@ -228,6 +244,66 @@ public:
         const std::int64_t nonzero_coeff_count = result_vertex_similarity.get_nonzero_coeff_count();
         REQUIRE(nonzero_coeff_count == 0);
     }
+
+    template <typename GraphType>
+    void check_jaccard_top_k(const std::initializer_list<std::int64_t> &row_range,
+                             const std::initializer_list<std::int64_t> &column_range,
+                             std::int64_t top_k) {
+        const auto g = create_graph<GraphType>();
+        const auto all_pairs_desc =
+            dal::preview::jaccard::descriptor<>().set_block(row_range, column_range);
+        const auto top_k_desc = dal::preview::jaccard::descriptor<>()
+                                    .set_block(row_range, column_range)
+                                    .set_top_k(top_k);
+        dal::preview::jaccard::caching_builder all_pairs_builder;
+        dal::preview::jaccard::caching_builder top_k_builder;
+        const auto all_pairs_result =
+            dal::preview::vertex_similarity(all_pairs_desc, g, all_pairs_builder);
+        const auto top_k_result = dal::preview::vertex_similarity(top_k_desc, g, top_k_builder);
+
+        // The expected result is the all pairs result without the diagonal, ordered by the
+        // row, the coefficient in descending order and the column, and truncated to top_k
+        // elements in each row
+        using similar_vertex_t = std::tuple<std::int32_t, float, std::int32_t>;
+        std::vector<similar_vertex_t> expected;
+        {
+            auto vertex_pairs_table = all_pairs_result.get_vertex_pairs();
+            auto coeffs_table = all_pairs_result.get_coeffs();
+            const auto pairs = static_cast<homogen_table &>(vertex_pairs_table).get_data<int>();
+            const auto coeffs = static_cast<homogen_table &>(coeffs_table).get_data<float>();
+            const std::int64_t element_count = vertex_pairs_table.get_row_count();
+            for (std::int64_t i = 0; i < all_pairs_result.get_nonzero_coeff_count(); i++) {
+                if (pairs[i] != pairs[i + element_count]) {
+                    expected.emplace_back(pairs[i], -coeffs[i], pairs[i + element_count]);
+                }
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        std::vector<similar_vertex_t> expected_top_k;
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            if (static_cast<std::int64_t>(i) < top_k ||
+                std::get<0>(expected[i - top_k]) != std::get<0>(expected[i])) {
+                expected_top_k.push_back(expected[i]);
+            }
+        }
+
+        UNSCOPED_INFO("The number of top-k jaccard coefficients was determined incorrectly");
+        const std::int64_t nonzero_coeff_count = top_k_result.get_nonzero_coeff_count();
+        REQUIRE(nonzero_coeff_count == static_cast<std::int64_t>(expected_top_k.size()));
+
+        auto vertex_pairs_table = top_k_result.get_vertex_pairs();
+        auto coeffs_table = top_k_result.get_coeffs();
+        const auto pairs = static_cast<homogen_table &>(vertex_pairs_table).get_data<int>();
+        const auto coeffs = static_cast<homogen_table &>(coeffs_table).get_data<float>();
+        const std::int64_t element_count = vertex_pairs_table.get_row_count();
+        for (std::int64_t i = 0; i < nonzero_coeff_count; i++) {
+            UNSCOPED_INFO("Top-k pairs of vertices were found wrong");
+            REQUIRE(pairs[i] == std::get<0>(expected_top_k[i]));
+            REQUIRE(pairs[i + element_count] == std::get<2>(expected_top_k[i]));
+            UNSCOPED_INFO("Top-k jaccard coefficients are not correct");
+            REQUIRE(Approx(coeffs[i]) == -std::get<1>(expected_top_k[i]));
+        }
+    }
 };
 
 // TEST_M(jaccard_test,
@@ -420,6 +496,24 @@ TEST_M(jaccard_test, "Zero jaccard coeffs graph, row of 32 elements, right of th
     this->check_jaccard_zero_coeffs_only<>(jaccard_desc, g);
 }
 
+TEST_M(jaccard_test, "Top-k, small graph, whole graph") {
+    const std::int64_t top_k = GENERATE(1, 2, 3, 7);
+    this->check_jaccard_top_k<small_graph_type>({ 0, 7 }, { 0, 7 }, top_k);
+}
+
+TEST_M(jaccard_test, "Top-k, small graph, block") {
+    this->check_jaccard_top_k<small_graph_type>({ 1, 5 }, { 2, 6 }, 2);
+}
+
+TEST_M(jaccard_test, "Top-k, complete graph, equal coefficients are ordered by vertex") {
+    const std::int64_t top_k = GENERATE(1, 5, 40);
+    this->check_jaccard_top_k<complete_graph_33_type>({ 0, 33 }, { 0, 33 }, top_k);
+}
+
+TEST_M(jaccard_test, "Top-k, zero jaccard coeffs graph") {
+    this->check_jaccard_top_k<zero_jaccard_coeff_graph_type>({ 0, 34 }, { 0, 34 }, 3);
+}
+
 TEST_M(jaccard_test, "Null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     auto jaccard_desc = dal::preview::jaccard::descriptor<>().set_block({ 0, 0 }, { 0, 0 });
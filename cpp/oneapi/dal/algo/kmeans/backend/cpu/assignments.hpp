@@ -0,0 +1,88 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
+
+#include "oneapi/dal/algo/kmeans/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+namespace daal_kmeans = daal::algorithms::kmeans;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_lloyd_dense_kernel_t =
+    daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
+
+template <typename Float>
+inline Float distance_sq(const Float* x, const Float* y, std::int64_t column_count) {
+    Float sum = 0;
+    for (std::int64_t j = 0; j < column_count; ++j) {
+        const Float diff = x[j] - y[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/// Assigns the observations to the final centroids and computes the objective
+/// function by the same DAAL kernel as Lloyd's method does
+template <typename Float>
+inline void compute_assignments(const dal::backend::context_cpu& ctx,
+                                const table& data,
+                                std::int64_t cluster_count,
+                                array<Float>& arr_centroids,
+                                array<int>& arr_responses,
+                                array<Float>& arr_objective_function_value) {
+    namespace interop = dal::backend::interop;
+
+    const std::int64_t row_count = data.get_row_count();
+    const std::int64_t column_count = data.get_column_count();
+
+    daal_kmeans::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count), 0);
+    par.resultsToEvaluate = static_cast<DAAL_UINT64>(daal_kmeans::computeAssignments) |
+                            static_cast<DAAL_UINT64>(daal_kmeans::computeExactObjectiveFunction);
+
+    array<int> arr_iteration_count = array<int>::empty(1);
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(arr_centroids, cluster_count, column_count);
+    const auto daal_responses = interop::convert_to_daal_homogen_table(arr_responses, row_count, 1);
+    const auto daal_objective_function_value =
+        interop::convert_to_daal_homogen_table(arr_objective_function_value, 1, 1);
+    const auto daal_iteration_count =
+        interop::convert_to_daal_homogen_table(arr_iteration_count, 1, 1);
+
+    daal::data_management::NumericTable* input[2] = { daal_data.get(), daal_centroids.get() };
+
+    daal::data_management::NumericTable* output[4] = { nullptr,
+                                                       daal_responses.get(),
+                                                       daal_objective_function_value.get(),
+                                                       daal_iteration_count.get() };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_kernel_t>(ctx,
+                                                                           input,
+                                                                           output,
+                                                                           &par));
+}
+
+} // namespace oneapi::dal::kmeans::backend
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/src/algorithms/kmeans/kmeans_init_kernel.h>
+
+#include "oneapi/dal/algo/kmeans/common.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+namespace daal_kmeans_init = daal::algorithms::kmeans::init;
+
+template <typename Float, daal::CpuType Cpu>
+using daal_kmeans_init_plus_plus_dense_kernel_t =
+    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
+
+/// Returns the given initial centroids converted to a DAAL table or, if they
+/// are empty, computes them by the K-Means++ method
+template <typename Float>
+inline daal::data_management::NumericTablePtr get_initial_centroids(
+    const dal::backend::context_cpu& ctx,
+    const detail::descriptor_base<task::clustering>& desc,
+    const table& data,
+    const table& initial_centroids) {
+    namespace interop = dal::backend::interop;
+
+    const std::int64_t column_count = data.get_column_count();
+    const std::int64_t cluster_count = desc.get_cluster_count();
+
+    daal::data_management::NumericTablePtr daal_initial_centroids;
+    if (!initial_centroids.has_data()) {
+        const auto daal_data = interop::convert_to_daal_table<Float>(data);
+        daal_kmeans_init::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count));
+
+        const size_t init_len_input = 1;
+        daal::data_management::NumericTable* init_input[init_len_input] = { daal_data.get() };
+
+        daal_initial_centroids =
+            interop::allocate_daal_homogen_table<Float>(cluster_count, column_count);
+        const size_t init_len_output = 1;
+        daal::data_management::NumericTable* init_output[init_len_output] = {
+            daal_initial_centroids.get()
+        };
+
+        interop::status_to_exception(
+            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
+                ctx,
+                init_len_input,
+                init_input,
+                init_len_output,
+                init_output,
+                &par,
+                *(par.engine)));
+    }
+    else {
+        daal_initial_centroids = interop::convert_to_daal_table<Float>(initial_centroids);
+    }
+    return daal_initial_centroids;
+}
+
+} // namespace oneapi::dal::kmeans::backend
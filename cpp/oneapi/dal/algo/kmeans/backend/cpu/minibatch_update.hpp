@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/assignments.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+/// Moves the centroids towards the observations of the batch. Every centroid
+/// becomes the mean of the `cluster_sizes[k]` observations it was computed from
+/// and of the batch observations closest to it. This is the sequential update
+/// with the per-centroid learning rate `1 / cluster_sizes[k]`, but the result
+/// does not depend on the order of the observations within the batch. The
+/// centroids without the batch observations are not changed.
+///
+/// @return The sum of the squared centroid shifts
+template <typename Float>
+inline Float update_centroids_by_batch(const Float* batch,
+                                       std::int64_t row_count,
+                                       std::int64_t column_count,
+                                       std::int64_t cluster_count,
+                                       Float* centroids,
+                                       double* cluster_sizes) {
+    constexpr std::int64_t min_row_block_size = 256;
+
+    std::vector<std::int32_t> assignments(row_count);
+    const std::int64_t block_count = dal::detail::get_block_count(row_count, min_row_block_size);
+    dal::detail::threader_for_blocks(
+        row_count,
+        block_count,
+        [&](std::int64_t block, std::int64_t begin, std::int64_t end) {
+            for (std::int64_t i = begin; i < end; ++i) {
+                const Float* row = batch + i * column_count;
+                Float min_dist = std::numeric_limits<Float>::max();
+                std::int32_t min_index = 0;
+                for (std::int64_t k = 0; k < cluster_count; ++k) {
+                    const Float dist = distance_sq(row, centroids + k * column_count, column_count);
+                    if (dist < min_dist) {
+                        min_dist = dist;
+                        min_index = std::int32_t(k);
+                    }
+                }
+                assignments[i] = min_index;
+            }
+        });
+
+    // Group the observations by the clusters, so that every centroid is updated
+    // by one thread in the order of the observations
+    std::vector<std::int64_t> offsets(cluster_count + 1, 0);
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        ++offsets[assignments[i] + 1];
+    }
+    for (std::int64_t k = 0; k < cluster_count; ++k) {
+        offsets[k + 1] += offsets[k];
+    }
+    std::vector<std::int32_t> order(row_count);
+    {
+        std::vector<std::int64_t> positions(offsets.begin(), offsets.end() - 1);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            order[positions[assignments[i]]++] = std::int32_t(i);
+        }
+    }
+
+    std::vector<Float> shifts(cluster_count, Float(0));
+    dal::detail::threader_for(cluster_count, cluster_count, [&](std::int32_t k) {
+        const std::int64_t batch_size = offsets[k + 1] - offsets[k];
+        if (batch_size == 0) {
+            return;
+        }
+
+        Float* centroid = centroids + k * column_count;
+        const double prev_size = cluster_sizes[k];
+        std::vector<double> sum(column_count);
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            sum[j] = prev_size * double(centroid[j]);
+        }
+        for (std::int64_t i = offsets[k]; i < offsets[k + 1]; ++i) {
+            const Float* row = batch + std::int64_t(order[i]) * column_count;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                sum[j] += row[j];
+            }
+        }
+
+        const double size = prev_size + double(batch_size);
+        Float shift = 0;
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            const Float value = Float(sum[j] / size);
+            const Float diff = value - centroid[j];
+            shift += diff * diff;
+            centroid[j] = value;
+        }
+        shifts[k] = shift;
+        cluster_sizes[k] = size;
+    });
+
+    Float l2_norm = 0;
+    for (std::int64_t k = 0; k < cluster_count; ++k) {
+        l2_norm += shifts[k];
+    }
+    return l2_norm;
+}
+
+} // namespace oneapi::dal::kmeans::backend
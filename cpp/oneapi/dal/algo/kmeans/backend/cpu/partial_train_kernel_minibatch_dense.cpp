@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/initial_centroids.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/minibatch_update.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/partial_train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::clustering>;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float, typename Task>
+static partial_train_result<Task> partial_train(const context_cpu& ctx,
+                                                const descriptor_t& desc,
+                                                const partial_train_input<Task>& input) {
+    const table& data = input.get_data();
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+    const int64_t cluster_count = desc.get_cluster_count();
+
+    const auto& prev = input.get_prev();
+    table centroids = prev.get_model().get_centroids();
+    array<double> arr_cluster_sizes;
+    if (!centroids.has_data()) {
+        // The first block of the data provides the initial centroids
+        centroids = interop::convert_from_daal_homogen_table<Float>(
+            get_initial_centroids<Float>(ctx, desc, data, table{}));
+        arr_cluster_sizes = array<double>::zeros(cluster_count);
+    }
+    else if (prev.get_cluster_sizes().has_data()) {
+        arr_cluster_sizes = array<double>::empty(cluster_count);
+        const auto arr_prev_sizes = row_accessor<const double>{ prev.get_cluster_sizes() }.pull();
+        std::copy(arr_prev_sizes.get_data(),
+                  arr_prev_sizes.get_data() + cluster_count,
+                  arr_cluster_sizes.get_mutable_data());
+    }
+    else {
+        arr_cluster_sizes = array<double>::full(cluster_count, 1.0);
+    }
+
+    dal::detail::check_mul_overflow(cluster_count, column_count);
+    auto arr_centroids = array<Float>::empty(cluster_count * column_count);
+    {
+        const auto arr_prev_centroids = row_accessor<const Float>{ centroids }.pull();
+        std::copy(arr_prev_centroids.get_data(),
+                  arr_prev_centroids.get_data() + cluster_count * column_count,
+                  arr_centroids.get_mutable_data());
+    }
+
+    const auto arr_data = row_accessor<const Float>{ data }.pull();
+    update_centroids_by_batch(arr_data.get_data(),
+                              row_count,
+                              column_count,
+                              cluster_count,
+                              arr_centroids.get_mutable_data(),
+                              arr_cluster_sizes.get_mutable_data());
+
+    return partial_train_result<Task>()
+        .set_model(
+            model<Task>().set_centroids(dal::detail::homogen_table_builder{}
+                                            .reset(arr_centroids, cluster_count, column_count)
+                                            .build()))
+        .set_cluster_sizes(dal::detail::homogen_table_builder{}
+                               .reset(arr_cluster_sizes, cluster_count, 1)
+                               .build());
+}
+
+template <typename Float>
+struct partial_train_kernel_cpu<Float, method::minibatch_dense, task::clustering> {
+    partial_train_result<task::clustering> operator()(
+        const context_cpu& ctx,
+        const descriptor_t& desc,
+        const partial_train_input<task::clustering>& input) const {
+        return partial_train<Float, task::clustering>(ctx, desc, input);
+    }
+};
+
+template struct partial_train_kernel_cpu<float, method::minibatch_dense, task::clustering>;
+template struct partial_train_kernel_cpu<double, method::minibatch_dense, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
@@ -0,0 +1,414 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/assignments.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/initial_centroids.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::clustering>;
+
+namespace interop = dal::backend::interop;
+
+constexpr int64_t min_row_block_size = 256;
+
+/// The state of Hamerly's method. Every observation keeps an upper bound of
+/// the distance to its centroid and a lower bound of the distance to any other
+/// centroid. The bounds are shifted by the centroid drifts after each update,
+/// so the observation is compared with all the centroids only when the bounds
+/// can no longer prove that its assignment stays the same.
+template <typename Float>
+class hamerly_state {
+public:
+    hamerly_state(const Float* data,
+                  int64_t row_count,
+                  int64_t column_count,
+                  int64_t cluster_count)
+            : data_(data),
+              row_count_(row_count),
+              column_count_(column_count),
+              cluster_count_(cluster_count),
+              block_count_(dal::detail::get_block_count(row_count, min_row_block_size)) {
+        assignments_ = array<std::int32_t>::empty(row_count);
+        upper_bounds_ = array<Float>::empty(row_count);
+        lower_bounds_ = array<Float>::empty(row_count);
+        half_distances_ = array<Float>::empty(cluster_count);
+        drifts_ = array<Float>::empty(cluster_count);
+        counts_ = array<int64_t>::empty(cluster_count);
+        cluster_offsets_ = array<int64_t>::empty(cluster_count);
+        order_ = array<std::int32_t>::empty(row_count);
+        dal::detail::check_mul_overflow(block_count_, cluster_count);
+        block_offsets_ = array<int64_t>::empty(block_count_ * cluster_count);
+    }
+
+    /// Assigns every observation to the closest centroid. The first call
+    /// compares each observation with all the centroids and initializes the bounds.
+    void assign(const Float* centroids, bool initialize) {
+        compute_half_distances(centroids);
+
+        const Float* half_distances = half_distances_.get_data();
+        std::int32_t* assignments = assignments_.get_mutable_data();
+        Float* upper_bounds = upper_bounds_.get_mutable_data();
+        Float* lower_bounds = lower_bounds_.get_mutable_data();
+
+        dal::detail::threader_for_blocks(
+            row_count_,
+            block_count_,
+            [&](int64_t block, int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    const Float* row = data_ + i * column_count_;
+                    if (!initialize) {
+                        // The comparisons are strict, so that a tie with another
+                        // centroid is resolved by the full search like in Lloyd's method
+                        const std::int32_t closest = assignments[i];
+                        const Float bound = std::max(half_distances[closest], lower_bounds[i]);
+                        if (upper_bounds[i] < bound) {
+                            continue;
+                        }
+                        upper_bounds[i] = std::sqrt(
+                            distance_sq(row, centroids + closest * column_count_, column_count_));
+                        if (upper_bounds[i] < bound) {
+                            continue;
+                        }
+                    }
+                    find_closest(row, centroids, assignments[i], upper_bounds[i], lower_bounds[i]);
+                }
+            });
+    }
+
+    /// Computes the new centroids as the means of the assigned observations.
+    /// The centroids of the empty clusters are replaced by the observations that
+    /// are the farthest from their centroids, as in Lloyd's method. The bounds are
+    /// shifted by the centroid drifts.
+    ///
+    /// @return The sum of the squared centroid drifts
+    Float update(Float* centroids) {
+        sort_by_clusters();
+
+        const std::int32_t* order = order_.get_data();
+        const int64_t* counts = counts_.get_data();
+        const int64_t* cluster_offsets = cluster_offsets_.get_data();
+        Float* drifts = drifts_.get_mutable_data();
+
+        // The observations of the cluster are summed in the index order, so
+        // the result does not depend on the scheduling of the threads
+        auto arr_new_centroids = array<Float>::empty(cluster_count_ * column_count_);
+        Float* new_centroids = arr_new_centroids.get_mutable_data();
+        dal::detail::threader_for(cluster_count_, cluster_count_, [&](std::int32_t k) {
+            if (counts[k] == 0) {
+                return;
+            }
+            std::vector<double> sum(column_count_, 0.0);
+            const int64_t begin = cluster_offsets[k];
+            for (int64_t i = begin; i < begin + counts[k]; ++i) {
+                const Float* row = data_ + int64_t(order[i]) * column_count_;
+                for (int64_t j = 0; j < column_count_; ++j) {
+                    sum[j] += row[j];
+                }
+            }
+            const Float coeff = Float(1.0 / double(counts[k]));
+            for (int64_t j = 0; j < column_count_; ++j) {
+                new_centroids[k * column_count_ + j] = Float(sum[j]) * coeff;
+            }
+        });
+
+        const std::vector<std::int32_t> candidates = find_empty_cluster_candidates(centroids);
+
+        Float l2_norm = 0;
+        std::size_t candidate_index = 0;
+        for (int64_t k = 0; k < cluster_count_; ++k) {
+            const Float* new_centroid = new_centroids + k * column_count_;
+            if (counts[k] == 0) {
+                new_centroid = data_ + int64_t(candidates[candidate_index++]) * column_count_;
+            }
+            Float* centroid = centroids + k * column_count_;
+            const Float drift_sq = distance_sq(centroid, new_centroid, column_count_);
+            l2_norm += drift_sq;
+            drifts[k] = std::sqrt(drift_sq);
+            std::copy(new_centroid, new_centroid + column_count_, centroid);
+        }
+
+        shift_bounds();
+        return l2_norm;
+    }
+
+private:
+    void find_closest(const Float* row,
+                      const Float* centroids,
+                      std::int32_t& closest,
+                      Float& upper_bound,
+                      Float& lower_bound) const {
+        Float min_dist = std::numeric_limits<Float>::max();
+        Float second_min_dist = std::numeric_limits<Float>::max();
+        std::int32_t min_index = 0;
+        for (int64_t k = 0; k < cluster_count_; ++k) {
+            const Float dist = distance_sq(row, centroids + k * column_count_, column_count_);
+            if (dist < min_dist) {
+                second_min_dist = min_dist;
+                min_dist = dist;
+                min_index = std::int32_t(k);
+            }
+            else if (dist < second_min_dist) {
+                second_min_dist = dist;
+            }
+        }
+        closest = min_index;
+        upper_bound = std::sqrt(min_dist);
+        lower_bound = std::sqrt(second_min_dist);
+    }
+
+    /// Computes the half of the distance from every centroid to the closest other one.
+    /// An observation closer than that to its centroid cannot be closer to another one.
+    void compute_half_distances(const Float* centroids) {
+        Float* half_distances = half_distances_.get_mutable_data();
+        dal::detail::threader_for(cluster_count_, cluster_count_, [&](std::int32_t k) {
+            Float min_dist = std::numeric_limits<Float>::max();
+            for (int64_t l = 0; l < cluster_count_; ++l) {
+                if (l != k) {
+                    min_dist = std::min(min_dist,
+                                        distance_sq(centroids + k * column_count_,
+                                                    centroids + l * column_count_,
+                                                    column_count_));
+                }
+            }
+            half_distances[k] = std::sqrt(min_dist) / 2;
+        });
+    }
+
+    /// Computes the cluster sizes and places the indices of the observations
+    /// to `order_`, grouped by the clusters and sorted within each of them.
+    /// The observations of the cluster `k` start at `cluster_offsets_[k]`.
+    void sort_by_clusters() {
+        const std::int32_t* assignments = assignments_.get_data();
+        int64_t* counts = counts_.get_mutable_data();
+        int64_t* cluster_offsets = cluster_offsets_.get_mutable_data();
+        int64_t* block_offsets = block_offsets_.get_mutable_data();
+        std::int32_t* order = order_.get_mutable_data();
+
+        std::fill(block_offsets, block_offsets + block_count_ * cluster_count_, int64_t(0));
+        dal::detail::threader_for_blocks(
+            row_count_,
+            block_count_,
+            [&](int64_t block, int64_t begin, int64_t end) {
+                int64_t* block_counts = block_offsets + block * cluster_count_;
+                for (int64_t i = begin; i < end; ++i) {
+                    ++block_counts[assignments[i]];
+                }
+            });
+
+        int64_t offset = 0;
+        for (int64_t k = 0; k < cluster_count_; ++k) {
+            cluster_offsets[k] = offset;
+            for (int64_t block = 0; block < block_count_; ++block) {
+                const int64_t count = block_offsets[block * cluster_count_ + k];
+                block_offsets[block * cluster_count_ + k] = offset;
+                offset += count;
+            }
+            counts[k] = offset - cluster_offsets[k];
+        }
+
+        dal::detail::threader_for_blocks(
+            row_count_,
+            block_count_,
+            [&](int64_t block, int64_t begin, int64_t end) {
+                int64_t* positions = block_offsets + block * cluster_count_;
+                for (int64_t i = begin; i < end; ++i) {
+                    order[positions[assignments[i]]++] = std::int32_t(i);
+                }
+            });
+    }
+
+    /// Returns the observations that are the farthest from their centroids in
+    /// the descending order of the distance, one for each empty cluster
+    std::vector<std::int32_t> find_empty_cluster_candidates(const Float* centroids) const {
+        const int64_t* counts = counts_.get_data();
+        const int64_t empty_count = std::count(counts, counts + cluster_count_, int64_t(0));
+        if (empty_count == 0) {
+            return {};
+        }
+
+        const std::int32_t* assignments = assignments_.get_data();
+        auto arr_distances = array<Float>::empty(row_count_);
+        Float* distances = arr_distances.get_mutable_data();
+        dal::detail::threader_for_blocks(
+            row_count_,
+            block_count_,
+            [&](int64_t block, int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    distances[i] = distance_sq(data_ + i * column_count_,
+                                               centroids + assignments[i] * column_count_,
+                                               column_count_);
+                }
+            });
+
+        std::vector<std::int32_t> candidates(row_count_);
+        std::iota(candidates.begin(), candidates.end(), std::int32_t(0));
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + empty_count,
+                          candidates.end(),
+                          [&](std::int32_t lhs, std::int32_t rhs) {
+                              return distances[lhs] > distances[rhs] ||
+                                     (distances[lhs] == distances[rhs] && lhs < rhs);
+                          });
+        candidates.resize(empty_count);
+        return candidates;
+    }
+
+    /// Shifts the bounds by the centroid drifts: the distance to the own centroid
+    /// grows at most by its drift, the distance to any other one decreases at most
+    /// by the largest drift among the other centroids
+    void shift_bounds() {
+        const Float* drifts = drifts_.get_data();
+        int64_t max_index = 0;
+        for (int64_t k = 1; k < cluster_count_; ++k) {
+            if (drifts[k] > drifts[max_index]) {
+                max_index = k;
+            }
+        }
+        Float second_max_drift = 0;
+        for (int64_t k = 0; k < cluster_count_; ++k) {
+            if (k != max_index) {
+                second_max_drift = std::max(second_max_drift, drifts[k]);
+            }
+        }
+        const Float max_drift = drifts[max_index];
+
+        const std::int32_t* assignments = assignments_.get_data();
+        Float* upper_bounds = upper_bounds_.get_mutable_data();
+        Float* lower_bounds = lower_bounds_.get_mutable_data();
+        dal::detail::threader_for_blocks(
+            row_count_,
+            block_count_,
+            [&](int64_t block, int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    const std::int32_t closest = assignments[i];
+                    upper_bounds[i] += drifts[closest];
+                    lower_bounds[i] -= (closest == max_index) ? second_max_drift : max_drift;
+                }
+            });
+    }
+
+    const Float* data_;
+    int64_t row_count_;
+    int64_t column_count_;
+    int64_t cluster_count_;
+    int64_t block_count_;
+    array<std::int32_t> assignments_;
+    array<Float> upper_bounds_;
+    array<Float> lower_bounds_;
+    array<Float> half_distances_;
+    array<Float> drifts_;
+    array<int64_t> counts_;
+    array<int64_t> cluster_offsets_;
+    array<std::int32_t> order_;
+    array<int64_t> block_offsets_;
+};
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const descriptor_t& desc,
+                                const train_input<Task>& input) {
+    if (ctx.get_communicator().is_distributed()) {
+        throw unimplemented(
+            dal::detail::error_messages::spmd_version_of_algorithm_is_not_implemented());
+    }
+
+    const table& data = input.get_data();
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    const int64_t cluster_count = desc.get_cluster_count();
+    const int64_t max_iteration_count = desc.get_max_iteration_count();
+    const double accuracy_threshold = desc.get_accuracy_threshold();
+
+    dal::detail::check_mul_overflow(cluster_count, column_count);
+    array<Float> arr_centroids = array<Float>::empty(cluster_count * column_count);
+    {
+        const auto initial_centroids = interop::convert_from_daal_homogen_table<Float>(
+            get_initial_centroids<Float>(ctx, desc, data, input.get_initial_centroids()));
+        const auto arr_initial = row_accessor<const Float>{ initial_centroids }.pull();
+        std::copy(arr_initial.get_data(),
+                  arr_initial.get_data() + cluster_count * column_count,
+                  arr_centroids.get_mutable_data());
+    }
+
+    int64_t iteration_count = 0;
+    if (max_iteration_count > 0) {
+        const auto arr_data = row_accessor<const Float>(data).pull();
+        hamerly_state<Float> state(arr_data.get_data(), row_count, column_count, cluster_count);
+
+        Float* centroids = arr_centroids.get_mutable_data();
+        while (iteration_count < max_iteration_count) {
+            state.assign(centroids, iteration_count == 0);
+            const Float l2_norm = state.update(centroids);
+
+            ++iteration_count;
+            if (accuracy_threshold > 0.0 && l2_norm < accuracy_threshold) {
+                break;
+            }
+        }
+    }
+
+    array<int> arr_responses = array<int>::empty(row_count);
+    array<Float> arr_objective_function_value = array<Float>::empty(1);
+    compute_assignments<Float>(ctx,
+                               data,
+                               cluster_count,
+                               arr_centroids,
+                               arr_responses,
+                               arr_objective_function_value);
+
+    return train_result<Task>()
+        .set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
+        .set_iteration_count(iteration_count)
+        .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
+        .set_model(
+            model<Task>().set_centroids(dal::detail::homogen_table_builder{}
+                                            .reset(arr_centroids, cluster_count, column_count)
+                                            .build()));
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::hamerly_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float, task::clustering>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::hamerly_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::hamerly_dense, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
@@ -14,15 +14,21 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <daal/src/algorithms/kmeans/kmeans_init_kernel.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include <daal/src/algorithms/kmeans/kmeans_lloyd_kernel.h>
 
+#include "oneapi/dal/algo/kmeans/backend/cpu/initial_centroids.hpp"
 #include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/exceptions.hpp"
 
+#include "oneapi/dal/table/homogen.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 
 namespace oneapi::dal::kmeans::backend {
@@ -30,9 +36,9 @@ namespace oneapi::dal::kmeans::backend {
 using std::int64_t;
 using dal::backend::context_cpu;
 using descriptor_t = detail::descriptor_base<task::clustering>;
+using comm_t = dal::backend::communicator<spmd::device_memory_access::none>;
 
 namespace daal_kmeans = daal::algorithms::kmeans;
-namespace daal_kmeans_init = daal::algorithms::kmeans::init;
 namespace interop = dal::backend::interop;
 
 template <typename Float, daal::CpuType Cpu>
@@ -40,48 +46,8 @@ using daal_kmeans_lloyd_dense_kernel_t =
     daal_kmeans::internal::KMeansBatchKernel<daal_kmeans::lloydDense, Float, Cpu>;
 
 template <typename Float, daal::CpuType Cpu>
-using daal_kmeans_init_plus_plus_dense_kernel_t =
-    daal_kmeans_init::internal::KMeansInitKernel<daal_kmeans_init::plusPlusDense, Float, Cpu>;
-
-template <typename Float>
-static daal::data_management::NumericTablePtr get_initial_centroids(
-    const context_cpu& ctx,
-    const descriptor_t& desc,
-    const table& data,
-    const table& initial_centroids) {
-    const int64_t column_count = data.get_column_count();
-    const int64_t cluster_count = desc.get_cluster_count();
-
-    daal::data_management::NumericTablePtr daal_initial_centroids;
-    if (!initial_centroids.has_data()) {
-        const auto daal_data = interop::convert_to_daal_table<Float>(data);
-        daal_kmeans_init::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count));
-
-        const size_t init_len_input = 1;
-        daal::data_management::NumericTable* init_input[init_len_input] = { daal_data.get() };
-
-        daal_initial_centroids =
-            interop::allocate_daal_homogen_table<Float>(cluster_count, column_count);
-        const size_t init_len_output = 1;
-        daal::data_management::NumericTable* init_output[init_len_output] = {
-            daal_initial_centroids.get()
-        };
-
-        interop::status_to_exception(
-            interop::call_daal_kernel<Float, daal_kmeans_init_plus_plus_dense_kernel_t>(
-                ctx,
-                init_len_input,
-                init_input,
-                init_len_output,
-                init_output,
-                &par,
-                *(par.engine)));
-    }
-    else {
-        daal_initial_centroids = interop::convert_to_daal_table<Float>(initial_centroids);
-    }
-    return daal_initial_centroids;
-}
+using daal_kmeans_lloyd_dense_step1_kernel_t =
+    daal_kmeans::internal::KMeansDistributedStep1Kernel<daal_kmeans::lloydDense, Float, Cpu>;
 
 template <typename Float, typename Task>
 static train_result<Task> call_daal_kernel(const context_cpu& ctx,
@@ -142,10 +108,260 @@ static train_result<Task> call_daal_kernel(const context_cpu& ctx,
                                             .build()));
 }
 
+/// Local statistics computed by the DAAL distributed step on a single rank
+template <typename Float>
+struct lloyd_step_result {
+    array<int> counts;
+    array<Float> sums;
+    array<Float> objective;
+    array<Float> candidate_distances;
+    array<Float> candidate_centroids;
+};
+
+template <typename Float>
+static lloyd_step_result<Float> run_lloyd_step(const context_cpu& ctx,
+                                               const daal_kmeans::Parameter& par,
+                                               const daal::data_management::NumericTablePtr& data,
+                                               array<Float>& centroids,
+                                               array<int>& responses) {
+    const int64_t column_count = data->getNumberOfColumns();
+    const int64_t cluster_count = dal::detail::integral_cast<int64_t>(par.nClusters);
+
+    lloyd_step_result<Float> step{ array<int>::empty(cluster_count),
+                                   array<Float>::empty(cluster_count * column_count),
+                                   array<Float>::empty(1),
+                                   array<Float>::empty(cluster_count),
+                                   array<Float>::empty(cluster_count * column_count) };
+
+    const auto daal_centroids =
+        interop::convert_to_daal_homogen_table(centroids, cluster_count, column_count);
+    const auto daal_counts = interop::convert_to_daal_homogen_table(step.counts, cluster_count, 1);
+    const auto daal_sums =
+        interop::convert_to_daal_homogen_table(step.sums, cluster_count, column_count);
+    const auto daal_objective = interop::convert_to_daal_homogen_table(step.objective, 1, 1);
+    const auto daal_candidate_distances =
+        interop::convert_to_daal_homogen_table(step.candidate_distances, cluster_count, 1);
+    const auto daal_candidate_centroids =
+        interop::convert_to_daal_homogen_table(step.candidate_centroids,
+                                               cluster_count,
+                                               column_count);
+    daal::data_management::NumericTablePtr daal_responses;
+    if (responses.get_count() > 0) {
+        daal_responses =
+            interop::convert_to_daal_homogen_table(responses, responses.get_count(), 1);
+    }
+
+    const size_t len_input = 2;
+    daal::data_management::NumericTable* input[len_input] = { data.get(), daal_centroids.get() };
+
+    const size_t len_output = 6;
+    daal::data_management::NumericTable* output[len_output] = {
+        daal_counts.get(),
+        daal_sums.get(),
+        daal_objective.get(),
+        daal_candidate_distances.get(),
+        daal_candidate_centroids.get(),
+        daal_responses.get()
+    };
+
+    interop::status_to_exception(
+        interop::call_daal_kernel<Float, daal_kmeans_lloyd_dense_step1_kernel_t>(ctx,
+                                                                                 len_input,
+                                                                                 input,
+                                                                                 len_output,
+                                                                                 output,
+                                                                                 &par));
+    return step;
+}
+
+/// Replaces the centroids of empty clusters by the globally farthest observations.
+/// The candidates of all the ranks are gathered, so every rank makes the same choice
+/// and ends up with the same centroids.
+template <typename Float>
+static void assign_empty_clusters(const comm_t& comm,
+                                   const lloyd_step_result<Float>& step,
+                                   const array<int>& counts,
+                                   int64_t column_count,
+                                   Float* centroids,
+                                   Float& l2_norm) {
+    const int64_t cluster_count = counts.get_count();
+    const int64_t candidate_count = cluster_count * comm.get_rank_count();
+
+    auto distances = array<Float>::empty(candidate_count);
+    auto candidates = array<Float>::empty(candidate_count * column_count);
+    comm.allgather(step.candidate_distances, distances).wait();
+    comm.allgather(step.candidate_centroids, candidates).wait();
+
+    std::vector<int64_t> order(candidate_count);
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::stable_sort(order.begin(), order.end(), [&](int64_t lhs, int64_t rhs) {
+        return distances[lhs] > distances[rhs];
+    });
+
+    int64_t position = 0;
+    for (int64_t i = 0; i < cluster_count; ++i) {
+        if (counts[i] > 0) {
+            continue;
+        }
+        if (position >= candidate_count || distances[order[position]] < Float(0)) {
+            interop::status_to_exception(
+                daal::services::Status(daal::services::ErrorKMeansNumberOfClustersIsTooLarge));
+        }
+        const int64_t candidate = order[position++];
+
+        const Float* row = candidates.get_data() + candidate * column_count;
+        for (int64_t j = 0; j < column_count; ++j) {
+            const Float dist = centroids[i * column_count + j] - row[j];
+            l2_norm += dist * dist;
+            centroids[i * column_count + j] = row[j];
+        }
+    }
+}
+
+/// Computes the initial centroids from the data of all the ranks. Every rank
+/// selects up to `cluster_count` local candidates by K-Means++, then K-Means++
+/// is applied to the candidates gathered from all the ranks. The ranks process
+/// the same candidates with the same engine, so they get identical centroids.
+template <typename Float>
+static table compute_distributed_initial_centroids(const context_cpu& ctx,
+                                                   const descriptor_t& desc,
+                                                   const table& data) {
+    const auto& comm = ctx.get_communicator();
+    const int64_t rank_count = comm.get_rank_count();
+    const int64_t column_count = data.get_column_count();
+    const int64_t cluster_count = desc.get_cluster_count();
+
+    // The ranks that have too few rows offer all of them as candidates
+    table local_candidates = data;
+    int64_t local_count = data.get_row_count();
+    if (local_count > cluster_count) {
+        local_candidates = interop::convert_from_daal_homogen_table<Float>(
+            get_initial_centroids<Float>(ctx, desc, data, table{}));
+        local_count = cluster_count;
+    }
+    const auto send = row_accessor<const Float>{ local_candidates }.pull();
+
+    auto candidate_counts = array<int64_t>::empty(rank_count);
+    comm.allgather(local_count, candidate_counts).wait();
+
+    auto recv_counts = array<int64_t>::empty(rank_count);
+    auto displs = array<int64_t>::empty(rank_count);
+    int64_t* recv_counts_ptr = recv_counts.get_mutable_data();
+    int64_t* displs_ptr = displs.get_mutable_data();
+    int64_t candidate_count = 0;
+    for (int64_t i = 0; i < rank_count; ++i) {
+        recv_counts_ptr[i] = dal::detail::check_mul_overflow(candidate_counts[i], column_count);
+        displs_ptr[i] = candidate_count * column_count;
+        candidate_count = dal::detail::check_sum_overflow(candidate_count, candidate_counts[i]);
+    }
+
+    dal::detail::check_mul_overflow(candidate_count, column_count);
+    auto candidates = array<Float>::empty(candidate_count * column_count);
+    comm.allgatherv(send, candidates, recv_counts_ptr, displs_ptr).wait();
+
+    return interop::convert_from_daal_homogen_table<Float>(get_initial_centroids<Float>(
+        ctx,
+        desc,
+        homogen_table::wrap(candidates, candidate_count, column_count),
+        table{}));
+}
+
+template <typename Float, typename Task>
+static train_result<Task> call_daal_spmd_kernel(const context_cpu& ctx,
+                                                const descriptor_t& desc,
+                                                const table& data,
+                                                const table& initial_centroids) {
+    const auto& comm = ctx.get_communicator();
+
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    const int64_t cluster_count = desc.get_cluster_count();
+    const int64_t max_iteration_count = desc.get_max_iteration_count();
+    const double accuracy_threshold = desc.get_accuracy_threshold();
+
+    daal_kmeans::Parameter par(dal::detail::integral_cast<std::size_t>(cluster_count),
+                               dal::detail::integral_cast<std::size_t>(max_iteration_count));
+    par.accuracyThreshold = accuracy_threshold;
+    par.resultsToEvaluate = daal_kmeans::computeCentroids;
+
+    dal::detail::check_mul_overflow(cluster_count, column_count);
+    array<Float> arr_centroids = array<Float>::empty(cluster_count * column_count);
+
+    {
+        const table centroids_table =
+            initial_centroids.has_data()
+                ? initial_centroids
+                : compute_distributed_initial_centroids<Float>(ctx, desc, data);
+        const auto arr_initial = row_accessor<const Float>{ centroids_table }.pull();
+        dal::backend::copy(arr_centroids.get_mutable_data(),
+                           arr_initial.get_data(),
+                           cluster_count * column_count);
+    }
+
+    const auto daal_data = interop::convert_to_daal_table<Float>(data);
+    array<int> no_responses;
+
+    int64_t iteration_count = 0;
+    while (iteration_count < max_iteration_count) {
+        const auto step = run_lloyd_step<Float>(ctx, par, daal_data, arr_centroids, no_responses);
+
+        auto counts = step.counts;
+        auto sums = step.sums;
+        comm.allreduce(counts).wait();
+        comm.allreduce(sums).wait();
+
+        Float* centroids = arr_centroids.get_mutable_data();
+        Float l2_norm = 0;
+        for (int64_t i = 0; i < cluster_count; ++i) {
+            if (counts[i] > 0) {
+                const Float coeff = Float(1) / Float(counts[i]);
+                for (int64_t j = 0; j < column_count; ++j) {
+                    const Float new_centroid = sums[i * column_count + j] * coeff;
+                    const Float dist = centroids[i * column_count + j] - new_centroid;
+                    l2_norm += dist * dist;
+                    centroids[i * column_count + j] = new_centroid;
+                }
+            }
+        }
+        assign_empty_clusters<Float>(comm, step, counts, column_count, centroids, l2_norm);
+
+        ++iteration_count;
+        if (accuracy_threshold > 0.0 && l2_norm < accuracy_threshold) {
+            break;
+        }
+    }
+
+    // The final pass assigns the observations and computes the exact objective function
+    par.resultsToEvaluate = daal_kmeans::computeCentroids | daal_kmeans::computeAssignments;
+    array<int> arr_responses = array<int>::empty(row_count);
+    const auto final_step =
+        run_lloyd_step<Float>(ctx, par, daal_data, arr_centroids, arr_responses);
+
+    auto arr_objective_function_value = final_step.objective;
+    comm.allreduce(arr_objective_function_value).wait();
+
+    return train_result<Task>()
+        .set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
+        .set_iteration_count(iteration_count)
+        .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
+        .set_model(
+            model<Task>().set_centroids(dal::detail::homogen_table_builder{}
+                                            .reset(arr_centroids, cluster_count, column_count)
+                                            .build()));
+}
+
 template <typename Float, typename Task>
 static train_result<Task> train(const context_cpu& ctx,
                                 const descriptor_t& desc,
                                 const train_input<Task>& input) {
+    if (ctx.get_communicator().is_distributed()) {
+        return call_daal_spmd_kernel<Float, Task>(ctx,
+                                                  desc,
+                                                  input.get_data(),
+                                                  input.get_initial_centroids());
+    }
     return call_daal_kernel<Float, Task>(ctx,
                                          desc,
                                          input.get_data(),
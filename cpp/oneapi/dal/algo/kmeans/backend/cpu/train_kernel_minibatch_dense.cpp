@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/algo/kmeans/backend/cpu/assignments.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/initial_centroids.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/minibatch_update.hpp"
+#include "oneapi/dal/algo/kmeans/backend/cpu/train_kernel.hpp"
+#include "oneapi/dal/backend/interop/common.hpp"
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::kmeans::backend {
+
+using std::int64_t;
+using dal::backend::context_cpu;
+using descriptor_t = detail::descriptor_base<task::clustering>;
+
+namespace interop = dal::backend::interop;
+
+template <typename Float, typename Task>
+static train_result<Task> train(const context_cpu& ctx,
+                                const descriptor_t& desc,
+                                const train_input<Task>& input) {
+    if (ctx.get_communicator().is_distributed()) {
+        throw unimplemented(
+            dal::detail::error_messages::spmd_version_of_algorithm_is_not_implemented());
+    }
+
+    const table& data = input.get_data();
+    const int64_t row_count = data.get_row_count();
+    const int64_t column_count = data.get_column_count();
+
+    const int64_t cluster_count = desc.get_cluster_count();
+    const int64_t max_iteration_count = desc.get_max_iteration_count();
+    const double accuracy_threshold = desc.get_accuracy_threshold();
+
+    dal::detail::check_mul_overflow(cluster_count, column_count);
+    array<Float> arr_centroids = array<Float>::empty(cluster_count * column_count);
+    {
+        const auto initial_centroids = interop::convert_from_daal_homogen_table<Float>(
+            get_initial_centroids<Float>(ctx, desc, data, input.get_initial_centroids()));
+        const auto arr_initial = row_accessor<const Float>{ initial_centroids }.pull();
+        std::copy(arr_initial.get_data(),
+                  arr_initial.get_data() + cluster_count * column_count,
+                  arr_centroids.get_mutable_data());
+    }
+
+    // The iterations take the consecutive batches of the data and start over
+    // from the first one after the last batch
+    int64_t iteration_count = 0;
+    if (max_iteration_count > 0) {
+        const auto arr_data = row_accessor<const Float>(data).pull();
+        const Float* data_ptr = arr_data.get_data();
+        const int64_t batch_size = std::min(desc.get_batch_size(), row_count);
+        const int64_t batch_count = (row_count + batch_size - 1) / batch_size;
+
+        auto arr_cluster_sizes = array<double>::zeros(cluster_count);
+        Float* centroids = arr_centroids.get_mutable_data();
+        while (iteration_count < max_iteration_count) {
+            const int64_t first_row = (iteration_count % batch_count) * batch_size;
+            const int64_t batch_row_count = std::min(batch_size, row_count - first_row);
+            const Float l2_norm =
+                update_centroids_by_batch(data_ptr + first_row * column_count,
+                                          batch_row_count,
+                                          column_count,
+                                          cluster_count,
+                                          centroids,
+                                          arr_cluster_sizes.get_mutable_data());
+
+            ++iteration_count;
+            if (accuracy_threshold > 0.0 && l2_norm < accuracy_threshold) {
+                break;
+            }
+        }
+    }
+
+    array<int> arr_responses = array<int>::empty(row_count);
+    array<Float> arr_objective_function_value = array<Float>::empty(1);
+    compute_assignments<Float>(ctx,
+                               data,
+                               cluster_count,
+                               arr_centroids,
+                               arr_responses,
+                               arr_objective_function_value);
+
+    return train_result<Task>()
+        .set_responses(
+            dal::detail::homogen_table_builder{}.reset(arr_responses, row_count, 1).build())
+        .set_iteration_count(iteration_count)
+        .set_objective_function_value(static_cast<double>(arr_objective_function_value[0]))
+        .set_model(
+            model<Task>().set_centroids(dal::detail::homogen_table_builder{}
+                                            .reset(arr_centroids, cluster_count, column_count)
+                                            .build()));
+}
+
+template <typename Float>
+struct train_kernel_cpu<Float, method::minibatch_dense, task::clustering> {
+    train_result<task::clustering> operator()(const context_cpu& ctx,
+                                              const descriptor_t& desc,
+                                              const train_input<task::clustering>& input) const {
+        return train<Float, task::clustering>(ctx, desc, input);
+    }
+};
+
+template struct train_kernel_cpu<float, method::minibatch_dense, task::clustering>;
+template struct train_kernel_cpu<double, method::minibatch_dense, task::clustering>;
+
+} // namespace oneapi::dal::kmeans::backend
@@ -27,6 +27,7 @@ public:
     std::int64_t cluster_count = 2;
     std::int64_t max_iteration_count = 100;
     double accuracy_threshold = 0;
+    std::int64_t batch_size = 1024;
 };
 
 template <typename Task>
@@ -53,6 +54,11 @@ double descriptor_base<Task>::get_accuracy_threshold() const {
     return impl_->accuracy_threshold;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_batch_size() const {
+    return impl_->batch_size;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_cluster_count_impl(std::int64_t value) {
     if (value <= 0) {
@@ -80,6 +86,14 @@ void descriptor_base<Task>::set_accuracy_threshold_impl(double value) {
     impl_->accuracy_threshold = value;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_batch_size_impl(std::int64_t value) {
+    if (value <= 0) {
+        throw domain_error(dal::detail::error_messages::batch_size_leq_zero());
+    }
+    impl_->batch_size = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::clustering>;
 
 } // namespace v1
@@ -42,12 +42,30 @@ namespace v1 {
 /// method.
 struct lloyd_dense {};
 
+/// Tag-type that denotes Hamerly's computational method. It skips the distance
+/// computations that the triangle inequality proves to be redundant and produces
+/// the same clustering as :ref:`Lloyd's <kmeans_t_math_lloyd>` method up to
+/// floating-point ties: the distances are computed directly rather than via the
+/// dot products, so the observations that are equally close to two centroids
+/// within rounding errors may be assigned differently.
+struct hamerly_dense {};
+
+/// Tag-type that denotes the mini-batch computational method. Each iteration
+/// moves the centroids towards the means of the observations of one batch
+/// assigned to them, so the method needs a fraction of the data per iteration
+/// and supports the incremental training with :expr:`partial_train`. The
+/// batches are consecutive blocks of rows taken in order, so the observations
+/// should be shuffled if the data is sorted or grouped by clusters.
+struct minibatch_dense {};
+
 /// Alias tag-type for :ref:`Lloyd's <kmeans_t_math_lloyd>` computational
 /// method.
 using by_default = lloyd_dense;
 } // namespace v1
 
 using v1::lloyd_dense;
+using v1::hamerly_dense;
+using v1::minibatch_dense;
 using v1::by_default;
 
 } // namespace method
@@ -66,7 +84,11 @@ template <typename Float>
 constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>;
 
 template <typename Method>
-constexpr bool is_valid_method_v = dal::detail::is_one_of_v<Method, method::lloyd_dense>;
+constexpr bool is_valid_method_v =
+    dal::detail::is_one_of_v<Method,
+                             method::lloyd_dense,
+                             method::hamerly_dense,
+                             method::minibatch_dense>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::clustering>;
@@ -86,11 +108,13 @@ public:
     std::int64_t get_cluster_count() const;
     std::int64_t get_max_iteration_count() const;
     double get_accuracy_threshold() const;
+    std::int64_t get_batch_size() const;
 
 protected:
     void set_cluster_count_impl(std::int64_t);
     void set_max_iteration_count_impl(std::int64_t);
     void set_accuracy_threshold_impl(double);
+    void set_batch_size_impl(std::int64_t);
 
 private:
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -115,7 +139,8 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::lloyd_dense`.
+///                be :expr:`method::lloyd_dense`, :expr:`method::hamerly_dense`
+///                or :expr:`method::minibatch_dense`.
 /// @tparam Task   Tag-type that specifies the type of the problem to solve. Can
 ///                be :expr:`task::clustering`.
 template <typename Float = float,
@@ -173,6 +198,21 @@ public:
         base_t::set_accuracy_threshold_impl(value);
         return *this;
     }
+
+    /// The number of observations processed by one iteration of
+    /// :expr:`method::minibatch_dense`. The iterations take the consecutive
+    /// batches of rows and start over from the first one after the last
+    /// batch; the batches are not sampled randomly. Other methods ignore it.
+    /// @invariant :expr:`batch_size > 0`
+    /// @remark default = 1024
+    std::int64_t get_batch_size() const {
+        return base_t::get_batch_size();
+    }
+
+    auto& set_batch_size(std::int64_t value) {
+        base_t::set_batch_size_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/kmeans/partial_train_types.hpp"
+#include "oneapi/dal/detail/error_messages.hpp"
+
+namespace oneapi::dal::kmeans::detail {
+namespace v1 {
+
+template <typename Context, typename Float, typename Method, typename Task, typename... Options>
+struct partial_train_ops_dispatcher {
+    partial_train_result<Task> operator()(const Context&,
+                                          const descriptor_base<Task>&,
+                                          const partial_train_input<Task>&) const;
+};
+
+template <typename Descriptor>
+struct partial_train_ops {
+    using float_t = typename Descriptor::float_t;
+    using method_t = typename Descriptor::method_t;
+    using task_t = typename Descriptor::task_t;
+    using input_t = partial_train_input<task_t>;
+    using result_t = partial_train_result<task_t>;
+    using descriptor_base_t = descriptor_base<task_t>;
+
+    static_assert(std::is_same_v<method_t, method::minibatch_dense>,
+                  "Only the mini-batch method supports the incremental training");
+
+    void check_preconditions(const Descriptor& params, const input_t& input) const {
+        using msg = dal::detail::error_messages;
+
+        const auto& data = input.get_data();
+        if (!data.has_data()) {
+            throw domain_error(msg::input_data_is_empty());
+        }
+        if (data.get_row_count() > dal::detail::limits<std::int32_t>::max()) {
+            throw domain_error(msg::row_count_gt_max_int32());
+        }
+
+        const auto& centroids = input.get_prev().get_model().get_centroids();
+        if (!centroids.has_data()) {
+            if (params.get_cluster_count() > data.get_row_count()) {
+                throw invalid_argument(msg::cluster_count_exceeds_data_row_count());
+            }
+            return;
+        }
+        if (centroids.get_row_count() != params.get_cluster_count()) {
+            throw invalid_argument(msg::input_model_centroids_rc_neq_desc_cluster_count());
+        }
+        if (centroids.get_column_count() != data.get_column_count()) {
+            throw invalid_argument(msg::input_model_centroids_cc_neq_input_data_cc());
+        }
+
+        const auto& cluster_sizes = input.get_prev().get_cluster_sizes();
+        if (cluster_sizes.has_data() &&
+            cluster_sizes.get_row_count() != centroids.get_row_count()) {
+            throw invalid_argument(msg::partial_result_cluster_sizes_rc_neq_desc_cluster_count());
+        }
+    }
+
+    void check_postconditions(const Descriptor& params,
+                              const input_t& input,
+                              const result_t& result) const {
+        ONEDAL_ASSERT(result.get_model().get_centroids().has_data());
+        ONEDAL_ASSERT(result.get_model().get_centroids().get_row_count() ==
+                      params.get_cluster_count());
+        ONEDAL_ASSERT(result.get_model().get_centroids().get_column_count() ==
+                      input.get_data().get_column_count());
+        ONEDAL_ASSERT(result.get_cluster_sizes().get_row_count() == params.get_cluster_count());
+        ONEDAL_ASSERT(result.get_cluster_sizes().get_column_count() == 1);
+    }
+
+    template <typename Context>
+    auto operator()(const Context& ctx, const Descriptor& desc, const input_t& input) const {
+        check_preconditions(desc, input);
+        const auto result =
+            partial_train_ops_dispatcher<Context, float_t, method_t, task_t>()(ctx, desc, input);
+        check_postconditions(desc, input, result);
+        return result;
+    }
+};
+
+} // namespace v1
+
+using v1::partial_train_ops;
+
+} // namespace oneapi::dal::kmeans::detail
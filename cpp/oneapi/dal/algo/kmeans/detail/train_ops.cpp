@@ -27,7 +27,7 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
                                   const descriptor_base<Task>& desc,
                                   const train_input<Task>& input) const {
         using kernel_dispatcher_t = dal::backend::kernel_dispatcher< //
-            KERNEL_SINGLE_NODE_CPU(backend::train_kernel_cpu<Float, Method, Task>)>;
+            KERNEL_UNIVERSAL_SPMD_CPU(backend::train_kernel_cpu<Float, Method, Task>)>;
         return kernel_dispatcher_t{}(policy, desc, input);
     }
 };
@@ -38,6 +38,10 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::minibatch_dense, task::clustering)
+INSTANTIATE(double, method::minibatch_dense, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
@@ -45,6 +45,10 @@ struct train_ops_dispatcher<Policy, Float, Method, Task> {
 
 INSTANTIATE(float, method::lloyd_dense, task::clustering)
 INSTANTIATE(double, method::lloyd_dense, task::clustering)
+INSTANTIATE(float, method::hamerly_dense, task::clustering)
+INSTANTIATE(double, method::hamerly_dense, task::clustering)
+INSTANTIATE(float, method::minibatch_dense, task::clustering)
+INSTANTIATE(double, method::minibatch_dense, task::clustering)
 
 } // namespace v1
 } // namespace oneapi::dal::kmeans::detail
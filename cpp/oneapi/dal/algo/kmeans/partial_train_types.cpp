@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/partial_train_types.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::kmeans {
+
+template <typename Task>
+class detail::v1::partial_train_input_impl : public base {
+public:
+    partial_train_input_impl(const partial_train_result<Task>& prev, const table& data)
+            : prev(prev),
+              data(data) {}
+
+    partial_train_result<Task> prev;
+    table data;
+};
+
+template <typename Task>
+class detail::v1::partial_train_result_impl : public base {
+public:
+    model<Task> trained_model;
+    table cluster_sizes;
+};
+
+using detail::v1::partial_train_input_impl;
+using detail::v1::partial_train_result_impl;
+
+namespace v1 {
+
+template <typename Task>
+partial_train_result<Task>::partial_train_result()
+        : impl_(new partial_train_result_impl<Task>{}) {}
+
+template <typename Task>
+const model<Task>& partial_train_result<Task>::get_model() const {
+    return impl_->trained_model;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_model_impl(const model<Task>& value) {
+    impl_->trained_model = value;
+}
+
+template <typename Task>
+const table& partial_train_result<Task>::get_cluster_sizes() const {
+    return impl_->cluster_sizes;
+}
+
+template <typename Task>
+void partial_train_result<Task>::set_cluster_sizes_impl(const table& value) {
+    impl_->cluster_sizes = value;
+}
+
+template <typename Task>
+partial_train_input<Task>::partial_train_input(const table& data)
+        : impl_(new partial_train_input_impl<Task>(partial_train_result<Task>{}, data)) {}
+
+template <typename Task>
+partial_train_input<Task>::partial_train_input(const partial_train_result<Task>& prev,
+                                               const table& data)
+        : impl_(new partial_train_input_impl<Task>(prev, data)) {}
+
+template <typename Task>
+partial_train_input<Task>::partial_train_input(const model<Task>& model, const table& data)
+        : impl_(new partial_train_input_impl<Task>(
+              partial_train_result<Task>{}.set_model(model),
+              data)) {}
+
+template <typename Task>
+const table& partial_train_input<Task>::get_data() const {
+    return impl_->data;
+}
+
+template <typename Task>
+void partial_train_input<Task>::set_data_impl(const table& value) {
+    impl_->data = value;
+}
+
+template <typename Task>
+const partial_train_result<Task>& partial_train_input<Task>::get_prev() const {
+    return impl_->prev;
+}
+
+template <typename Task>
+void partial_train_input<Task>::set_prev_impl(const partial_train_result<Task>& value) {
+    impl_->prev = value;
+}
+
+template class ONEDAL_EXPORT partial_train_input<task::clustering>;
+template class ONEDAL_EXPORT partial_train_result<task::clustering>;
+
+} // namespace v1
+} // namespace oneapi::dal::kmeans
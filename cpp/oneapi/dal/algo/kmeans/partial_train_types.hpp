@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/algo/kmeans/common.hpp"
+
+namespace oneapi::dal::kmeans {
+
+namespace detail {
+namespace v1 {
+template <typename Task>
+class partial_train_input_impl;
+
+template <typename Task>
+class partial_train_result_impl;
+} // namespace v1
+
+using v1::partial_train_input_impl;
+using v1::partial_train_result_impl;
+
+} // namespace detail
+
+namespace v1 {
+
+/// The state of the incremental training: the current centroids and the
+/// number of observations that contributed to each of them. Each centroid is
+/// the mean of all the observations assigned to it so far, so it moves towards
+/// a new observation with the learning rate equal to the inverse of its size.
+///
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::clustering`.
+template <typename Task = task::by_default>
+class partial_train_result : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the default property values.
+    partial_train_result();
+
+    /// The model with the centroids computed on the processed blocks of the data.
+    /// @remark default = model<Task>{}
+    const model<Task>& get_model() const;
+
+    auto& set_model(const model<Task>& value) {
+        set_model_impl(value);
+        return *this;
+    }
+
+    /// A $k \\times 1$ table with the numbers of the processed observations
+    /// assigned to each cluster. If it is empty while the model is not, every
+    /// centroid of the model is weighted as a single observation.
+    /// @remark default = table{}
+    const table& get_cluster_sizes() const;
+
+    auto& set_cluster_sizes(const table& value) {
+        set_cluster_sizes_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_model_impl(const model<Task>&);
+    void set_cluster_sizes_impl(const table&);
+
+private:
+    dal::detail::pimpl<detail::partial_train_result_impl<Task>> impl_;
+};
+
+/// @tparam Task Tag-type that specifies the type of the problem to solve. Can
+///              be :expr:`task::clustering`.
+template <typename Task = task::by_default>
+class partial_train_input : public base {
+    static_assert(detail::is_valid_task_v<Task>);
+
+public:
+    using task_t = Task;
+
+    /// Creates a new instance of the class with the given :literal:`data`
+    /// property value and the empty partial result
+    partial_train_input(const table& data);
+
+    /// Creates a new instance of the class with the given :literal:`prev` and
+    /// :literal:`data` property values
+    partial_train_input(const partial_train_result<Task>& prev, const table& data);
+
+    /// Creates a new instance of the class that continues the training of the
+    /// given :literal:`model` on the :literal:`data`
+    partial_train_input(const model<Task>& model, const table& data);
+
+    /// An $n \\times p$ table with the next block of the data, where each row
+    /// stores one feature vector.
+    /// @remark default = table{}
+    const table& get_data() const;
+
+    auto& set_data(const table& value) {
+        set_data_impl(value);
+        return *this;
+    }
+
+    /// The partial result computed on the previous blocks of the data. If its
+    /// model is empty, the initial centroids are computed on the data by the
+    /// K-Means++ method.
+    /// @remark default = partial_train_result<Task>{}
+    const partial_train_result<Task>& get_prev() const;
+
+    auto& set_prev(const partial_train_result<Task>& value) {
+        set_prev_impl(value);
+        return *this;
+    }
+
+protected:
+    void set_data_impl(const table& value);
+    void set_prev_impl(const partial_train_result<Task>& value);
+
+private:
+    dal::detail::pimpl<detail::partial_train_input_impl<Task>> impl_;
+};
+
+} // namespace v1
+
+using v1::partial_train_input;
+using v1::partial_train_result;
+
+} // namespace oneapi::dal::kmeans
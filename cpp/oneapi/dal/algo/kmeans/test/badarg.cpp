@@ -139,6 +139,14 @@ KMEANS_BADARG_TEST("throws if max iteration count is negative") {
     REQUIRE_THROWS_AS(this->get_descriptor().set_max_iteration_count(-1), domain_error);
 }
 
+KMEANS_BADARG_TEST("accepts positive batch size") {
+    REQUIRE_NOTHROW(this->get_descriptor().set_batch_size(1));
+}
+
+KMEANS_BADARG_TEST("throws if batch size is zero") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_batch_size(0), domain_error);
+}
+
 KMEANS_BADARG_TEST("accepts positive accuracy threshold") {
     REQUIRE_NOTHROW(this->get_descriptor().set_accuracy_threshold(0.01));
 }
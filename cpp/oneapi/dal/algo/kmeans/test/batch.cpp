@@ -21,6 +21,12 @@ namespace oneapi::dal::kmeans::test {
 template <typename TestType>
 class kmeans_batch_test : public kmeans_test<TestType, kmeans_batch_test<TestType>> {};
 
+using kmeans_batch_types = COMBINE_TYPES((float, double),
+                                         (kmeans::method::lloyd_dense,
+                                          kmeans::method::hamerly_dense));
+using kmeans_hamerly_types = COMBINE_TYPES((float, double), (kmeans::method::hamerly_dense));
+using kmeans_minibatch_types = COMBINE_TYPES((float, double), (kmeans::method::minibatch_dense));
+
 /*
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans degenerated test",
@@ -72,7 +78,8 @@ TEMPLATE_LIST_TEST_M(kmeans_batch_test, "kmeans relocation test", "[kmeans][batc
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans empty clusters test",
                      "[kmeans][batch]",
-                     kmeans_types) {
+                     kmeans_batch_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     this->check_empty_clusters();
 }
@@ -80,7 +87,8 @@ TEMPLATE_LIST_TEST_M(kmeans_batch_test,
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans smoke train/infer test",
                      "[kmeans][batch]",
-                     kmeans_types) {
+                     kmeans_batch_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     this->check_on_smoke_data();
 }
@@ -88,11 +96,53 @@ TEMPLATE_LIST_TEST_M(kmeans_batch_test,
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans train/infer on gold data",
                      "[kmeans][batch]",
-                     kmeans_types) {
+                     kmeans_batch_types) {
+    SKIP_IF(this->not_available_on_device());
     SKIP_IF(this->not_float64_friendly());
     this->check_on_gold_data();
 }
 
+TEMPLATE_LIST_TEST_M(kmeans_batch_test,
+                     "kmeans hamerly against lloyd on blobs",
+                     "[kmeans][batch]",
+                     kmeans_hamerly_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto x = blobs_dataset::get_data(5000, 4, 40).get_table(this->get_homogen_table_id());
+
+    this->check_hamerly_against_lloyd(x, 40, 30, 0.0);
+    this->check_hamerly_against_lloyd(x, 200, 10, 0.0);
+    this->check_hamerly_against_lloyd(x, 25, 100, 1e-3);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_batch_test,
+                     "kmeans hamerly against lloyd on non-integer blobs",
+                     "[kmeans][batch]",
+                     kmeans_hamerly_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const auto x =
+        blobs_dataset::get_data(5000, 4, 40, false).get_table(this->get_homogen_table_id());
+
+    this->check_hamerly_against_lloyd_with_tolerance(x, 40, 30, 1e-3);
+    this->check_hamerly_against_lloyd_with_tolerance(x, 25, 100, 1e-3);
+}
+
+TEMPLATE_LIST_TEST_M(kmeans_batch_test,
+                     "kmeans mini-batch against lloyd on blobs",
+                     "[kmeans][batch]",
+                     kmeans_minibatch_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table data = blobs_dataset::get_data(5000, 4, 10).get_table(this->get_homogen_table_id());
+    const std::int64_t batch_size = GENERATE(500, 1024, 5000);
+
+    this->check_minibatch_against_lloyd(data, 10, batch_size, 1e-2);
+}
+
 TEMPLATE_LIST_TEST_M(kmeans_batch_test,
                      "kmeans block test",
                      "[kmeans][batch][nightly][block]",
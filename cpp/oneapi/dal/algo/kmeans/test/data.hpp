@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/dataframe.hpp"
 
@@ -183,4 +186,43 @@ private:
     static constexpr std::int64_t cluster_count = 3;
 };
 
+/// Observations scattered around random centers. By default the observations are
+/// integer-valued, then the distances between them are exact, so the methods that
+/// compute the distances differently get the same assignments
+class blobs_dataset {
+public:
+    blobs_dataset() = delete;
+
+    static te::dataframe get_data(std::int64_t row_count,
+                                  std::int64_t column_count,
+                                  std::int64_t blob_count,
+                                  bool integer_valued = true) {
+        const auto centers = te::dataframe_builder{ blob_count, column_count }
+                                 .fill_uniform(-100.0, 100.0, 7777)
+                                 .build();
+        const auto offsets =
+            te::dataframe_builder{ row_count, column_count }.fill_uniform(-5.0, 5.0, 7778).build();
+        const auto blobs = te::dataframe_builder{ row_count, 1 }
+                               .fill_uniform(0.0, double(blob_count), 7779)
+                               .build();
+        const float* centers_ptr = centers.get_array().get_data();
+        const float* offsets_ptr = offsets.get_array().get_data();
+        const float* blobs_ptr = blobs.get_array().get_data();
+
+        auto data = array<float>::empty(row_count * column_count);
+        float* data_ptr = data.get_mutable_data();
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const std::int64_t blob = std::min(std::int64_t(blobs_ptr[i]), blob_count - 1);
+            for (std::int64_t j = 0; j < column_count; j++) {
+                const float center = centers_ptr[blob * column_count + j];
+                const float offset = offsets_ptr[i * column_count + j];
+                data_ptr[i * column_count + j] = integer_valued
+                                                     ? std::round(center) + std::round(offset)
+                                                     : center + offset;
+            }
+        }
+        return te::dataframe{ data, row_count, column_count };
+    }
+};
+
 } // namespace oneapi::dal::kmeans::test
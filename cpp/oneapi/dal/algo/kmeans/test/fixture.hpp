@@ -18,15 +18,19 @@
 
 #include <limits>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dal/algo/kmeans/train.hpp"
 #include "oneapi/dal/algo/kmeans/infer.hpp"
+#include "oneapi/dal/algo/kmeans/partial_train.hpp"
 #include "oneapi/dal/algo/kmeans/test/data.hpp"
 
 #include "oneapi/dal/table/homogen.hpp"
 #include "oneapi/dal/table/row_accessor.hpp"
 #include "oneapi/dal/test/engine/fixtures.hpp"
 #include "oneapi/dal/test/engine/math.hpp"
+#include "oneapi/dal/test/engine/tables.hpp"
 #include "oneapi/dal/test/engine/metrics/clustering.hpp"
 
 namespace oneapi::dal::kmeans::test {
@@ -63,6 +67,192 @@ public:
         return descriptor_t{ cluster_count };
     }
 
+    bool not_available_on_device() {
+        constexpr bool is_hamerly = std::is_same_v<method_t, kmeans::method::hamerly_dense>;
+        constexpr bool is_minibatch = std::is_same_v<method_t, kmeans::method::minibatch_dense>;
+        return this->get_policy().is_gpu() && (is_hamerly || is_minibatch);
+    }
+
+    /// Hamerly's method skips only the distance computations that cannot change
+    /// the assignments, so on the data with exact distances it must give the same
+    /// results as Lloyd's method
+    void check_hamerly_against_lloyd(const table& data,
+                                     std::int64_t cluster_count,
+                                     std::int64_t max_iteration_count,
+                                     float_t accuracy_threshold) {
+        CAPTURE(cluster_count, max_iteration_count, accuracy_threshold);
+        const auto [result, ref_result] =
+            train_hamerly_and_lloyd(data, cluster_count, max_iteration_count, accuracy_threshold);
+
+        REQUIRE(result.get_iteration_count() == ref_result.get_iteration_count());
+        check_response_match(ref_result.get_responses(), result.get_responses());
+        check_centroid_match_with_rel_tol(1e-5,
+                                          ref_result.get_model().get_centroids(),
+                                          result.get_model().get_centroids());
+        REQUIRE(check_value_with_ref_tol(result.get_objective_function_value(),
+                                         ref_result.get_objective_function_value(),
+                                         1e-5));
+    }
+
+    /// On the data with inexact distances the methods may assign the observations
+    /// that are equally close to two centroids within rounding errors differently,
+    /// so only the centroids and the objective function are compared
+    void check_hamerly_against_lloyd_with_tolerance(const table& data,
+                                                    std::int64_t cluster_count,
+                                                    std::int64_t max_iteration_count,
+                                                    double tolerance) {
+        CAPTURE(cluster_count, max_iteration_count, tolerance);
+        const auto [result, ref_result] =
+            train_hamerly_and_lloyd(data, cluster_count, max_iteration_count, 0.0);
+
+        check_centroid_match_with_rel_tol(tolerance,
+                                          ref_result.get_model().get_centroids(),
+                                          result.get_model().get_centroids());
+        REQUIRE(check_value_with_ref_tol(result.get_objective_function_value(),
+                                         ref_result.get_objective_function_value(),
+                                         tolerance));
+    }
+
+    /// Trains Hamerly's and Lloyd's methods from the first rows of the data
+    auto train_hamerly_and_lloyd(const table& data,
+                                 std::int64_t cluster_count,
+                                 std::int64_t max_iteration_count,
+                                 float_t accuracy_threshold) {
+        static_assert(std::is_same_v<method_t, kmeans::method::hamerly_dense>);
+
+        const auto data_rows = row_accessor<const float_t>(data).pull({ 0, cluster_count });
+        const auto initial_centroids =
+            homogen_table::wrap(data_rows.get_data(), cluster_count, data.get_column_count());
+
+        INFO("run training");
+        const auto desc = get_descriptor(cluster_count, max_iteration_count, accuracy_threshold);
+        const auto result = this->train(desc, data, initial_centroids);
+
+        INFO("run Lloyd's training");
+        const auto ref_desc = kmeans::descriptor<float_t, kmeans::method::lloyd_dense, task_t>{}
+                                  .set_cluster_count(cluster_count)
+                                  .set_max_iteration_count(max_iteration_count)
+                                  .set_accuracy_threshold(accuracy_threshold);
+        const auto ref_result = this->train(ref_desc, data, initial_centroids);
+
+        return std::make_pair(result, ref_result);
+    }
+
+    /// The mini-batch method and Lloyd's method are started from the first rows
+    /// of the data. The mini-batch method moves the centroids by the noisy
+    /// estimates of the cluster means, so it may converge to a slightly worse
+    /// clustering and only the objective function values are compared
+    void check_minibatch_against_lloyd(const table& data,
+                                       std::int64_t cluster_count,
+                                       std::int64_t batch_size,
+                                       double tolerance) {
+        static_assert(std::is_same_v<method_t, kmeans::method::minibatch_dense>);
+        CAPTURE(cluster_count, batch_size, tolerance);
+
+        const auto data_rows = row_accessor<const float_t>(data).pull({ 0, cluster_count });
+        const auto initial_centroids =
+            homogen_table::wrap(data_rows.get_data(), cluster_count, data.get_column_count());
+
+        INFO("run mini-batch training");
+        const std::int64_t max_iteration_count = 100;
+        const auto desc =
+            get_descriptor(cluster_count, max_iteration_count, 0.0).set_batch_size(batch_size);
+        const auto result = this->train(desc, data, initial_centroids);
+
+        INFO("run Lloyd's training");
+        const auto ref_desc = kmeans::descriptor<float_t, kmeans::method::lloyd_dense, task_t>{}
+                                  .set_cluster_count(cluster_count)
+                                  .set_max_iteration_count(max_iteration_count);
+        const auto ref_result = this->train(ref_desc, data, initial_centroids);
+
+        REQUIRE(result.get_iteration_count() == max_iteration_count);
+        REQUIRE(check_value_with_ref_tol(result.get_objective_function_value(),
+                                         ref_result.get_objective_function_value(),
+                                         tolerance));
+    }
+
+    /// Splits the data into blocks and checks that the incremental training
+    /// gives the same centroids and cluster sizes as the sequential mini-batch
+    /// update of the reference centroids
+    void partial_train_checks(const table& data,
+                              std::int64_t cluster_count,
+                              std::int64_t block_count) {
+        static_assert(std::is_same_v<method_t, kmeans::method::minibatch_dense>);
+        CAPTURE(cluster_count, block_count);
+
+        const std::int64_t column_count = data.get_column_count();
+        const auto desc = get_descriptor(cluster_count);
+        const auto blocks =
+            te::split_table_by_rows<float_t>(this->get_policy(), data, block_count);
+
+        const auto data_rows = row_accessor<const float_t>(data).pull({ 0, cluster_count });
+        const auto initial_centroids =
+            homogen_table::wrap(data_rows.get_data(), cluster_count, column_count);
+        std::vector<double> ref_centroids(data_rows.get_data(),
+                                          data_rows.get_data() + data_rows.get_count());
+        std::vector<double> ref_sizes(cluster_count, 1.0);
+
+        INFO("run incremental training");
+        auto partial_result =
+            dal::partial_train(desc, model_t{}.set_centroids(initial_centroids), blocks[0]);
+        minibatch_update_reference(blocks[0], ref_centroids, ref_sizes);
+        for (std::size_t i = 1; i < blocks.size(); ++i) {
+            partial_result = dal::partial_train(desc, partial_result, blocks[i]);
+            minibatch_update_reference(blocks[i], ref_centroids, ref_sizes);
+        }
+
+        INFO("check cluster sizes");
+        const auto sizes = row_accessor<const double>(partial_result.get_cluster_sizes()).pull();
+        for (std::int64_t k = 0; k < cluster_count; ++k) {
+            REQUIRE(sizes[k] == ref_sizes[k]);
+        }
+
+        INFO("check centroids");
+        auto arr_ref = array<float_t>::empty(cluster_count * column_count);
+        std::copy(ref_centroids.begin(), ref_centroids.end(), arr_ref.get_mutable_data());
+        check_centroid_match_with_rel_tol(1e-4,
+                                          homogen_table::wrap(arr_ref, cluster_count, column_count),
+                                          partial_result.get_model().get_centroids());
+    }
+
+    /// Applies the mini-batch update to the reference centroids one observation
+    /// at a time, moving the closest centroid with the learning rate 1 / size.
+    /// The observations are assigned to the centroids before the update.
+    void minibatch_update_reference(const table& block,
+                                    std::vector<double>& centroids,
+                                    std::vector<double>& sizes) const {
+        const std::int64_t row_count = block.get_row_count();
+        const std::int64_t column_count = block.get_column_count();
+        const std::int64_t cluster_count = sizes.size();
+        const auto rows = row_accessor<const float_t>(block).pull();
+
+        std::vector<std::int64_t> assignments(row_count);
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            double min_dist = std::numeric_limits<double>::max();
+            for (std::int64_t k = 0; k < cluster_count; ++k) {
+                double dist = 0;
+                for (std::int64_t j = 0; j < column_count; ++j) {
+                    const double diff =
+                        rows[i * column_count + j] - centroids[k * column_count + j];
+                    dist += diff * diff;
+                }
+                if (dist < min_dist) {
+                    min_dist = dist;
+                    assignments[i] = k;
+                }
+            }
+        }
+
+        for (std::int64_t i = 0; i < row_count; ++i) {
+            const std::int64_t k = assignments[i];
+            sizes[k] += 1.0;
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                double& value = centroids[k * column_count + j];
+                value += (rows[i * column_count + j] - value) / sizes[k];
+            }
+        }
+    }
+
     void exact_checks(const table& data,
                       const table& initial_centroids,
                       const table& ref_centroids,
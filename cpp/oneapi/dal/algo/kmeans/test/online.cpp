@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/algo/kmeans/test/fixture.hpp"
+
+namespace oneapi::dal::kmeans::test {
+
+template <typename TestType>
+class kmeans_online_test : public kmeans_test<TestType, kmeans_online_test<TestType>> {};
+
+using kmeans_online_types = COMBINE_TYPES((float, double), (kmeans::method::minibatch_dense));
+
+TEMPLATE_LIST_TEST_M(kmeans_online_test,
+                     "kmeans partial_train matches sequential mini-batch update",
+                     "[kmeans][online]",
+                     kmeans_online_types) {
+    SKIP_IF(this->not_available_on_device());
+    SKIP_IF(this->not_float64_friendly());
+
+    const table data = blobs_dataset::get_data(3000, 3, 6).get_table(this->get_homogen_table_id());
+    const std::int64_t block_count = GENERATE(1, 4, 30);
+
+    this->partial_train_checks(data, 6, block_count);
+}
+
+} // namespace oneapi::dal::kmeans::test
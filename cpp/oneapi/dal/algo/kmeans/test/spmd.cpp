@@ -79,10 +79,13 @@ public:
             .set_objective_function_value(results[0].get_objective_function_value());
     }
 
-    void check_if_results_same_on_all_ranks() {
+    void check_if_results_same_on_all_ranks(bool use_initial_centroids = true) {
         const auto table_id = this->get_homogen_table_id();
         const auto data = gold_dataset::get_data().get_table(table_id);
-        const auto initial_centroids = gold_dataset::get_initial_centroids().get_table(table_id);
+        // Without the initial centroids every rank computes them from the data of all ranks
+        const auto initial_centroids =
+            use_initial_centroids ? gold_dataset::get_initial_centroids().get_table(table_id)
+                                  : table{};
 
         const std::int64_t cluster_count = gold_dataset::get_cluster_count();
         const std::int64_t max_iteration_count = 100;
@@ -130,20 +133,29 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "make sure results are the same on all ranks",
                      "[spmd][smoke]",
                      kmeans_types) {
-    // SPMD mode is not implemented for CPU. The following `SKIP_IF` should be
-    // removed once it's supported for CPU. The same for the rest of tests cases.
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(GENERATE(2, 4));
     this->check_if_results_same_on_all_ranks();
 }
 
+TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
+                     "make sure computed initial centroids are the same on all ranks",
+                     "[spmd][smoke]",
+                     kmeans_types) {
+    SKIP_IF(this->not_spmd_cpu_friendly());
+    SKIP_IF(this->not_float64_friendly());
+
+    this->set_rank_count(GENERATE(2, 4));
+    this->check_if_results_same_on_all_ranks(false);
+}
+
 TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed kmeans empty clusters test",
                      "[spmd][smoke]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(GENERATE(1, 2));
@@ -154,7 +166,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed kmeans smoke train/infer test",
                      "[spmd][smoke]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(GENERATE(1, 2));
@@ -165,7 +177,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed kmeans train/infer on gold data",
                      "[spmd][smoke]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(GENERATE(1, 2, 4, 8));
@@ -176,7 +188,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed kmeans block test",
                      "[spmd][block][nightly]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(GENERATE(1, 8));
@@ -187,7 +199,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed higgs: samples=1M, iters=3",
                      "[kmeans][spmd][higgs][external-dataset]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(10);
@@ -211,7 +223,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed susy: samples=0.5M, iters=10",
                      "[kmeans][nightly][spmd][susy][external-dataset]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(10);
@@ -235,7 +247,7 @@ TEMPLATE_LIST_TEST_M(kmeans_spmd_test,
                      "distributed epsilon: samples=80K, iters=2",
                      "[kmeans][nightly][spmd][epsilon][external-dataset]",
                      kmeans_types) {
-    SKIP_IF(this->get_policy().is_cpu());
+    SKIP_IF(this->not_spmd_cpu_friendly());
     SKIP_IF(this->not_float64_friendly());
 
     this->set_rank_count(10);
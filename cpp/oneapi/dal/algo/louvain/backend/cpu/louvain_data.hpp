@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/backend/memory.hpp"
 #include "oneapi/dal/backend/primitives/rng/rng_engine.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::preview::louvain::backend {
 using namespace oneapi::dal::preview::detail;
@@ -134,4 +135,196 @@ struct louvain_data {
     vertex_size_allocator_type& vertex_size_allocator;
 };
 
+/// Hash map from the communities to the sums of edge weights built on the storage
+/// of a single thread. The map iterates over the communities in the insertion order
+/// and `clear` resets only the used slots, so the storage is reused by the next vertex.
+template <typename IndexType, typename EdgeValue>
+class community_weight_map {
+public:
+    community_weight_map(IndexType* keys,
+                         EdgeValue* weights,
+                         std::int64_t* used_slots,
+                         std::int64_t capacity)
+            : keys_(keys),
+              weights_(weights),
+              used_slots_(used_slots),
+              mask_(capacity - 1),
+              size_(0) {}
+
+    void add(IndexType community, EdgeValue weight) {
+        std::int64_t slot = find_slot(community);
+        if (keys_[slot] == empty_key) {
+            keys_[slot] = community;
+            weights_[slot] = 0;
+            used_slots_[size_++] = slot;
+        }
+        weights_[slot] += weight;
+    }
+
+    EdgeValue get_weight(IndexType community) const {
+        const std::int64_t slot = find_slot(community);
+        return keys_[slot] == empty_key ? EdgeValue(0) : weights_[slot];
+    }
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+    IndexType get_community(std::int64_t index) const {
+        return keys_[used_slots_[index]];
+    }
+
+    EdgeValue get_weight_by_index(std::int64_t index) const {
+        return weights_[used_slots_[index]];
+    }
+
+    void clear() {
+        for (std::int64_t index = 0; index < size_; index++) {
+            keys_[used_slots_[index]] = empty_key;
+        }
+        size_ = 0;
+    }
+
+    static constexpr IndexType empty_key = -1;
+
+private:
+    std::int64_t find_slot(IndexType community) const {
+        std::int64_t slot = (static_cast<std::uint64_t>(community) * 0x9E3779B97F4A7C15ull) & mask_;
+        while (keys_[slot] != empty_key && keys_[slot] != community) {
+            slot = (slot + 1) & mask_;
+        }
+        return slot;
+    }
+
+    IndexType* keys_;
+    EdgeValue* weights_;
+    std::int64_t* used_slots_;
+    std::int64_t mask_;
+    std::int64_t size_;
+};
+
+/// Buffers of the parallel Louvain method. The buffers are allocated on the first use,
+/// so the object is cheap to construct when the sequential method is used.
+template <typename IndexType, typename EdgeValue>
+struct parallel_louvain_data {
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using vertex_size_type = std::int64_t;
+
+    using value_allocator_type = inner_alloc<value_type>;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+    using vertex_size_allocator_type = inner_alloc<vertex_size_type>;
+
+    parallel_louvain_data() = delete;
+    parallel_louvain_data(value_allocator_type& value_allocator,
+                          vertex_allocator_type& vertex_allocator,
+                          vertex_size_allocator_type& vertex_size_allocator)
+            : thread_count(dal::detail::threader_get_max_threads()),
+              vertex_count(0),
+              map_capacity(0),
+              value_allocator(value_allocator),
+              vertex_allocator(vertex_allocator),
+              vertex_size_allocator(vertex_size_allocator) {}
+
+    ~parallel_louvain_data() {
+        release_maps();
+        release_vertices();
+    }
+
+    /// Allocates the buffers for the graphs with up to `count` vertices
+    void reserve_vertices(std::int64_t count) {
+        if (count <= vertex_count) {
+            return;
+        }
+        release_vertices();
+        vertex_count = count;
+        target = allocate(vertex_allocator, vertex_count);
+        previous_labels = allocate(vertex_allocator, vertex_count);
+        colors = allocate(vertex_allocator, vertex_count);
+        color_order = allocate(vertex_allocator, vertex_count);
+        uncolored = allocate(vertex_allocator, vertex_count);
+        degrees = allocate(vertex_size_allocator, vertex_count + 1);
+        color_offsets = allocate(vertex_size_allocator, vertex_count + 1);
+    }
+
+    /// Makes the maps of all the threads able to store `entry_count` communities
+    void reserve_maps(std::int64_t entry_count) {
+        std::int64_t capacity = 16;
+        while (capacity < 2 * entry_count) {
+            capacity *= 2;
+        }
+        if (capacity <= map_capacity) {
+            return;
+        }
+        release_maps();
+        map_capacity = capacity;
+        const std::int64_t total_capacity = map_capacity * thread_count;
+        map_keys = allocate(vertex_allocator, total_capacity);
+        map_weights = allocate(value_allocator, total_capacity);
+        map_used_slots = allocate(vertex_size_allocator, total_capacity);
+        dal::detail::threader_for_int64(total_capacity, [&](std::int64_t index) {
+            map_keys[index] = community_weight_map<IndexType, EdgeValue>::empty_key;
+        });
+    }
+
+    /// Returns the map of the calling thread
+    community_weight_map<IndexType, EdgeValue> get_local_map() const {
+        const std::int64_t offset =
+            map_capacity * std::int64_t(dal::detail::threader_get_current_thread_index());
+        return community_weight_map<IndexType, EdgeValue>(map_keys + offset,
+                                                          map_weights + offset,
+                                                          map_used_slots + offset,
+                                                          map_capacity);
+    }
+
+    // Communities chosen by the vertices during a parallel sweep
+    vertex_type* target;
+    // Labels before the last parallel sweep
+    vertex_type* previous_labels;
+    // Colors of the vertices, adjacent vertices have different colors
+    vertex_type* colors;
+    // Vertices ordered by the colors
+    vertex_type* color_order;
+    // Vertices that are not colored yet
+    vertex_type* uncolored;
+    // Number of the neighboring communities of the aggregated vertices
+    vertex_size_type* degrees;
+    // Offsets of the colors in `color_order`
+    vertex_size_type* color_offsets;
+
+    vertex_type* map_keys;
+    value_type* map_weights;
+    vertex_size_type* map_used_slots;
+
+    const std::int64_t thread_count;
+    std::int64_t vertex_count;
+    std::int64_t map_capacity;
+
+    value_allocator_type& value_allocator;
+    vertex_allocator_type& vertex_allocator;
+    vertex_size_allocator_type& vertex_size_allocator;
+
+private:
+    void release_vertices() {
+        if (vertex_count > 0) {
+            deallocate(vertex_allocator, target, vertex_count);
+            deallocate(vertex_allocator, previous_labels, vertex_count);
+            deallocate(vertex_allocator, colors, vertex_count);
+            deallocate(vertex_allocator, color_order, vertex_count);
+            deallocate(vertex_allocator, uncolored, vertex_count);
+            deallocate(vertex_size_allocator, degrees, vertex_count + 1);
+            deallocate(vertex_size_allocator, color_offsets, vertex_count + 1);
+        }
+    }
+
+    void release_maps() {
+        if (map_capacity > 0) {
+            const std::int64_t total_capacity = map_capacity * thread_count;
+            deallocate(vertex_allocator, map_keys, total_capacity);
+            deallocate(value_allocator, map_weights, total_capacity);
+            deallocate(vertex_size_allocator, map_used_slots, total_capacity);
+        }
+    }
+};
+
 } // namespace oneapi::dal::preview::louvain::backend
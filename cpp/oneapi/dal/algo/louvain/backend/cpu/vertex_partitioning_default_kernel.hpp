@@ -177,6 +177,18 @@ inline Float init_step(const dal::preview::detail::topology<IndexType>& t,
     return modularity;
 }
 
+/// Fills `ld.random_order` with a random permutation of the vertices
+template <typename IndexType, typename EdgeValue>
+inline void shuffle_vertices(std::int64_t vertex_count, louvain_data<IndexType, EdgeValue>& ld) {
+    for (IndexType index = 0; index < vertex_count; index++) {
+        ld.random_order[index] = index;
+    }
+    ld.rn_gen.uniform(vertex_count, ld.index, ld.eng.get_state(), 0, vertex_count);
+    for (std::int64_t index = 0; index < vertex_count; ++index) {
+        std::swap(ld.random_order[index], ld.random_order[ld.index[index]]);
+    }
+}
+
 template <typename Cpu, typename Float, typename IndexType, typename EdgeValue>
 inline Float move_nodes(const dal::preview::detail::topology<IndexType>& t,
                         const EdgeValue* vals,
@@ -199,14 +211,7 @@ inline Float move_nodes(const dal::preview::detail::topology<IndexType>& t,
 
     // interate over all vertices
     Float old_modularity = modularity;
-    for (IndexType index = 0; index < t._vertex_count; index++) {
-        ld.random_order[index] = index;
-    }
-    // random shuffle
-    ld.rn_gen.uniform(t._vertex_count, ld.index, ld.eng.get_state(), 0, t._vertex_count);
-    for (std::int64_t index = 0; index < t._vertex_count; ++index) {
-        std::swap(ld.random_order[index], ld.random_order[ld.index[index]]);
-    }
+    shuffle_vertices(t._vertex_count, ld);
     std::int64_t empty_count = 0;
     do {
         old_modularity = modularity;
@@ -280,6 +285,450 @@ inline Float move_nodes(const dal::preview::detail::topology<IndexType>& t,
     return modularity;
 }
 
+/// Computes the totals of the communities and the modularity of the partition
+/// from the weighted degrees of the vertices
+template <typename Float, typename IndexType, typename EdgeValue>
+inline Float parallel_modularity(const dal::preview::detail::topology<IndexType>& t,
+                                 const EdgeValue* vals,
+                                 const EdgeValue* self_loops,
+                                 const IndexType* n2c,
+                                 const Float resolution,
+                                 louvain_data<IndexType, EdgeValue>& ld) {
+    const std::int64_t vertex_count = t._vertex_count;
+    for (std::int64_t c = 0; c < vertex_count; c++) {
+        ld.tot[c] = 0;
+        ld.community_size[c] = 0;
+    }
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        ld.tot[n2c[v]] += ld.k[v];
+        ld.community_size[n2c[v]]++;
+    }
+
+    // Sum of the weights of the edges inside the communities, each edge is counted once
+    const Float inner_weight = dal::detail::parallel_sum<Float>(vertex_count, [&](std::int64_t v) {
+        EdgeValue weight = self_loops[v];
+        for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+            const IndexType to = t._cols_ptr[index];
+            if (v < to && n2c[v] == n2c[to]) {
+                weight += vals[index];
+            }
+        }
+        return static_cast<Float>(weight);
+    });
+    const Float tot_squares = dal::detail::parallel_sum<Float>(vertex_count, [&](std::int64_t c) {
+        return static_cast<Float>(ld.tot[c]) * static_cast<Float>(ld.tot[c]);
+    });
+
+    const Float m = static_cast<Float>(ld.m);
+    return inner_weight / m - resolution * tot_squares / (static_cast<Float>(4) * m * m);
+}
+
+inline std::uint32_t coloring_priority(std::uint32_t v) {
+    v ^= v >> 16;
+    v *= 0x7feb352dU;
+    v ^= v >> 15;
+    v *= 0x846ca68bU;
+    v ^= v >> 16;
+    return v;
+}
+
+/// Colors the vertices so that adjacent vertices have different colors. At every round
+/// the uncolored vertices with the highest pseudo-random priority among their uncolored
+/// neighbors take the smallest color that is not used by the neighbors (Jones-Plassmann).
+/// The coloring depends only on the graph, so the method is deterministic.
+///
+/// @return The number of colors
+template <typename IndexType, typename EdgeValue>
+inline std::int64_t color_vertices(const dal::preview::detail::topology<IndexType>& t,
+                                   parallel_louvain_data<IndexType, EdgeValue>& pld) {
+    const std::int64_t vertex_count = t._vertex_count;
+    std::int64_t uncolored_count = vertex_count;
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        pld.colors[v] = -1;
+        pld.uncolored[v] = v;
+    }
+
+    const auto has_priority = [&](IndexType v, IndexType u) {
+        const std::uint32_t v_priority = coloring_priority(v);
+        const std::uint32_t u_priority = coloring_priority(u);
+        return v_priority > u_priority || (v_priority == u_priority && v > u);
+    };
+
+    while (uncolored_count > 0) {
+        // Select the independent set of the local maxima
+        dal::detail::threader_for(uncolored_count, uncolored_count, [&](std::int32_t i) {
+            const IndexType v = pld.uncolored[i];
+            bool is_local_max = true;
+            for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+                const IndexType u = t._cols_ptr[index];
+                if (u != v && pld.colors[u] == -1 && !has_priority(v, u)) {
+                    is_local_max = false;
+                    break;
+                }
+            }
+            // The targets are not used before the local moving, so they hold the selection
+            pld.target[v] = is_local_max;
+        });
+
+        // The selected vertices are not adjacent, so they are colored independently
+        dal::detail::threader_for(uncolored_count, uncolored_count, [&](std::int32_t i) {
+            const IndexType v = pld.uncolored[i];
+            if (!pld.target[v]) {
+                return;
+            }
+            auto used_colors = pld.get_local_map();
+            for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+                const IndexType color = pld.colors[t._cols_ptr[index]];
+                if (color != -1) {
+                    used_colors.add(color, 1);
+                }
+            }
+            IndexType color = 0;
+            while (used_colors.get_weight(color) != 0) {
+                color++;
+            }
+            used_colors.clear();
+            pld.colors[v] = color;
+        });
+
+        std::int64_t remaining_count = 0;
+        for (std::int64_t i = 0; i < uncolored_count; i++) {
+            const IndexType v = pld.uncolored[i];
+            if (pld.colors[v] == -1) {
+                pld.uncolored[remaining_count++] = v;
+            }
+        }
+        uncolored_count = remaining_count;
+    }
+
+    // Sort the vertices by the colors
+    const std::int64_t color_count =
+        dal::detail::parallel_max<std::int64_t>(vertex_count, -1, [&](std::int64_t v) {
+            return pld.colors[v];
+        }) +
+        1;
+    for (std::int64_t color = 0; color <= color_count; color++) {
+        pld.color_offsets[color] = 0;
+    }
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        pld.color_offsets[pld.colors[v] + 1]++;
+    }
+    for (std::int64_t color = 0; color < color_count; color++) {
+        pld.color_offsets[color + 1] += pld.color_offsets[color];
+    }
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        pld.color_order[pld.color_offsets[pld.colors[v]]++] = v;
+    }
+    for (std::int64_t color = color_count; color > 0; color--) {
+        pld.color_offsets[color] = pld.color_offsets[color - 1];
+    }
+    pld.color_offsets[0] = 0;
+    return color_count;
+}
+
+/// Local moving phase of the parallel Louvain method. The vertices of the same color
+/// are not adjacent, so they choose the best communities in parallel, and the moves
+/// are applied before the next color is processed. The sweep that decreases
+/// the modularity is rolled back.
+template <typename Cpu, typename Float, typename IndexType, typename EdgeValue>
+inline Float parallel_move_nodes(const dal::preview::detail::topology<IndexType>& t,
+                                 const EdgeValue* vals,
+                                 const EdgeValue* self_loops,
+                                 IndexType* n2c,
+                                 bool& changed,
+                                 const Float resolution,
+                                 const Float accuracy_threshold,
+                                 louvain_data<IndexType, EdgeValue>& ld,
+                                 parallel_louvain_data<IndexType, EdgeValue>& pld) {
+    const std::int64_t vertex_count = t._vertex_count;
+    pld.reserve_vertices(vertex_count);
+
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t v) {
+        EdgeValue k_v = self_loops[v] * 2;
+        for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+            k_v += vals[index];
+        }
+        ld.k[v] = k_v;
+    });
+    ld.m = dal::detail::parallel_sum<EdgeValue>(vertex_count, [&](std::int64_t v) {
+               return ld.k[v];
+           }) /
+           2;
+    ONEDAL_ASSERT(ld.m > 0);
+
+    const std::int64_t max_degree =
+        dal::detail::parallel_max<std::int64_t>(vertex_count, 0, [&](std::int64_t v) {
+            return t._rows_ptr[v + 1] - t._rows_ptr[v];
+        });
+    pld.reserve_maps(max_degree + 1);
+    const std::int64_t color_count = color_vertices(t, pld);
+
+    const Float m = static_cast<Float>(ld.m);
+    Float modularity = parallel_modularity<Float>(t, vals, self_loops, n2c, resolution, ld);
+    Float old_modularity = modularity;
+    do {
+        old_modularity = modularity;
+        for (std::int64_t v = 0; v < vertex_count; v++) {
+            pld.previous_labels[v] = n2c[v];
+        }
+
+        bool moved = false;
+        for (std::int64_t color = 0; color < color_count; color++) {
+            const std::int64_t color_begin = pld.color_offsets[color];
+            const std::int64_t color_size = pld.color_offsets[color + 1] - color_begin;
+            const IndexType* color_vertices = pld.color_order + color_begin;
+
+            dal::detail::threader_for(color_size, color_size, [&](std::int32_t i) {
+                const IndexType v = color_vertices[i];
+                auto neighbors = pld.get_local_map();
+                for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+                    neighbors.add(n2c[t._cols_ptr[index]], vals[index]);
+                }
+
+                const IndexType c_old = n2c[v];
+                const Float k_v = static_cast<Float>(ld.k[v]);
+                const Float scale = resolution * k_v / (static_cast<Float>(2) * m * m);
+                IndexType move_community = c_old;
+                Float best_delta = static_cast<Float>(neighbors.get_weight(c_old)) / m -
+                                   scale * (static_cast<Float>(ld.tot[c_old]) - k_v);
+                for (std::int64_t index = 0; index < neighbors.get_size(); index++) {
+                    const IndexType c = neighbors.get_community(index);
+                    const Float delta =
+                        static_cast<Float>(neighbors.get_weight_by_index(index)) / m -
+                        scale * static_cast<Float>(ld.tot[c]);
+                    if (c != c_old && best_delta < delta) {
+                        best_delta = delta;
+                        move_community = c;
+                    }
+                }
+                neighbors.clear();
+                pld.target[v] = move_community;
+            });
+
+            for (std::int64_t i = 0; i < color_size; i++) {
+                const IndexType v = color_vertices[i];
+                const IndexType c_old = n2c[v];
+                const IndexType c_new = pld.target[v];
+                if (c_new != c_old) {
+                    ld.tot[c_old] -= ld.k[v];
+                    ld.tot[c_new] += ld.k[v];
+                    n2c[v] = c_new;
+                    moved = true;
+                }
+            }
+        }
+        if (!moved) {
+            break;
+        }
+
+        modularity = parallel_modularity<Float>(t, vals, self_loops, n2c, resolution, ld);
+        if (modularity < old_modularity) {
+            for (std::int64_t v = 0; v < vertex_count; v++) {
+                n2c[v] = pld.previous_labels[v];
+            }
+            modularity = parallel_modularity<Float>(t, vals, self_loops, n2c, resolution, ld);
+            break;
+        }
+        changed = true;
+    } while (modularity - old_modularity > accuracy_threshold);
+
+    return modularity;
+}
+
+/// Aggregation phase of the parallel Louvain method. The edges of every community
+/// are accumulated in the hash map of a thread twice: the first pass counts
+/// the neighboring communities to compute the offsets of the rows, the second pass
+/// writes the rows. The neighbors are stored in the order of the first occurrence,
+/// so the aggregated graph is the same as the one built by `compress_graph`.
+template <typename IndexType, typename EdgeValue>
+inline void parallel_compress_graph(dal::preview::detail::topology<IndexType>& t,
+                                    EdgeValue* vals,
+                                    EdgeValue* self_loops,
+                                    const std::int64_t community_count,
+                                    const IndexType* partition,
+                                    louvain_data<IndexType, EdgeValue>& ld,
+                                    parallel_louvain_data<IndexType, EdgeValue>& pld) {
+    dal::detail::parallel_exclusive_scan<std::int64_t>(ld.community_size,
+                                                       community_count,
+                                                       ld.prefix_sum);
+    for (std::int64_t c = 0; c <= community_count; c++) {
+        ld.community_index[c] = ld.prefix_sum[c];
+    }
+    for (IndexType v = 0; v < t._vertex_count; v++) {
+        ld.c2v[ld.community_index[partition[v]]++] = v;
+    }
+
+    const std::int64_t max_entry_count =
+        dal::detail::parallel_max<std::int64_t>(community_count, 0, [&](std::int64_t c) {
+            std::int64_t edge_count = 0;
+            for (std::int64_t v_index = ld.prefix_sum[c]; v_index < ld.prefix_sum[c + 1];
+                 v_index++) {
+                const IndexType v = ld.c2v[v_index];
+                edge_count += t._rows_ptr[v + 1] - t._rows_ptr[v];
+            }
+            return std::min(edge_count, community_count);
+        });
+    pld.reserve_maps(max_entry_count);
+
+    const auto accumulate_community = [&](IndexType c,
+                                          community_weight_map<IndexType, EdgeValue>& neighbors) {
+        EdgeValue c_self_loops = 0;
+        for (std::int64_t v_index = ld.prefix_sum[c]; v_index < ld.prefix_sum[c + 1]; v_index++) {
+            const IndexType v = ld.c2v[v_index];
+            c_self_loops += self_loops[v];
+            for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+                const IndexType v_to = t._cols_ptr[index];
+                const IndexType c_to = partition[v_to];
+                if (c == c_to) {
+                    if (v < v_to) {
+                        c_self_loops += vals[index];
+                    }
+                }
+                else {
+                    neighbors.add(c_to, vals[index]);
+                }
+            }
+        }
+        return c_self_loops;
+    };
+
+    dal::detail::threader_for(community_count, community_count, [&](std::int32_t c) {
+        auto neighbors = pld.get_local_map();
+        ld.c_self_loops[c] = accumulate_community(c, neighbors);
+        pld.degrees[c] = neighbors.get_size();
+        neighbors.clear();
+    });
+    dal::detail::parallel_exclusive_scan<std::int64_t>(pld.degrees, community_count, ld.c_rows);
+
+    dal::detail::threader_for(community_count, community_count, [&](std::int32_t c) {
+        auto neighbors = pld.get_local_map();
+        accumulate_community(c, neighbors);
+        for (std::int64_t index = 0, c_index = ld.c_rows[c]; index < neighbors.get_size();
+             index++, c_index++) {
+            ld.c_cols[c_index] = neighbors.get_community(index);
+            ld.c_vals[c_index] = neighbors.get_weight_by_index(index);
+        }
+        neighbors.clear();
+    });
+
+    std::int64_t* t_rows = t._rows.get_mutable_data();
+    dal::detail::threader_for(community_count, community_count, [&](std::int32_t c) {
+        self_loops[c] = ld.c_self_loops[c];
+        t_rows[c + 1] = ld.c_rows[c + 1];
+    });
+    IndexType* t_cols = t._cols.get_mutable_data();
+    dal::detail::threader_for_int64(ld.c_rows[community_count], [&](std::int64_t index) {
+        t_cols[index] = ld.c_cols[index];
+        vals[index] = ld.c_vals[index];
+    });
+}
+
+/// Leiden refinement of the partition found by the local moving phase. Every vertex
+/// starts in its own refined community. A vertex that is still alone and is well connected
+/// to its community joins the well connected refined community of the same community
+/// with the largest positive modularity gain. A refined community `r` of community `c`
+/// is well connected if the weight of the edges between `r` and the rest of `c` is not
+/// less than `resolution * tot(r) * (tot(c) - tot(r)) / 2m`.
+///
+/// Requires the weighted degrees `ld.k` and the total weight `ld.m` of the graph
+/// computed by `move_nodes`.
+///
+/// @return The number of the refined communities, the refined labels are reindexed
+template <typename Float, typename IndexType, typename EdgeValue>
+inline std::int64_t refine_partition(const dal::preview::detail::topology<IndexType>& t,
+                                     const EdgeValue* vals,
+                                     const IndexType* partition,
+                                     const std::int64_t community_count,
+                                     IndexType* refined,
+                                     const Float resolution,
+                                     louvain_data<IndexType, EdgeValue>& ld) {
+    const std::int64_t vertex_count = t._vertex_count;
+    for (std::int64_t c = 0; c < community_count; c++) {
+        ld.k_c[c] = 0;
+    }
+    // ld.tot and ld.community_size describe the refined communities and
+    // ld.local_self_loops holds the weights of the edges from the refined communities
+    // to the rest of their communities
+    for (std::int64_t v = 0; v < vertex_count; v++) {
+        const IndexType c = partition[v];
+        ld.k_c[c] += ld.k[v];
+        refined[v] = v;
+        ld.tot[v] = ld.k[v];
+        ld.community_size[v] = 1;
+        EdgeValue external_weight = 0;
+        for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+            const IndexType to = t._cols_ptr[index];
+            if (to != v && partition[to] == c) {
+                external_weight += vals[index];
+            }
+        }
+        ld.local_self_loops[v] = external_weight;
+    }
+
+    const Float m = static_cast<Float>(ld.m);
+    const auto is_well_connected = [&](EdgeValue external_weight, Float tot, Float tot_c) {
+        return static_cast<Float>(external_weight) >=
+               resolution * tot * (tot_c - tot) / (static_cast<Float>(2) * m);
+    };
+
+    shuffle_vertices(vertex_count, ld);
+    for (std::int64_t order_index = 0; order_index < vertex_count; order_index++) {
+        const IndexType v = ld.random_order[order_index];
+        const IndexType r_old = refined[v];
+        if (ld.community_size[r_old] != 1) {
+            continue;
+        }
+        const IndexType c = partition[v];
+        const Float k_v = static_cast<Float>(ld.k[v]);
+        const Float tot_c = static_cast<Float>(ld.k_c[c]);
+        const EdgeValue v_external_weight = ld.local_self_loops[r_old];
+        if (!is_well_connected(v_external_weight, k_v, tot_c)) {
+            continue;
+        }
+
+        std::int64_t neighbor_count = 0;
+        for (std::int64_t index = t._rows_ptr[v]; index < t._rows_ptr[v + 1]; index++) {
+            const IndexType to = t._cols_ptr[index];
+            if (to == v || partition[to] != c) {
+                continue;
+            }
+            const IndexType r = refined[to];
+            if (ld.k_vertex_to[r] == 0) {
+                ld.neighboring_communities[neighbor_count++] = r;
+            }
+            ld.k_vertex_to[r] += vals[index];
+        }
+
+        IndexType r_new = r_old;
+        EdgeValue k_v_new = 0;
+        Float best_delta = 0;
+        for (std::int64_t index = 0; index < neighbor_count; index++) {
+            const IndexType r = ld.neighboring_communities[index];
+            const Float tot_r = static_cast<Float>(ld.tot[r]);
+            const Float delta = static_cast<Float>(ld.k_vertex_to[r]) / m -
+                                resolution * k_v * tot_r / (static_cast<Float>(2) * m * m);
+            if (best_delta < delta && is_well_connected(ld.local_self_loops[r], tot_r, tot_c)) {
+                best_delta = delta;
+                r_new = r;
+                k_v_new = ld.k_vertex_to[r];
+            }
+        }
+        for (std::int64_t index = 0; index < neighbor_count; index++) {
+            ld.k_vertex_to[ld.neighboring_communities[index]] = 0;
+        }
+
+        if (r_new != r_old) {
+            ld.local_self_loops[r_new] += v_external_weight - 2 * k_v_new;
+            ld.tot[r_new] += ld.k[v];
+            ld.community_size[r_new]++;
+            ld.community_size[r_old]--;
+            refined[v] = r_new;
+        }
+    }
+
+    return reindex_communities(refined, ld.community_size, vertex_count, ld.index);
+}
+
 template <typename IndexType, typename CommunityVector, typename SizeVector>
 inline void set_result_labels(CommunityVector& communities,
                               const SizeVector& vertex_size,
@@ -309,7 +758,131 @@ inline void set_result_labels(CommunityVector& communities,
     }
 }
 
-template <typename Cpu, typename Float, typename EdgeValue>
+/// The copy of the input graph that is aggregated level by level and the labels
+/// of the levels. The labels of a level map the vertices of the level to
+/// the vertices of the next level, the labels of the last level are the communities.
+template <typename EdgeValue>
+struct louvain_levels {
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using vertex_size_type = std::int64_t;
+    using vertex_pointer_type = vertex_type*;
+
+    using value_allocator_type = inner_alloc<value_type>;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+    using vertex_size_allocator_type = inner_alloc<vertex_size_type>;
+    using vertex_pointer_allocator_type = inner_alloc<vertex_pointer_type>;
+
+    using v1s_t = vector_container<vertex_size_type, vertex_size_allocator_type>;
+    using v1p_t = vector_container<vertex_pointer_type, vertex_pointer_allocator_type>;
+
+    louvain_levels(const dal::preview::detail::topology<vertex_type>& t,
+                   const value_type* vals,
+                   byte_alloc_iface* alloc_ptr)
+            : vertex_allocator(alloc_ptr),
+              vertex_size_allocator(alloc_ptr),
+              value_allocator(alloc_ptr),
+              vp_a(alloc_ptr),
+              vertex_count(t.get_vertex_count()),
+              edge_count(t.get_edge_count()),
+              ld(vertex_count,
+                 edge_count,
+                 value_allocator,
+                 vertex_allocator,
+                 vertex_size_allocator),
+              communities(vp_a),
+              vertex_size(vertex_size_allocator) {
+        current_topology_rows = allocate(vertex_size_allocator, vertex_count + 1);
+        current_topology_cols = allocate(vertex_allocator, edge_count * 2);
+        current_vals = allocate(value_allocator, edge_count * 2);
+        current_self_loops = allocate(value_allocator, edge_count * 2);
+
+        current_topology.set_topology(vertex_count,
+                                      edge_count,
+                                      current_topology_rows,
+                                      current_topology_cols,
+                                      edge_count * 2,
+                                      nullptr);
+
+        current_topology_rows[0] = t._rows_ptr[0];
+        for (std::int64_t index = 0; index < vertex_count; index++) {
+            current_topology_rows[index + 1] = t._rows_ptr[index + 1];
+            current_self_loops[index] = 0;
+        }
+        for (std::int64_t index = 0; index < edge_count * 2; index++) {
+            current_topology_cols[index] = t._cols_ptr[index];
+            current_vals[index] = vals[index];
+        }
+    }
+
+    ~louvain_levels() {
+        deallocate(vertex_size_allocator, current_topology_rows, vertex_count + 1);
+        deallocate(vertex_allocator, current_topology_cols, edge_count * 2);
+        deallocate(value_allocator, current_vals, edge_count * 2);
+        deallocate(value_allocator, current_self_loops, edge_count * 2);
+        for (std::int64_t level = 0; level < communities.size(); level++) {
+            deallocate(vertex_allocator, communities[level], vertex_size[level]);
+        }
+    }
+
+    /// Allocates the labels of the first level filled with the initial partition
+    vertex_type* allocate_initial_labels(const vertex_type* init_partition) {
+        vertex_type* labels = allocate(vertex_allocator, vertex_count);
+        if (init_partition != nullptr) {
+            for (std::int64_t v = 0; v < vertex_count; v++) {
+                labels[v] = init_partition[v];
+            }
+        }
+        else {
+            singleton_partition(labels, vertex_count);
+        }
+        return labels;
+    }
+
+    /// Takes the ownership of the labels of the level with `level_vertex_count` vertices
+    void push_level(vertex_type* labels, std::int64_t level_vertex_count) {
+        communities.push_back(labels);
+        vertex_size.push_back(level_vertex_count);
+    }
+
+    template <typename Float>
+    vertex_partitioning_result<task::vertex_partitioning> get_result(
+        const vertex_type* init_partition,
+        const Float modularity,
+        const std::int64_t community_count) {
+        auto labels_arr = array<vertex_type>::empty(vertex_count);
+        vertex_type* labels = labels_arr.get_mutable_data();
+        set_result_labels(communities, vertex_size, init_partition, vertex_count, labels);
+
+        return vertex_partitioning_result<task::vertex_partitioning>()
+            .set_labels(dal::detail::homogen_table_builder{}
+                            .reset(labels_arr, vertex_count, 1)
+                            .build())
+            .set_modularity(static_cast<double>(modularity))
+            .set_community_count(community_count);
+    }
+
+    vertex_allocator_type vertex_allocator;
+    vertex_size_allocator_type vertex_size_allocator;
+    value_allocator_type value_allocator;
+    vertex_pointer_allocator_type vp_a;
+
+    const std::int64_t vertex_count;
+    const std::int64_t edge_count;
+
+    dal::preview::detail::topology<vertex_type> current_topology;
+    vertex_size_type* current_topology_rows;
+    vertex_type* current_topology_cols;
+    value_type* current_vals;
+    value_type* current_self_loops;
+
+    louvain_data<vertex_type, value_type> ld;
+
+    v1p_t communities;
+    v1s_t vertex_size;
+};
+
+template <typename Cpu, typename Float, typename EdgeValue, typename Method>
 struct louvain_kernel {
     vertex_partitioning_result<task::vertex_partitioning> operator()(
         const detail::descriptor_base<task::vertex_partitioning>& desc,
@@ -317,142 +890,170 @@ struct louvain_kernel {
         const std::int32_t* init_partition,
         const EdgeValue* vals,
         byte_alloc_iface* alloc_ptr) {
-        {
-            using value_type = EdgeValue;
-            using vertex_type = std::int32_t;
-            using vertex_size_type = std::int64_t;
-            using vertex_pointer_type = vertex_type*;
-
-            using value_allocator_type = inner_alloc<value_type>;
-            using vertex_allocator_type = inner_alloc<vertex_type>;
-            using vertex_size_allocator_type = inner_alloc<vertex_size_type>;
-            using vertex_pointer_allocator_type = inner_alloc<vertex_pointer_type>;
-
-            using v1s_t = vector_container<vertex_size_type, vertex_size_allocator_type>;
-            using v1p_t = vector_container<vertex_pointer_type, vertex_pointer_allocator_type>;
-
-            vertex_allocator_type vertex_allocator(alloc_ptr);
-            vertex_size_allocator_type vertex_size_allocator(alloc_ptr);
-            value_allocator_type value_allocator(alloc_ptr);
-            vertex_pointer_allocator_type vp_a(alloc_ptr);
-
-            const Float resolution = static_cast<Float>(desc.get_resolution());
-            const Float accuracy_threshold = static_cast<Float>(desc.get_accuracy_threshold());
-            const std::int64_t max_iteration_count = desc.get_max_iteration_count();
-
-            const std::int64_t vertex_count = t.get_vertex_count();
-            const std::int64_t edge_count = t.get_edge_count();
-            dal::preview::detail::topology<vertex_type> current_topology;
-
-            vertex_size_type* current_topology_rows =
-                allocate(vertex_size_allocator, vertex_count + 1);
-            vertex_type* current_topology_cols = allocate(vertex_allocator, edge_count * 2);
-            value_type* current_vals = allocate(value_allocator, edge_count * 2);
-            value_type* current_self_loops = allocate(value_allocator, edge_count * 2);
-
-            current_topology.set_topology(vertex_count,
-                                          edge_count,
-                                          current_topology_rows,
-                                          current_topology_cols,
-                                          edge_count * 2,
-                                          nullptr);
-
-            current_topology_rows[0] = t._rows_ptr[0];
-            for (std::int64_t index = 0; index < vertex_count; index++) {
-                current_topology_rows[index + 1] = t._rows_ptr[index + 1];
-                current_self_loops[index] = 0;
-            }
-            for (std::int64_t index = 0; index < edge_count * 2; index++) {
-                current_topology_cols[index] = t._cols_ptr[index];
-                current_vals[index] = vals[index];
-            }
-
-            louvain_data<vertex_type, value_type> ld(vertex_count,
-                                                     edge_count,
-                                                     value_allocator,
-                                                     vertex_allocator,
-                                                     vertex_size_allocator);
-
-            v1p_t communities(vp_a);
-            v1s_t labels_size(vertex_size_allocator);
-            v1s_t vertex_size(vertex_size_allocator);
-
-            Float modularity = std::numeric_limits<Float>::min();
-            vertex_type* labels = allocate(vertex_allocator, vertex_count);
-            if (init_partition != nullptr) {
-                for (std::int64_t v = 0; v < vertex_count; v++) {
-                    labels[v] = init_partition[v];
-                }
+        using vertex_type = std::int32_t;
+
+        const Float resolution = static_cast<Float>(desc.get_resolution());
+        const Float accuracy_threshold = static_cast<Float>(desc.get_accuracy_threshold());
+        const std::int64_t max_iteration_count = desc.get_max_iteration_count();
+
+        louvain_levels<EdgeValue> levels(t, vals, alloc_ptr);
+        auto& current_topology = levels.current_topology;
+        auto& ld = levels.ld;
+        parallel_louvain_data<vertex_type, EdgeValue> pld(levels.value_allocator,
+                                                          levels.vertex_allocator,
+                                                          levels.vertex_size_allocator);
+
+        Float modularity = std::numeric_limits<Float>::min();
+        vertex_type* labels = levels.allocate_initial_labels(init_partition);
+
+        bool allocate_labels = false;
+        for (std::int64_t iteration = 0; iteration < max_iteration_count || !max_iteration_count;
+             iteration++) {
+            if (allocate_labels) {
+                labels = allocate(levels.vertex_allocator, current_topology._vertex_count);
+                singleton_partition(labels, current_topology._vertex_count);
             }
-            else {
-                singleton_partition(labels, vertex_count);
+            allocate_labels = true;
+            bool changed = false;
+            if constexpr (std::is_same_v<Method, method::parallel>) {
+                modularity = parallel_move_nodes<Cpu, Float>(current_topology,
+                                                             levels.current_vals,
+                                                             levels.current_self_loops,
+                                                             labels,
+                                                             changed,
+                                                             resolution,
+                                                             accuracy_threshold,
+                                                             ld,
+                                                             pld);
             }
-
-            bool allocate_labels = false;
-            for (std::int64_t iteration = 0;
-                 iteration < max_iteration_count || !max_iteration_count;
-                 iteration++) {
-                if (allocate_labels) {
-                    labels = allocate(vertex_allocator, current_topology._vertex_count);
-                    singleton_partition(labels, current_topology._vertex_count);
-                }
-                allocate_labels = true;
-                bool changed = false;
+            else {
                 modularity = move_nodes<Cpu, Float>(current_topology,
-                                                    current_vals,
-                                                    current_self_loops,
+                                                    levels.current_vals,
+                                                    levels.current_self_loops,
                                                     labels,
                                                     changed,
                                                     resolution,
                                                     accuracy_threshold,
                                                     ld);
+            }
 
-                if (!changed) {
-                    deallocate(vertex_allocator, labels, current_topology._vertex_count);
-                    break;
-                }
-                std::int64_t community_count = reindex_communities(labels,
-                                                                   ld.community_size,
-                                                                   current_topology._vertex_count,
-                                                                   ld.index);
+            if (!changed) {
+                deallocate(levels.vertex_allocator, labels, current_topology._vertex_count);
+                break;
+            }
+            std::int64_t community_count = reindex_communities(labels,
+                                                               ld.community_size,
+                                                               current_topology._vertex_count,
+                                                               ld.index);
 
+            if constexpr (std::is_same_v<Method, method::parallel>) {
+                parallel_compress_graph(current_topology,
+                                        levels.current_vals,
+                                        levels.current_self_loops,
+                                        community_count,
+                                        labels,
+                                        ld,
+                                        pld);
+            }
+            else {
                 compress_graph(current_topology,
-                               current_vals,
-                               current_self_loops,
+                               levels.current_vals,
+                               levels.current_self_loops,
                                community_count,
                                labels,
                                ld);
-                labels_size.push_back(community_count);
-                vertex_size.push_back(current_topology._vertex_count);
-                communities.push_back(labels);
-                current_topology._vertex_count = community_count;
-            }
-
-            auto labels_arr = array<vertex_type>::empty(vertex_count);
-            vertex_type* labels_ = labels_arr.get_mutable_data();
-            set_result_labels(communities, vertex_size, init_partition, vertex_count, labels_);
-
-            deallocate(vertex_size_allocator, current_topology_rows, vertex_count + 1);
-            deallocate(vertex_allocator, current_topology_cols, edge_count * 2);
-            deallocate(value_allocator, current_vals, edge_count * 2);
-            deallocate(value_allocator, current_self_loops, edge_count * 2);
-
-            if (communities.size() > 0) {
-                deallocate(vertex_allocator, communities[0], vertex_count);
-                for (int64_t iteration = 1; iteration < communities.size(); iteration++) {
-                    deallocate(vertex_allocator,
-                               communities[iteration],
-                               labels_size[iteration - 1]);
-                }
             }
+            levels.push_level(labels, current_topology._vertex_count);
+            current_topology._vertex_count = community_count;
+        }
+
+        return levels.get_result(init_partition, modularity, current_topology._vertex_count);
+    }
+};
 
-            return vertex_partitioning_result<task::vertex_partitioning>()
-                .set_labels(dal::detail::homogen_table_builder{}
-                                .reset(labels_arr, t.get_vertex_count(), 1)
-                                .build())
-                .set_modularity(static_cast<double>(modularity))
-                .set_community_count(current_topology._vertex_count);
+/// Louvain method with the Leiden refinement. Every level aggregates the graph by
+/// the refined communities, and the aggregated vertices start the next level in
+/// the communities found by the local moving phase.
+template <typename Cpu, typename Float, typename EdgeValue>
+struct louvain_kernel<Cpu, Float, EdgeValue, method::leiden> {
+    vertex_partitioning_result<task::vertex_partitioning> operator()(
+        const detail::descriptor_base<task::vertex_partitioning>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const std::int32_t* init_partition,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using vertex_type = std::int32_t;
+
+        const Float resolution = static_cast<Float>(desc.get_resolution());
+        const Float accuracy_threshold = static_cast<Float>(desc.get_accuracy_threshold());
+        const std::int64_t max_iteration_count = desc.get_max_iteration_count();
+
+        louvain_levels<EdgeValue> levels(t, vals, alloc_ptr);
+        auto& current_topology = levels.current_topology;
+        auto& ld = levels.ld;
+
+        Float modularity = std::numeric_limits<Float>::min();
+        vertex_type* labels = levels.allocate_initial_labels(init_partition);
+
+        std::int64_t community_count = levels.vertex_count;
+        for (std::int64_t iteration = 0; iteration < max_iteration_count || !max_iteration_count;
+             iteration++) {
+            const std::int64_t level_vertex_count = current_topology._vertex_count;
+            bool changed = false;
+            modularity = move_nodes<Cpu, Float>(current_topology,
+                                                levels.current_vals,
+                                                levels.current_self_loops,
+                                                labels,
+                                                changed,
+                                                resolution,
+                                                accuracy_threshold,
+                                                ld);
+            community_count =
+                reindex_communities(labels, ld.community_size, level_vertex_count, ld.index);
+
+            vertex_type* refined = allocate(levels.vertex_allocator, level_vertex_count);
+            const std::int64_t refined_count = refine_partition<Float>(current_topology,
+                                                                       levels.current_vals,
+                                                                       labels,
+                                                                       community_count,
+                                                                       refined,
+                                                                       resolution,
+                                                                       ld);
+            if (refined_count == level_vertex_count) {
+                // Nothing to aggregate, the communities of the local moving phase are not
+                // guaranteed to be connected, so the level ends with the refined partition
+                modularity = parallel_modularity<Float>(current_topology,
+                                                        levels.current_vals,
+                                                        levels.current_self_loops,
+                                                        refined,
+                                                        resolution,
+                                                        ld);
+                deallocate(levels.vertex_allocator, labels, level_vertex_count);
+                labels = refined;
+                community_count = refined_count;
+                break;
+            }
+
+            compress_graph(current_topology,
+                           levels.current_vals,
+                           levels.current_self_loops,
+                           refined_count,
+                           refined,
+                           ld);
+
+            vertex_type* next_labels = allocate(levels.vertex_allocator, refined_count);
+            for (std::int64_t v = 0; v < level_vertex_count; v++) {
+                next_labels[refined[v]] = labels[v];
+            }
+            deallocate(levels.vertex_allocator, labels, level_vertex_count);
+
+            levels.push_level(refined, level_vertex_count);
+            labels = next_labels;
+            current_topology._vertex_count = refined_count;
         }
+        levels.push_level(labels, current_topology._vertex_count);
+
+        return levels.get_result(init_partition, modularity, community_count);
     }
 };
 
@@ -19,12 +19,19 @@
 
 namespace oneapi::dal::preview::louvain::backend {
 
-template struct louvain_kernel<__CPU_TAG__, float, std::int32_t>;
+template struct louvain_kernel<__CPU_TAG__, float, std::int32_t, method::fast>;
+template struct louvain_kernel<__CPU_TAG__, float, double, method::fast>;
+template struct louvain_kernel<__CPU_TAG__, double, std::int32_t, method::fast>;
+template struct louvain_kernel<__CPU_TAG__, double, double, method::fast>;
 
-template struct louvain_kernel<__CPU_TAG__, float, double>;
+template struct louvain_kernel<__CPU_TAG__, float, std::int32_t, method::parallel>;
+template struct louvain_kernel<__CPU_TAG__, float, double, method::parallel>;
+template struct louvain_kernel<__CPU_TAG__, double, std::int32_t, method::parallel>;
+template struct louvain_kernel<__CPU_TAG__, double, double, method::parallel>;
 
-template struct louvain_kernel<__CPU_TAG__, double, std::int32_t>;
-
-template struct louvain_kernel<__CPU_TAG__, double, double>;
+template struct louvain_kernel<__CPU_TAG__, float, std::int32_t, method::leiden>;
+template struct louvain_kernel<__CPU_TAG__, float, double, method::leiden>;
+template struct louvain_kernel<__CPU_TAG__, double, std::int32_t, method::leiden>;
+template struct louvain_kernel<__CPU_TAG__, double, double, method::leiden>;
 
 } // namespace oneapi::dal::preview::louvain::backend
@@ -28,7 +28,15 @@ using by_default = vertex_partitioning;
 } // namespace task
 
 namespace method {
+/// Sequential local moving of the vertices in a random order
 struct fast {};
+/// Local moving of the vertices in parallel and parallel aggregation of the communities.
+/// The modularity may differ from the one of the sequential method within the accuracy
+/// of the local moving phase.
+struct parallel {};
+/// Sequential local moving followed by the Leiden refinement of the communities
+/// before the aggregation, so every community in the result is connected
+struct leiden {};
 using by_default = fast;
 } // namespace method
 
@@ -39,7 +47,8 @@ template <typename Task>
 class descriptor_impl;
 
 template <typename Method>
-constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::fast>;
+constexpr bool is_valid_method =
+    dal::detail::is_one_of_v<Method, method::fast, method::parallel, method::leiden>;
 
 template <typename Task>
 constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::vertex_partitioning>;
@@ -20,44 +20,46 @@
 
 namespace oneapi::dal::preview::louvain::detail {
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename Method>
 vertex_partitioning_result<task::vertex_partitioning> louvain_kernel<
     Float,
     task::vertex_partitioning,
     dal::preview::detail::topology<std::int32_t>,
-    EdgeValue>::operator()(const dal::detail::host_policy &policy,
-                           const detail::descriptor_base<task::vertex_partitioning> &desc,
-                           const dal::preview::detail::topology<std::int32_t> &t,
-                           const std::int32_t *init_partition,
-                           const EdgeValue *vals,
-                           byte_alloc_iface *alloc_ptr) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
-        return backend::louvain_kernel<decltype(cpu), Float, EdgeValue>{}(desc,
-                                                                          t,
-                                                                          init_partition,
-                                                                          vals,
-                                                                          alloc_ptr);
+    EdgeValue,
+    Method>::operator()(const dal::detail::host_policy &policy,
+                        const detail::descriptor_base<task::vertex_partitioning> &desc,
+                        const dal::preview::detail::topology<std::int32_t> &t,
+                        const std::int32_t *init_partition,
+                        const EdgeValue *vals,
+                        byte_alloc_iface *alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        return backend::louvain_kernel<decltype(cpu), Float, EdgeValue, Method>{}(desc,
+                                                                                  t,
+                                                                                  init_partition,
+                                                                                  vals,
+                                                                                  alloc_ptr);
     });
 }
 
-template struct ONEDAL_EXPORT louvain_kernel<float,
-                                             task::vertex_partitioning,
-                                             dal::preview::detail::topology<std::int32_t>,
-                                             std::int32_t>;
+#define INSTANTIATE(F, V, M)                                                  \
+    template struct ONEDAL_EXPORT                                             \
+        louvain_kernel<F,                                                     \
+                       task::vertex_partitioning,                             \
+                       dal::preview::detail::topology<std::int32_t>,          \
+                       V,                                                     \
+                       M>;
 
-template struct ONEDAL_EXPORT louvain_kernel<float,
-                                             task::vertex_partitioning,
-                                             dal::preview::detail::topology<std::int32_t>,
-                                             double>;
-
-template struct ONEDAL_EXPORT louvain_kernel<double,
-                                             task::vertex_partitioning,
-                                             dal::preview::detail::topology<std::int32_t>,
-                                             std::int32_t>;
-
-template struct ONEDAL_EXPORT louvain_kernel<double,
-                                             task::vertex_partitioning,
-                                             dal::preview::detail::topology<std::int32_t>,
-                                             double>;
+INSTANTIATE(float, std::int32_t, method::fast)
+INSTANTIATE(float, double, method::fast)
+INSTANTIATE(double, std::int32_t, method::fast)
+INSTANTIATE(double, double, method::fast)
+INSTANTIATE(float, std::int32_t, method::parallel)
+INSTANTIATE(float, double, method::parallel)
+INSTANTIATE(double, std::int32_t, method::parallel)
+INSTANTIATE(double, double, method::parallel)
+INSTANTIATE(float, std::int32_t, method::leiden)
+INSTANTIATE(float, double, method::leiden)
+INSTANTIATE(double, std::int32_t, method::leiden)
+INSTANTIATE(double, double, method::leiden)
 
 } // namespace oneapi::dal::preview::louvain::detail
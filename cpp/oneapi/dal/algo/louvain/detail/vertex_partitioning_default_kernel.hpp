@@ -47,11 +47,12 @@ struct louvain_kernel {
                                                 byte_alloc_iface *alloc) const;
 };
 
-template <typename Float, typename EdgeValue>
+template <typename Float, typename EdgeValue, typename Method>
 struct louvain_kernel<Float,
                       task::vertex_partitioning,
                       dal::preview::detail::topology<std::int32_t>,
-                      EdgeValue> {
+                      EdgeValue,
+                      Method> {
     vertex_partitioning_result<task::vertex_partitioning> operator()(
         const dal::detail::host_policy &ctx,
         const detail::descriptor_base<task::vertex_partitioning> &desc,
@@ -61,12 +62,8 @@ struct louvain_kernel<Float,
         byte_alloc_iface *alloc) const;
 };
 
-template <typename Float, typename Allocator, typename Graph>
-struct vertex_partitioning_kernel_cpu<Float,
-                                      method::fast,
-                                      task::vertex_partitioning,
-                                      Allocator,
-                                      Graph> {
+template <typename Float, typename Method, typename Allocator, typename Graph>
+struct vertex_partitioning_kernel_cpu<Float, Method, task::vertex_partitioning, Allocator, Graph> {
     inline vertex_partitioning_result<task::vertex_partitioning> operator()(
         const dal::detail::host_policy &ctx,
         const detail::descriptor_base<task::vertex_partitioning> &desc,
@@ -113,7 +110,11 @@ struct vertex_partitioning_kernel_cpu<Float,
         }
         const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
         alloc_connector<Allocator> alloc_con(alloc);
-        return louvain_kernel<Float, task::vertex_partitioning, topology_type, value_type>{}(
+        return louvain_kernel<Float,
+                              task::vertex_partitioning,
+                              topology_type,
+                              value_type,
+                              Method>{}(
             ctx,
             desc,
             t,
@@ -304,13 +304,13 @@ public:
         REQUIRE(correct_labels_count == graph_data.vertex_count);
     }
 
-    template <typename EdgeValueType>
+    template <typename EdgeValueType, typename Method = dal::preview::louvain::method::by_default>
     void check_louvain(const graph_base_data& graph_data,
                        std::vector<EdgeValueType>& weights,
                        std::vector<std::int32_t>& expected_labels,
                        std::int64_t expected_community_count) {
         const auto graph = create_graph<EdgeValueType>(graph_data, weights);
-        const auto louvain_desc = dal::preview::louvain::descriptor<>();
+        const auto louvain_desc = dal::preview::louvain::descriptor<float, Method>();
         const auto result = dal::preview::vertex_partitioning(louvain_desc, graph);
         check_result_correctness(graph_data, result, expected_labels, expected_community_count);
     }
@@ -327,6 +327,101 @@ public:
         check_result_correctness(graph_data, result, expected_labels, expected_community_count);
     }
 
+    template <typename EdgeValueType>
+    void check_parallel_modularity(const graph_base_data& graph_data,
+                                   std::vector<EdgeValueType>& weights,
+                                   double modularity_tolerance) {
+        const auto graph = create_graph<EdgeValueType>(graph_data, weights);
+        const auto sequential_result =
+            dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(), graph);
+        const auto parallel_result = dal::preview::vertex_partitioning(
+            dal::preview::louvain::descriptor<float, dal::preview::louvain::method::parallel>(),
+            graph);
+
+        UNSCOPED_INFO("Modularity is NaN");
+        REQUIRE(!std::isnan(parallel_result.get_modularity()));
+        UNSCOPED_INFO("Modularity of the parallel method is too small");
+        REQUIRE(parallel_result.get_modularity() >=
+                sequential_result.get_modularity() - modularity_tolerance);
+
+        const std::int64_t community_count = parallel_result.get_community_count();
+        const auto result_table = parallel_result.get_labels();
+        REQUIRE(result_table.get_row_count() == graph_data.vertex_count);
+        auto table_data = oneapi::dal::row_accessor<const std::int32_t>(result_table).pull();
+        const auto result_labels = table_data.get_data();
+        std::vector<std::int64_t> community_sizes(community_count, 0);
+        for (std::int64_t u = 0; u < graph_data.vertex_count; ++u) {
+            REQUIRE(result_labels[u] >= 0);
+            REQUIRE(result_labels[u] < community_count);
+            community_sizes[result_labels[u]]++;
+        }
+        UNSCOPED_INFO("Labels are not consecutive");
+        for (std::int64_t c = 0; c < community_count; ++c) {
+            REQUIRE(community_sizes[c] > 0);
+        }
+    }
+
+    template <typename EdgeValueType>
+    void check_leiden_communities(const graph_base_data& graph_data,
+                                  std::vector<EdgeValueType>& weights,
+                                  double modularity_tolerance) {
+        const auto graph = create_graph<EdgeValueType>(graph_data, weights);
+        const auto louvain_result =
+            dal::preview::vertex_partitioning(dal::preview::louvain::descriptor<>(), graph);
+        const auto leiden_result = dal::preview::vertex_partitioning(
+            dal::preview::louvain::descriptor<float, dal::preview::louvain::method::leiden>(),
+            graph);
+
+        UNSCOPED_INFO("Modularity is NaN");
+        REQUIRE(!std::isnan(leiden_result.get_modularity()));
+        UNSCOPED_INFO("Modularity of the Leiden method is too small");
+        REQUIRE(leiden_result.get_modularity() >=
+                louvain_result.get_modularity() - modularity_tolerance);
+
+        const std::int64_t vertex_count = graph_data.vertex_count;
+        const std::int64_t community_count = leiden_result.get_community_count();
+        const auto result_table = leiden_result.get_labels();
+        REQUIRE(result_table.get_row_count() == vertex_count);
+        auto table_data = oneapi::dal::row_accessor<const std::int32_t>(result_table).pull();
+        const auto result_labels = table_data.get_data();
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            REQUIRE(result_labels[u] >= 0);
+            REQUIRE(result_labels[u] < community_count);
+        }
+
+        // Each community must be reached from one of its vertices by a breadth-first
+        // search restricted to the community
+        std::vector<bool> visited(vertex_count, false);
+        std::vector<bool> community_visited(community_count, false);
+        std::vector<std::int64_t> queue;
+        for (std::int64_t start = 0; start < vertex_count; ++start) {
+            if (visited[start]) {
+                continue;
+            }
+            const std::int32_t community = result_labels[start];
+            UNSCOPED_INFO("Community is disconnected");
+            REQUIRE(!community_visited[community]);
+            community_visited[community] = true;
+            visited[start] = true;
+            queue.assign(1, start);
+            for (std::size_t head = 0; head < queue.size(); ++head) {
+                const std::int64_t u = queue[head];
+                for (std::int64_t index = graph_data.rows[u]; index < graph_data.rows[u + 1];
+                     ++index) {
+                    const std::int64_t v = graph_data.cols[index];
+                    if (!visited[v] && result_labels[v] == community) {
+                        visited[v] = true;
+                        queue.push_back(v);
+                    }
+                }
+            }
+        }
+        UNSCOPED_INFO("Labels are not consecutive");
+        for (std::int64_t c = 0; c < community_count; ++c) {
+            REQUIRE(community_visited[c]);
+        }
+    }
+
     template <typename EdgeValueType>
     void check_resolution_values(const graph_base_data& graph_data,
                                  std::vector<EdgeValueType>& weights,
@@ -602,6 +697,122 @@ LOUVAIN_TEST("Random generated graph with different initial partitions") {
 //     this->check_louvain(graph_data, double_weights, expected_labels, expected_community_count);
 // }
 
+LOUVAIN_TEST("Parallel method, K5 graph + K5 graph") {
+    using method_t = dal::preview::louvain::method::parallel;
+    two_complete_graphs_data graph_data;
+    std::vector<std::int32_t> expected_labels = { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 };
+    std::int64_t expected_community_count = 2;
+    SECTION("Int32 weights") {
+        std::vector<std::int32_t> int_weights(2 * graph_data.edge_count);
+        std::fill(int_weights.begin(), int_weights.end(), 1);
+        this->check_louvain<std::int32_t, method_t>(graph_data,
+                                                    int_weights,
+                                                    expected_labels,
+                                                    expected_community_count);
+    }
+    SECTION("Double weights") {
+        std::vector<double> double_weights(2 * graph_data.edge_count);
+        std::fill(double_weights.begin(), double_weights.end(), 1.5);
+        this->check_louvain<double, method_t>(graph_data,
+                                              double_weights,
+                                              expected_labels,
+                                              expected_community_count);
+    }
+}
+
+LOUVAIN_TEST("Parallel method, barbell graph") {
+    using method_t = dal::preview::louvain::method::parallel;
+    barbell_graph_data graph_data;
+    std::vector<std::int32_t> expected_labels = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    std::int64_t expected_community_count = 2;
+    std::vector<double> double_weights(2 * graph_data.edge_count);
+    std::fill(double_weights.begin(), double_weights.end(), 0.5);
+    this->check_louvain<double, method_t>(graph_data,
+                                          double_weights,
+                                          expected_labels,
+                                          expected_community_count);
+}
+
+LOUVAIN_TEST("Parallel method, modularity is close to the sequential one") {
+    const double modularity_tolerance = 0.05;
+    SECTION("SBM graph") {
+        sbm_graph_data graph_data;
+        std::vector<std::int32_t> int_weights(2 * graph_data.edge_count);
+        std::fill(int_weights.begin(), int_weights.end(), 10);
+        this->check_parallel_modularity(graph_data, int_weights, modularity_tolerance);
+    }
+    SECTION("Zachary's karate club graph") {
+        karate_club_graph_data graph_data;
+        std::vector<double> double_weights(2 * graph_data.edge_count);
+        std::fill(double_weights.begin(), double_weights.end(), 0.5);
+        this->check_parallel_modularity(graph_data, double_weights, modularity_tolerance);
+    }
+    SECTION("Combined graph") {
+        combined_graph_data graph_data;
+        std::vector<std::int32_t> int_weights = { 100, 12, 14, 3,  17,  12,  10,  150,
+                                                  60,  70, 14, 17, 10,  120, 60,  50,
+                                                  3,   70, 50, 1,  100, 150, 120, 1 };
+        this->check_parallel_modularity(graph_data, int_weights, modularity_tolerance);
+    }
+    SECTION("K_20 graph") {
+        complete_graph_data graph_data(20);
+        std::vector<std::int32_t> int_weights(2 * graph_data.edge_count);
+        std::fill(int_weights.begin(), int_weights.end(), 10);
+        this->check_parallel_modularity(graph_data, int_weights, modularity_tolerance);
+    }
+}
+
+LOUVAIN_TEST("Leiden method, K5 graph + K5 graph") {
+    using method_t = dal::preview::louvain::method::leiden;
+    two_complete_graphs_data graph_data;
+    std::vector<std::int32_t> expected_labels = { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 };
+    std::int64_t expected_community_count = 2;
+    std::vector<std::int32_t> int_weights(2 * graph_data.edge_count);
+    std::fill(int_weights.begin(), int_weights.end(), 1);
+    this->check_louvain<std::int32_t, method_t>(graph_data,
+                                                int_weights,
+                                                expected_labels,
+                                                expected_community_count);
+}
+
+LOUVAIN_TEST("Leiden method, barbell graph") {
+    using method_t = dal::preview::louvain::method::leiden;
+    barbell_graph_data graph_data;
+    std::vector<std::int32_t> expected_labels = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    std::int64_t expected_community_count = 2;
+    std::vector<double> double_weights(2 * graph_data.edge_count);
+    std::fill(double_weights.begin(), double_weights.end(), 0.5);
+    this->check_louvain<double, method_t>(graph_data,
+                                          double_weights,
+                                          expected_labels,
+                                          expected_community_count);
+}
+
+LOUVAIN_TEST("Leiden method, communities are connected") {
+    const double modularity_tolerance = 0.05;
+    SECTION("SBM graph") {
+        sbm_graph_data graph_data;
+        std::vector<std::int32_t> int_weights(2 * graph_data.edge_count);
+        std::fill(int_weights.begin(), int_weights.end(), 10);
+        this->check_leiden_communities(graph_data, int_weights, modularity_tolerance);
+    }
+    SECTION("Zachary's karate club graph") {
+        karate_club_graph_data graph_data;
+        std::vector<double> double_weights(2 * graph_data.edge_count);
+        std::fill(double_weights.begin(), double_weights.end(), 0.5);
+        this->check_leiden_communities(graph_data, double_weights, modularity_tolerance);
+    }
+    SECTION("Combined graph") {
+        combined_graph_data graph_data;
+        std::vector<std::int32_t> int_weights = { 100, 12, 14, 3,  17,  12,  10,  150,
+                                                  60,  70, 14, 17, 10,  120, 60,  50,
+                                                  3,   70, 50, 1,  100, 150, 120, 1 };
+        this->check_leiden_communities(graph_data, int_weights, modularity_tolerance);
+    }
+}
+
 LOUVAIN_TEST("Counting allocator test, null graph") {
     dal::preview::undirected_adjacency_vector_graph<std::int32_t, std::int32_t> graph;
     allocated_bytes_count = 0;
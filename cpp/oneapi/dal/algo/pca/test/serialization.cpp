@@ -101,4 +101,26 @@ TEMPLATE_LIST_TEST_M(pca_serialization_test,
     this->run_test();
 }
 
+TEST("pca model can be deserialized from mapped file", "[pca]") {
+    const std::int64_t row_count = 3;
+    const std::int64_t column_count = 5;
+    static const float eigenvectors[] = {
+        0.39, -0.23, 0.52, 0.61,  -0.38, //
+        0.44, 0.71,  -0.2, 0.12,  0.5, //
+        -0.6, 0.31,  0.48, -0.25, 0.49, //
+    };
+    const auto original = model<>{}.set_eigenvectors(
+        homogen_table::wrap(eigenvectors, row_count, column_count));
+
+    const auto deserialized = te::serialize_deserialize_mapped(original);
+    const auto table = homogen_table{ deserialized.get_eigenvectors() };
+
+    REQUIRE(table.get_row_count() == row_count);
+    REQUIRE(table.get_column_count() == column_count);
+    const auto values = table.get_data<float>();
+    for (std::int64_t i = 0; i < row_count * column_count; i++) {
+        REQUIRE(values[i] == eigenvectors[i]);
+    }
+}
+
 } // namespace oneapi::dal::pca::test
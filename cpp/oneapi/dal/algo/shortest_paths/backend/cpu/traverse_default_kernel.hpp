@@ -47,6 +47,218 @@ inline void update_bins(const Vertex& v,
     local_bins[dest_bin].push_back(v);
 }
 
+template <typename Vertex>
+struct bin_bucket {
+    Vertex* data = nullptr;
+    std::int64_t size = 0;
+    std::int64_t capacity = 0;
+};
+
+/// Buckets of the vertices owned by a single thread. The bucket of the bin `b`
+/// is kept in the slot `b % slot_count`. The bins below the first one are
+/// empty, so the slots and the memory of the buckets are reused as the first
+/// bin advances instead of growing the list of the bins.
+template <typename Vertex>
+class bin_pool {
+public:
+    using bucket_type = bin_bucket<Vertex>;
+    using vertex_allocator_type = inner_alloc<Vertex>;
+    using bucket_allocator_type = inner_alloc<bucket_type>;
+
+    explicit bin_pool(byte_alloc_iface* alloc_ptr)
+            : vertex_allocator_(alloc_ptr),
+              bucket_allocator_(alloc_ptr) {
+        slots_ = allocate_slots(initial_slot_count);
+        slot_count_ = initial_slot_count;
+    }
+
+    ~bin_pool() {
+        for (std::int64_t i = 0; i < slot_count_; ++i) {
+            release(slots_[i]);
+        }
+        release(spare_);
+        deallocate(bucket_allocator_, slots_, slot_count_);
+    }
+
+    inline void push(std::int64_t bin, Vertex v) {
+        // Rounding may put the vertex below the current bin, it is processed in the current one
+        bin = std::max(bin, first_bin_);
+        if (bin - first_bin_ >= slot_count_) {
+            grow(bin - first_bin_ + 1);
+        }
+        auto& bucket = get_slot(bin);
+        if (bucket.size == bucket.capacity) {
+            reserve(bucket, std::max(2 * bucket.capacity, initial_bucket_capacity));
+        }
+        bucket.data[bucket.size++] = v;
+        last_bin_ = std::max(last_bin_, bin);
+    }
+
+    inline std::int64_t get_size(std::int64_t bin) const {
+        return is_in_range(bin) ? get_slot(bin).size : 0;
+    }
+
+    inline const Vertex* get_data(std::int64_t bin) const {
+        return is_in_range(bin) ? get_slot(bin).data : nullptr;
+    }
+
+    inline void clear(std::int64_t bin) {
+        if (is_in_range(bin)) {
+            get_slot(bin).size = 0;
+        }
+    }
+
+    /// Moves the vertices of the bin to the spare bucket without copying. The
+    /// bin keeps the memory of the spare bucket, so the vertices pushed to the
+    /// bin while the returned ones are processed do not invalidate them.
+    inline const bucket_type& take(std::int64_t bin) {
+        spare_.size = 0;
+        if (is_in_range(bin)) {
+            std::swap(spare_, get_slot(bin));
+        }
+        return spare_;
+    }
+
+    /// Returns the first non-empty bin that is not less than the given one
+    inline std::int64_t find_next_bin(std::int64_t bin, std::int64_t not_found) const {
+        for (std::int64_t b = std::max(bin, first_bin_); b <= last_bin_; ++b) {
+            if (get_slot(b).size > 0) {
+                return b;
+            }
+        }
+        return not_found;
+    }
+
+    /// Marks the bins below the given one as processed, they must be empty
+    inline void set_first_bin(std::int64_t bin) {
+        ONEDAL_ASSERT(bin >= first_bin_);
+        first_bin_ = bin;
+    }
+
+    /// Empties all the bins and restarts from the zero bin keeping the memory
+    inline void reset() {
+        for (std::int64_t i = 0; i < slot_count_; ++i) {
+            slots_[i].size = 0;
+        }
+        first_bin_ = 0;
+        last_bin_ = -1;
+    }
+
+private:
+    bin_pool(const bin_pool&) = delete;
+    bin_pool& operator=(const bin_pool&) = delete;
+
+    static constexpr std::int64_t initial_slot_count = 64;
+    static constexpr std::int64_t initial_bucket_capacity = 16;
+
+    inline bool is_in_range(std::int64_t bin) const {
+        return bin >= first_bin_ && bin <= last_bin_;
+    }
+
+    inline bucket_type& get_slot(std::int64_t bin) {
+        return slots_[bin & (slot_count_ - 1)];
+    }
+
+    inline const bucket_type& get_slot(std::int64_t bin) const {
+        return slots_[bin & (slot_count_ - 1)];
+    }
+
+    bucket_type* allocate_slots(std::int64_t count) {
+        bucket_type* slots = allocate(bucket_allocator_, count);
+        for (std::int64_t i = 0; i < count; ++i) {
+            new (slots + i) bucket_type();
+        }
+        return slots;
+    }
+
+    void grow(std::int64_t min_slot_count) {
+        std::int64_t new_slot_count = slot_count_;
+        while (new_slot_count < min_slot_count) {
+            new_slot_count *= 2;
+        }
+        bucket_type* new_slots = allocate_slots(new_slot_count);
+        for (std::int64_t b = first_bin_; b < first_bin_ + slot_count_; ++b) {
+            new_slots[b & (new_slot_count - 1)] = get_slot(b);
+        }
+        deallocate(bucket_allocator_, slots_, slot_count_);
+        slots_ = new_slots;
+        slot_count_ = new_slot_count;
+    }
+
+    void reserve(bucket_type& bucket, std::int64_t capacity) {
+        Vertex* data = allocate(vertex_allocator_, capacity);
+        copy(bucket.data, bucket.data + bucket.size, data);
+        if (bucket.data != nullptr) {
+            deallocate(vertex_allocator_, bucket.data, bucket.capacity);
+        }
+        bucket.data = data;
+        bucket.capacity = capacity;
+    }
+
+    void release(bucket_type& bucket) {
+        if (bucket.data != nullptr) {
+            deallocate(vertex_allocator_, bucket.data, bucket.capacity);
+        }
+        bucket = bucket_type();
+    }
+
+    vertex_allocator_type vertex_allocator_;
+    bucket_allocator_type bucket_allocator_;
+    bucket_type* slots_ = nullptr;
+    bucket_type spare_;
+    std::int64_t slot_count_ = 0;
+    std::int64_t first_bin_ = 0;
+    std::int64_t last_bin_ = -1;
+};
+
+template <typename Vertex, typename EdgeValue>
+inline void update_bins(const Vertex& v,
+                        const EdgeValue& new_dist,
+                        const EdgeValue& delta,
+                        bin_pool<Vertex>& local_bins) {
+    ONEDAL_ASSERT(new_dist > 0);
+    ONEDAL_ASSERT(delta > 0);
+    ONEDAL_ASSERT(new_dist / delta <= std::numeric_limits<EdgeValue>::max());
+    local_bins.push(static_cast<std::int64_t>(new_dist / delta), v);
+}
+
+/// Tracks the target vertices whose distances are final. The distances below
+/// the lower bound of the current bin do not change anymore, so the traversal
+/// can be stopped once all the targets are below it.
+class settled_targets {
+public:
+    explicit settled_targets(const array<std::int64_t>& targets)
+            : targets_(targets.get_data()),
+              target_count_(targets.get_count()) {}
+
+    inline bool is_empty() const {
+        return target_count_ == 0;
+    }
+
+    template <typename EdgeValue, typename GetDistance>
+    inline bool are_all_settled(EdgeValue bin_lower_bound, GetDistance&& get_distance) {
+        if (is_empty()) {
+            return false;
+        }
+        // The targets settled once stay settled, so the scan is resumed from the first
+        // one that was not settled at the previous check
+        while (first_unsettled_ < target_count_ &&
+               get_distance(targets_[first_unsettled_]) < bin_lower_bound) {
+            ++first_unsettled_;
+        }
+        return first_unsettled_ == target_count_;
+    }
+
+    inline void reset() {
+        first_unsettled_ = 0;
+    }
+
+private:
+    const std::int64_t* targets_;
+    std::int64_t target_count_;
+    std::int64_t first_unsettled_ = 0;
+};
+
 template <typename Mode>
 struct relax_edges {};
 
@@ -152,6 +364,26 @@ inline std::int64_t reduce_to_common_bin(const std::int64_t& curr_bin_index,
     return vertex_count_in_shared_bin.load();
 }
 
+/// Builds the single-column table of the distances to all the vertices or to
+/// the targets if they are set
+template <typename EdgeValue, typename GetDistance>
+inline table get_distances_table(const detail::descriptor_base<task::one_to_all>& desc,
+                                 std::int64_t vertex_count,
+                                 GetDistance&& get_distance) {
+    const auto& targets = desc.get_targets();
+    const std::int64_t* target_ptr = targets.get_data();
+    const bool has_targets = targets.get_count() > 0;
+    const std::int64_t row_count = has_targets ? targets.get_count() : vertex_count;
+    auto dist_arr = array<EdgeValue>::empty(row_count);
+    EdgeValue* dist_ = dist_arr.get_mutable_data();
+
+    dal::detail::threader_for(row_count, row_count, [&](std::int64_t i) {
+        dist_[i] = get_distance(has_targets ? target_ptr[i] : i);
+    });
+
+    return dal::detail::homogen_table_builder{}.reset(dist_arr, row_count, 1).build();
+}
+
 template <typename Mode, typename VertexType, typename EdgeValue>
 struct get_result_from_ralaxing_data {};
 
@@ -163,16 +395,11 @@ struct get_result_from_ralaxing_data<mode::distances, VertexType, EdgeValue> {
         std::int64_t vertex_count,
         const DataToRelax& data) {
         using value_type = EdgeValue;
-        auto dist_arr = array<value_type>::empty(vertex_count);
-        value_type* dist_ = dist_arr.get_mutable_data();
         const auto computed_dist = data.get_distances_ptr();
-
-        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t i) {
-            dist_[i] = computed_dist[i];
-        });
-
         return traverse_result<task::one_to_all>().set_distances(
-            dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build());
+            get_distances_table<value_type>(desc, vertex_count, [&](std::int64_t v) -> value_type {
+                return computed_dist[v];
+            }));
     }
 };
 
@@ -185,34 +412,22 @@ struct get_result_from_ralaxing_data<mode::distances_predecessors, VertexType, E
         const DataToRelax& data) {
         using value_type = EdgeValue;
         using vertex_type = VertexType;
-        if (desc.get_optional_results() & optional_results::distances) {
-            auto dist_arr = array<value_type>::empty(vertex_count);
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            value_type* dist_ = dist_arr.get_mutable_data();
-            vertex_type* pred_ = pred_arr.get_mutable_data();
-
-            dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t i) {
-                dist_[i] = data.get_distance(i);
-                pred_[i] = data.get_predecessor(i);
-            });
-
-            return traverse_result<task::one_to_all>()
-                .set_distances(
-                    dal::detail::homogen_table_builder{}.reset(dist_arr, vertex_count, 1).build())
-                .set_predecessors(
-                    dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
-        }
-        else {
-            auto pred_arr = array<vertex_type>::empty(vertex_count);
-            vertex_type* pred_ = pred_arr.get_mutable_data();
+        auto pred_arr = array<vertex_type>::empty(vertex_count);
+        vertex_type* pred_ = pred_arr.get_mutable_data();
 
-            dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t i) {
-                pred_[i] = data.get_predecessor(i);
-            });
+        dal::detail::threader_for(vertex_count, vertex_count, [&](std::int64_t i) {
+            pred_[i] = data.get_predecessor(i);
+        });
 
-            return traverse_result<task::one_to_all>().set_predecessors(
-                dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
+        auto result = traverse_result<task::one_to_all>().set_predecessors(
+            dal::detail::homogen_table_builder{}.reset(pred_arr, vertex_count, 1).build());
+        if (desc.get_optional_results() & optional_results::distances) {
+            result.set_distances(
+                get_distances_table<value_type>(desc, vertex_count, [&](std::int64_t v) {
+                    return data.get_distance(v);
+                }));
         }
+        return result;
     }
 };
 
@@ -240,6 +455,10 @@ struct delta_stepping {
                                                                     source,
                                                                     max_dist,
                                                                     alloc_ptr);
+        settled_targets targets(desc.get_targets());
+        const auto get_distance = [&](std::int64_t v) {
+            return dist.get_distance(v);
+        };
 
         const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
 
@@ -299,6 +518,11 @@ struct delta_stepping {
             });
 
             find_next_bin_index(curr_bin_index, local_bins);
+            if (curr_bin_index != max_bin_count &&
+                targets.are_all_settled(delta * static_cast<value_type>(curr_bin_index),
+                                        get_distance)) {
+                break;
+            }
 
             vertex_count_in_shared_bin =
                 reduce_to_common_bin(curr_bin_index, local_bins, shared_bin);
@@ -309,4 +533,399 @@ struct delta_stepping {
     }
 };
 
+template <typename Cpu, typename EdgeValue, typename Mode>
+struct delta_stepping_fused {
+    traverse_result<task::one_to_all> operator()(
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
+        using vertex_type = std::int32_t;
+        using vertex_allocator_type = inner_alloc<vertex_type>;
+        using bin_pool_type = bin_pool<vertex_type>;
+        using bin_pool_allocator_type = inner_alloc<bin_pool_type>;
+        using index_allocator_type = inner_alloc<std::int64_t>;
+
+        const auto source = dal::detail::integral_cast<std::int32_t>(desc.get_source());
+        const value_type delta = desc.get_delta();
+        const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+        const std::int64_t max_elements_in_bin = 1000;
+        const std::int64_t shared_bin_chunk_size = 64;
+        const auto vertex_count = t.get_vertex_count();
+        const value_type max_dist = std::numeric_limits<value_type>::max();
+        using relaxing_data_t =
+            typename relaxing_data_type<Mode, vertex_type, value_type>::value_type;
+        data_to_relax<Cpu, Mode, vertex_type, relaxing_data_t> dist(vertex_count,
+                                                                    source,
+                                                                    max_dist,
+                                                                    alloc_ptr);
+        settled_targets targets(desc.get_targets());
+        const auto get_distance = [&](std::int64_t v) {
+            return dist.get_distance(v);
+        };
+
+        const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+
+        bin_pool_allocator_type bin_pool_allocator(alloc_ptr);
+        bin_pool_type* local_bins = allocate(bin_pool_allocator, thread_cnt);
+        for (std::int64_t i = 0; i < thread_cnt; ++i) {
+            new (local_bins + i) bin_pool_type(alloc_ptr);
+        }
+        dal::detail::shared<bin_pool_type> local_bins_shared(
+            local_bins,
+            destroy_delete<bin_pool_type, bin_pool_allocator_type>(thread_cnt, bin_pool_allocator));
+
+        index_allocator_type index_allocator(alloc_ptr);
+        std::int64_t* next_bin_indices = allocate(index_allocator, 2 * thread_cnt + 1);
+        dal::detail::shared<std::int64_t> next_bin_indices_shared(
+            next_bin_indices,
+            destroy_delete<std::int64_t, index_allocator_type>(2 * thread_cnt + 1,
+                                                               index_allocator));
+        std::int64_t* shared_bin_offsets = next_bin_indices + thread_cnt;
+
+        vertex_allocator_type vertex_allocator(alloc_ptr);
+        std::int64_t shared_bin_capacity = t.get_edge_count() + 1;
+        vertex_type* shared_bin = allocate(vertex_allocator, shared_bin_capacity);
+        dal::detail::shared<vertex_type> shared_bin_shared(
+            shared_bin,
+            destroy_delete<vertex_type, vertex_allocator_type>(shared_bin_capacity,
+                                                               vertex_allocator));
+        shared_bin[0] = source;
+        std::int64_t curr_bin_index = 0;
+        std::int64_t vertex_count_in_shared_bin = 1;
+        std::atomic<std::int64_t> next_chunk_start;
+
+        while (curr_bin_index != max_bin_count) {
+            next_chunk_start.store(0);
+            dal::detail::threader_for(thread_cnt, thread_cnt, [&](std::int64_t thread_id) {
+                auto& local_bin = local_bins[thread_id];
+
+                // Vertices of the shared bin are taken by chunks, so the threads that
+                // finish early help the others instead of waiting at the barrier
+                for (std::int64_t begin = next_chunk_start.fetch_add(shared_bin_chunk_size);
+                     begin < vertex_count_in_shared_bin;
+                     begin = next_chunk_start.fetch_add(shared_bin_chunk_size)) {
+                    const std::int64_t end =
+                        std::min(begin + shared_bin_chunk_size, vertex_count_in_shared_bin);
+                    for (std::int64_t i = begin; i < end; ++i) {
+                        const vertex_type u = shared_bin[i];
+                        if (dist.get_distance(u) >=
+                            delta * static_cast<value_type>(curr_bin_index)) {
+                            relax_edges<Mode>()(t, vals, u, delta, dist, local_bin);
+                        }
+                    }
+                }
+
+                // Bucket fusion: the small bucket of the current bin is processed by the
+                // thread that owns it without the global synchronization
+                while (local_bin.get_size(curr_bin_index) > 0 &&
+                       local_bin.get_size(curr_bin_index) < max_elements_in_bin) {
+                    const auto& bucket = local_bin.take(curr_bin_index);
+                    for (std::int64_t j = 0; j < bucket.size; ++j) {
+                        relax_edges<Mode>()(t, vals, bucket.data[j], delta, dist, local_bin);
+                    }
+                }
+
+                next_bin_indices[thread_id] =
+                    local_bin.find_next_bin(curr_bin_index, max_bin_count);
+            });
+
+            curr_bin_index = *std::min_element(next_bin_indices, next_bin_indices + thread_cnt);
+            if (curr_bin_index == max_bin_count ||
+                targets.are_all_settled(delta * static_cast<value_type>(curr_bin_index),
+                                        get_distance)) {
+                break;
+            }
+
+            shared_bin_offsets[0] = 0;
+            for (std::int64_t i = 0; i < thread_cnt; ++i) {
+                shared_bin_offsets[i + 1] =
+                    shared_bin_offsets[i] + local_bins[i].get_size(curr_bin_index);
+            }
+            vertex_count_in_shared_bin = shared_bin_offsets[thread_cnt];
+            if (vertex_count_in_shared_bin > shared_bin_capacity) {
+                shared_bin_capacity = vertex_count_in_shared_bin;
+                shared_bin = allocate(vertex_allocator, shared_bin_capacity);
+                shared_bin_shared.reset(
+                    shared_bin,
+                    destroy_delete<vertex_type, vertex_allocator_type>(shared_bin_capacity,
+                                                                       vertex_allocator));
+            }
+
+            dal::detail::threader_for(thread_cnt, thread_cnt, [&](std::int64_t i) {
+                auto& local_bin = local_bins[i];
+                const auto bin_data = local_bin.get_data(curr_bin_index);
+                copy(bin_data,
+                     bin_data + local_bin.get_size(curr_bin_index),
+                     shared_bin + shared_bin_offsets[i]);
+                local_bin.clear(curr_bin_index);
+                local_bin.set_first_bin(curr_bin_index);
+            });
+        }
+        return get_result_from_ralaxing_data<Mode, vertex_type, value_type>()(desc,
+                                                                              vertex_count,
+                                                                              dist);
+    }
+};
+
+/// Delta-stepping from a single source executed by one thread. The buffers are
+/// allocated on the first run and reused by the next ones, only the vertices
+/// reached by the previous run are reset, so a search that stops early at the
+/// targets does not touch the whole graph.
+template <typename Mode, typename EdgeValue>
+class sequential_delta_stepping {
+public:
+    using value_type = EdgeValue;
+    using vertex_type = std::int32_t;
+    using value_allocator_type = inner_alloc<value_type>;
+    using vertex_allocator_type = inner_alloc<vertex_type>;
+
+    static constexpr bool with_predecessors = std::is_same_v<Mode, mode::distances_predecessors>;
+
+    sequential_delta_stepping(std::int64_t vertex_count,
+                              value_type delta,
+                              byte_alloc_iface* alloc_ptr)
+            : vertex_count_(vertex_count),
+              delta_(delta),
+              value_allocator_(alloc_ptr),
+              vertex_allocator_(alloc_ptr),
+              bins_(alloc_ptr) {}
+
+    ~sequential_delta_stepping() {
+        if (dist_ != nullptr) {
+            deallocate(value_allocator_, dist_, vertex_count_);
+            deallocate(vertex_allocator_, reached_, vertex_count_);
+        }
+        if (pred_ != nullptr) {
+            deallocate(vertex_allocator_, pred_, vertex_count_);
+        }
+    }
+
+    void run(const dal::preview::detail::topology<std::int32_t>& t,
+             const EdgeValue* vals,
+             vertex_type source,
+             settled_targets& targets) {
+        const std::int64_t max_bin_count = std::numeric_limits<std::int64_t>::max() / 2;
+        init();
+        reset();
+        targets.reset();
+
+        update(source, 0, -1);
+        for (std::int64_t bin = bins_.find_next_bin(0, max_bin_count); bin != max_bin_count;
+             bin = bins_.find_next_bin(bin, max_bin_count)) {
+            bins_.set_first_bin(bin);
+            const value_type bin_lower_bound = delta_ * static_cast<value_type>(bin);
+            if (targets.are_all_settled(bin_lower_bound, [&](std::int64_t v) {
+                    return dist_[v];
+                })) {
+                break;
+            }
+            while (bins_.get_size(bin) > 0) {
+                const auto& bucket = bins_.take(bin);
+                for (std::int64_t i = 0; i < bucket.size; ++i) {
+                    const vertex_type u = bucket.data[i];
+                    // The vertex has been moved to a lower bin and processed there
+                    if (dist_[u] < bin_lower_bound) {
+                        continue;
+                    }
+                    for (std::int64_t v_ = t._rows_ptr[u]; v_ < t._rows_ptr[u + 1]; ++v_) {
+                        const vertex_type v = t._cols_ptr[v_];
+                        const value_type new_dist = dist_[u] + vals[v_];
+                        if (new_dist < dist_[v]) {
+                            update(v, new_dist, u);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    inline value_type get_distance(vertex_type v) const {
+        return dist_[v];
+    }
+
+    inline vertex_type get_predecessor(vertex_type v) const {
+        return pred_[v];
+    }
+
+private:
+    sequential_delta_stepping(const sequential_delta_stepping&) = delete;
+    sequential_delta_stepping& operator=(const sequential_delta_stepping&) = delete;
+
+    void init() {
+        if (dist_ != nullptr) {
+            return;
+        }
+        dist_ = allocate(value_allocator_, vertex_count_);
+        reached_ = allocate(vertex_allocator_, vertex_count_);
+        fill(dist_, dist_ + vertex_count_, max_dist);
+        if constexpr (with_predecessors) {
+            pred_ = allocate(vertex_allocator_, vertex_count_);
+            fill(pred_, pred_ + vertex_count_, vertex_type(-1));
+        }
+    }
+
+    void reset() {
+        for (std::int64_t i = 0; i < reached_count_; ++i) {
+            dist_[reached_[i]] = max_dist;
+            if constexpr (with_predecessors) {
+                pred_[reached_[i]] = -1;
+            }
+        }
+        reached_count_ = 0;
+        bins_.reset();
+    }
+
+    inline void update(vertex_type v, value_type new_dist, vertex_type pred) {
+        if (dist_[v] == max_dist) {
+            reached_[reached_count_++] = v;
+        }
+        dist_[v] = new_dist;
+        if constexpr (with_predecessors) {
+            pred_[v] = pred;
+        }
+        bins_.push(static_cast<std::int64_t>(new_dist / delta_), v);
+    }
+
+    static constexpr value_type max_dist = std::numeric_limits<value_type>::max();
+
+    const std::int64_t vertex_count_;
+    const value_type delta_;
+    value_allocator_type value_allocator_;
+    vertex_allocator_type vertex_allocator_;
+    bin_pool<vertex_type> bins_;
+    value_type* dist_ = nullptr;
+    vertex_type* pred_ = nullptr;
+    vertex_type* reached_ = nullptr;
+    std::int64_t reached_count_ = 0;
+};
+
+/// Computes the paths from many sources. If there are at least as many sources
+/// as threads, the sources are distributed among the threads and each of them
+/// is processed by the sequential delta-stepping, so the threads share the
+/// topology and do not synchronize within a traversal. Otherwise most of the
+/// threads would be idle, so the sources are processed one after another by
+/// the parallel single-source kernel `SingleSourceKernel`.
+template <typename Cpu,
+          typename EdgeValue,
+          typename Mode,
+          typename SingleSourceKernel = delta_stepping<Cpu, EdgeValue, Mode>>
+struct multi_source_delta_stepping {
+    traverse_result<task::many_to_all> operator()(
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc_ptr) {
+        using value_type = EdgeValue;
+        using vertex_type = std::int32_t;
+        using search_type = sequential_delta_stepping<Mode, value_type>;
+        using search_allocator_type = inner_alloc<search_type>;
+
+        const auto vertex_count = t.get_vertex_count();
+        const value_type delta = desc.get_delta();
+        const auto& sources = desc.get_sources();
+        const std::int64_t* source_ptr = sources.get_data();
+        const std::int64_t source_count = sources.get_count();
+        const auto& targets = desc.get_targets();
+        const std::int64_t* target_ptr = targets.get_data();
+        const bool has_targets = targets.get_count() > 0;
+        const std::int64_t dist_column_count = has_targets ? targets.get_count() : vertex_count;
+        const bool with_distances = desc.get_optional_results() & optional_results::distances;
+
+        const std::int64_t thread_cnt = dal::detail::threader_get_max_threads();
+        search_allocator_type search_allocator(alloc_ptr);
+        search_type* searches = allocate(search_allocator, thread_cnt);
+        for (std::int64_t i = 0; i < thread_cnt; ++i) {
+            new (searches + i) search_type(vertex_count, delta, alloc_ptr);
+        }
+        dal::detail::shared<search_type> searches_shared(
+            searches,
+            destroy_delete<search_type, search_allocator_type>(thread_cnt, search_allocator));
+
+        array<value_type> dist_arr;
+        array<vertex_type> pred_arr;
+        if (with_distances) {
+            dist_arr = array<value_type>::empty(source_count * dist_column_count);
+        }
+        if constexpr (search_type::with_predecessors) {
+            pred_arr = array<vertex_type>::empty(source_count * vertex_count);
+        }
+        value_type* dist_ = with_distances ? dist_arr.get_mutable_data() : nullptr;
+
+        if (source_count < thread_cnt) {
+            for (std::int64_t i = 0; i < source_count; ++i) {
+                const auto single_source_desc =
+                    descriptor<float, method::delta_stepping, task::one_to_all>(
+                        source_ptr[i],
+                        delta,
+                        desc.get_optional_results())
+                        .set_targets(targets);
+                const auto single_source_result =
+                    SingleSourceKernel{}(single_source_desc, t, vals, alloc_ptr);
+
+                if (with_distances) {
+                    const auto dist_row = homogen_table{ single_source_result.get_distances() }
+                                              .get_data<value_type>();
+                    std::copy(dist_row,
+                              dist_row + dist_column_count,
+                              dist_ + i * dist_column_count);
+                }
+                if constexpr (search_type::with_predecessors) {
+                    const auto pred_row = homogen_table{ single_source_result.get_predecessors() }
+                                              .get_data<vertex_type>();
+                    std::copy(pred_row,
+                              pred_row + vertex_count,
+                              pred_arr.get_mutable_data() + i * vertex_count);
+                }
+            }
+            return make_result(dist_arr, pred_arr, source_count, dist_column_count, vertex_count);
+        }
+
+        dal::detail::threader_for(source_count, source_count, [&](std::int64_t i) {
+            auto& search = searches[dal::detail::threader_get_current_thread_index()];
+            settled_targets thread_targets(targets);
+            search.run(t,
+                       vals,
+                       dal::detail::integral_cast<vertex_type>(source_ptr[i]),
+                       thread_targets);
+
+            if (with_distances) {
+                value_type* dist_row = dist_ + i * dist_column_count;
+                for (std::int64_t j = 0; j < dist_column_count; ++j) {
+                    dist_row[j] = search.get_distance(has_targets ? target_ptr[j] : j);
+                }
+            }
+            if constexpr (search_type::with_predecessors) {
+                vertex_type* pred_row = pred_arr.get_mutable_data() + i * vertex_count;
+                for (std::int64_t j = 0; j < vertex_count; ++j) {
+                    pred_row[j] = search.get_predecessor(j);
+                }
+            }
+        });
+
+        return make_result(dist_arr, pred_arr, source_count, dist_column_count, vertex_count);
+    }
+
+private:
+    static traverse_result<task::many_to_all> make_result(const array<EdgeValue>& dist_arr,
+                                                          const array<std::int32_t>& pred_arr,
+                                                          std::int64_t source_count,
+                                                          std::int64_t dist_column_count,
+                                                          std::int64_t vertex_count) {
+        traverse_result<task::many_to_all> result;
+        if (dist_arr.get_count() > 0) {
+            result.set_distances(dal::detail::homogen_table_builder{}
+                                     .reset(dist_arr, source_count, dist_column_count)
+                                     .build());
+        }
+        if (pred_arr.get_count() > 0) {
+            result.set_predecessors(dal::detail::homogen_table_builder{}
+                                        .reset(pred_arr, source_count, vertex_count)
+                                        .build());
+        }
+        return result;
+    }
+};
+
 } // namespace oneapi::dal::preview::shortest_paths::backend
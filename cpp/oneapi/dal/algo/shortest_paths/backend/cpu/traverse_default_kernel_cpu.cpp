@@ -26,4 +26,46 @@ template struct delta_stepping<__CPU_TAG__, std::int32_t, mode::distances_predec
 
 template struct delta_stepping<__CPU_TAG__, double, mode::distances_predecessors>;
 
+template struct delta_stepping_fused<__CPU_TAG__, std::int32_t, mode::distances>;
+
+template struct delta_stepping_fused<__CPU_TAG__, double, mode::distances>;
+
+template struct delta_stepping_fused<__CPU_TAG__, std::int32_t, mode::distances_predecessors>;
+
+template struct delta_stepping_fused<__CPU_TAG__, double, mode::distances_predecessors>;
+
+template struct multi_source_delta_stepping<__CPU_TAG__, std::int32_t, mode::distances>;
+
+template struct multi_source_delta_stepping<__CPU_TAG__, double, mode::distances>;
+
+template struct multi_source_delta_stepping<__CPU_TAG__,
+                                            std::int32_t,
+                                            mode::distances_predecessors>;
+
+template struct multi_source_delta_stepping<__CPU_TAG__, double, mode::distances_predecessors>;
+
+template struct multi_source_delta_stepping<
+    __CPU_TAG__,
+    std::int32_t,
+    mode::distances,
+    delta_stepping_fused<__CPU_TAG__, std::int32_t, mode::distances>>;
+
+template struct multi_source_delta_stepping<
+    __CPU_TAG__,
+    double,
+    mode::distances,
+    delta_stepping_fused<__CPU_TAG__, double, mode::distances>>;
+
+template struct multi_source_delta_stepping<
+    __CPU_TAG__,
+    std::int32_t,
+    mode::distances_predecessors,
+    delta_stepping_fused<__CPU_TAG__, std::int32_t, mode::distances_predecessors>>;
+
+template struct multi_source_delta_stepping<
+    __CPU_TAG__,
+    double,
+    mode::distances_predecessors,
+    delta_stepping_fused<__CPU_TAG__, double, mode::distances_predecessors>>;
+
 } // namespace oneapi::dal::preview::shortest_paths::backend
@@ -31,12 +31,12 @@ template <typename Task>
 class descriptor_impl : public base {
 public:
     explicit descriptor_impl() {
-        if constexpr (!std::is_same_v<Task, task::one_to_all>) {
-            static_assert("Unsupported task");
-        }
+        static_assert(is_valid_task<Task>, "Unsupported task");
     }
 
     std::int64_t _source = 0;
+    array<std::int64_t> _sources;
+    array<std::int64_t> _targets;
     double _delta = 1;
     optional_result_id optional_results = optional_results::distances;
 };
@@ -49,6 +49,16 @@ std::int64_t descriptor_base<Task>::get_source() const {
     return impl_->_source;
 }
 
+template <typename Task>
+const array<std::int64_t>& descriptor_base<Task>::get_sources() const {
+    return impl_->_sources;
+}
+
+template <typename Task>
+const array<std::int64_t>& descriptor_base<Task>::get_targets() const {
+    return impl_->_targets;
+}
+
 template <typename Task>
 double descriptor_base<Task>::get_delta() const {
     return impl_->_delta;
@@ -59,6 +69,16 @@ void descriptor_base<Task>::set_source(std::int64_t source) {
     impl_->_source = source;
 }
 
+template <typename Task>
+void descriptor_base<Task>::set_sources(const array<std::int64_t>& sources) {
+    impl_->_sources = sources;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_targets(const array<std::int64_t>& targets) {
+    impl_->_targets = targets;
+}
+
 template <typename Task>
 void descriptor_base<Task>::set_delta(double delta) {
     impl_->_delta = delta;
@@ -75,5 +95,6 @@ void descriptor_base<Task>::set_optional_results(const optional_result_id& value
 }
 
 template class ONEDAL_EXPORT descriptor_base<task::one_to_all>;
+template class ONEDAL_EXPORT descriptor_base<task::many_to_all>;
 
 } // namespace oneapi::dal::preview::shortest_paths::detail
@@ -24,11 +24,16 @@ namespace oneapi::dal::preview::shortest_paths {
 
 namespace task {
 struct one_to_all {}; // one vertex to all paths
+struct many_to_all {}; // several vertices to all paths
 using by_default = one_to_all;
 } // namespace task
 
 namespace method {
+/// Delta-stepping that synchronizes all threads after every bucket
 struct delta_stepping {};
+/// Delta-stepping with bucket fusion: threads process small buckets locally
+/// without the global synchronization and keep the buckets in pooled storage
+struct delta_stepping_fused {};
 using by_default = delta_stepping;
 } // namespace method
 
@@ -96,20 +101,35 @@ class descriptor_impl;
 template <typename T>
 using enable_if_single_source_t = std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all>>;
 
+template <typename T>
+using enable_if_multiple_sources_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all>>;
+
 template <typename T, typename M>
 using enable_if_delta_stepping_single_source_t =
     std::enable_if_t<dal::detail::is_one_of_v<T, task::one_to_all> &
-                     dal::detail::is_one_of_v<M, method::delta_stepping>>;
+                     dal::detail::is_one_of_v<M,
+                                              method::delta_stepping,
+                                              method::delta_stepping_fused>>;
+
+template <typename T, typename M>
+using enable_if_delta_stepping_multiple_sources_t =
+    std::enable_if_t<dal::detail::is_one_of_v<T, task::many_to_all> &
+                     dal::detail::is_one_of_v<M,
+                                              method::delta_stepping,
+                                              method::delta_stepping_fused>>;
 
 template <typename M>
-using enable_if_delta_stepping_t =
-    std::enable_if_t<dal::detail::is_one_of_v<M, method::delta_stepping>>;
+using enable_if_delta_stepping_t = std::enable_if_t<
+    dal::detail::is_one_of_v<M, method::delta_stepping, method::delta_stepping_fused>>;
 
 template <typename Method>
-constexpr bool is_valid_method = dal::detail::is_one_of_v<Method, method::delta_stepping>;
+constexpr bool is_valid_method =
+    dal::detail::is_one_of_v<Method, method::delta_stepping, method::delta_stepping_fused>;
 
 template <typename Task>
-constexpr bool is_valid_task = dal::detail::is_one_of_v<Task, task::one_to_all>;
+constexpr bool is_valid_task =
+    dal::detail::is_one_of_v<Task, task::one_to_all, task::many_to_all>;
 
 /// The base class for the Shortest Paths algorithm descriptor
 template <typename Task = task::by_default>
@@ -125,11 +145,15 @@ public:
     descriptor_base();
 
     std::int64_t get_source() const;
+    const array<std::int64_t>& get_sources() const;
+    const array<std::int64_t>& get_targets() const;
     double get_delta() const;
     optional_result_id& get_optional_results() const;
 
 protected:
     void set_source(std::int64_t source_vertex);
+    void set_sources(const array<std::int64_t>& source_vertices);
+    void set_targets(const array<std::int64_t>& target_vertices);
     void set_delta(double delta);
     void set_optional_results(const optional_result_id& optional_results);
 
@@ -173,6 +197,23 @@ public:
         alloc_ = allocator;
     }
 
+    /// Creates a descriptor that computes the paths from each of the source
+    /// vertices. If there are at least as many sources as threads, the sources
+    /// are processed concurrently, each of them by a single thread. Otherwise
+    /// they are processed one after another by the parallel kernel of the method.
+    template <typename T = Task,
+              typename M = Method,
+              typename = detail::enable_if_delta_stepping_multiple_sources_t<T, M>>
+    explicit descriptor(const array<std::int64_t>& source_vertices,
+                        double delta,
+                        optional_result_id optional_results = optional_results::distances,
+                        const Allocator& allocator = std::allocator<char>()) {
+        base_t::set_sources(source_vertices);
+        base_t::set_delta(delta);
+        base_t::set_optional_results(optional_results);
+        alloc_ = allocator;
+    }
+
     template <typename T = Task, typename = detail::enable_if_single_source_t<T>>
     auto& set_source(std::int64_t source_vertex) {
         base_t::set_source(source_vertex);
@@ -184,6 +225,29 @@ public:
         return base_t::get_source();
     }
 
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    auto& set_sources(const array<std::int64_t>& source_vertices) {
+        base_t::set_sources(source_vertices);
+        return *this;
+    }
+
+    template <typename T = Task, typename = detail::enable_if_multiple_sources_t<T>>
+    const array<std::int64_t>& get_sources() const {
+        return base_t::get_sources();
+    }
+
+    /// Sets the vertices the paths are required to. If the list is not empty,
+    /// the traversal from a source stops once the distances to all the targets
+    /// are final and the distances are returned for the targets only.
+    auto& set_targets(const array<std::int64_t>& target_vertices) {
+        base_t::set_targets(target_vertices);
+        return *this;
+    }
+
+    const array<std::int64_t>& get_targets() const {
+        return base_t::get_targets();
+    }
+
     template <typename M = Method, typename = detail::enable_if_delta_stepping_t<M>>
     auto& set_delta(double delta) {
         base_t::set_delta(delta);
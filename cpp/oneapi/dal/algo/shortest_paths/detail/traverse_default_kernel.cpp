@@ -28,7 +28,7 @@ operator()(const dal::detail::host_policy& policy,
            const dal::preview::detail::topology<std::int32_t>& t,
            const EdgeValue* vals,
            byte_alloc_iface* alloc_ptr) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::delta_stepping<decltype(cpu), EdgeValue, backend::mode::distances>{}(
             desc,
             t,
@@ -47,7 +47,7 @@ traverse_result<task::one_to_all> delta_stepping_with_pred<
                            const dal::preview::detail::topology<std::int32_t>& t,
                            const EdgeValue* vals,
                            byte_alloc_iface* alloc_ptr) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::delta_stepping<decltype(cpu),
                                        EdgeValue,
                                        backend::mode::distances_predecessors>{}(desc,
@@ -57,6 +57,129 @@ traverse_result<task::one_to_all> delta_stepping_with_pred<
     });
 }
 
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all> delta_stepping<
+    Float,
+    task::many_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::many_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        return backend::multi_source_delta_stepping<decltype(cpu),
+                                                    EdgeValue,
+                                                    backend::mode::distances>{}(desc,
+                                                                                t,
+                                                                                vals,
+                                                                                alloc_ptr);
+    });
+}
+
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all> delta_stepping_with_pred<
+    Float,
+    task::many_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::many_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        return backend::multi_source_delta_stepping<
+            decltype(cpu),
+            EdgeValue,
+            backend::mode::distances_predecessors>{}(desc, t, vals, alloc_ptr);
+    });
+}
+
+template <typename Float, typename EdgeValue>
+traverse_result<task::one_to_all> delta_stepping_fused<
+    Float,
+    task::one_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::one_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        return backend::delta_stepping_fused<decltype(cpu), EdgeValue, backend::mode::distances>{}(
+            desc,
+            t,
+            vals,
+            alloc_ptr);
+    });
+}
+
+template <typename Float, typename EdgeValue>
+traverse_result<task::one_to_all> delta_stepping_fused_with_pred<
+    Float,
+    task::one_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::one_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        return backend::delta_stepping_fused<decltype(cpu),
+                                             EdgeValue,
+                                             backend::mode::distances_predecessors>{}(desc,
+                                                                                      t,
+                                                                                      vals,
+                                                                                      alloc_ptr);
+    });
+}
+
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all> delta_stepping_fused<
+    Float,
+    task::many_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::many_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        using mode_t = backend::mode::distances;
+        return backend::multi_source_delta_stepping<
+            decltype(cpu),
+            EdgeValue,
+            mode_t,
+            backend::delta_stepping_fused<decltype(cpu), EdgeValue, mode_t>>{}(desc,
+                                                                               t,
+                                                                               vals,
+                                                                               alloc_ptr);
+    });
+}
+
+template <typename Float, typename EdgeValue>
+traverse_result<task::many_to_all> delta_stepping_fused_with_pred<
+    Float,
+    task::many_to_all,
+    dal::preview::detail::topology<std::int32_t>,
+    EdgeValue>::operator()(const dal::detail::host_policy& policy,
+                           const detail::descriptor_base<task::many_to_all>& desc,
+                           const dal::preview::detail::topology<std::int32_t>& t,
+                           const EdgeValue* vals,
+                           byte_alloc_iface* alloc_ptr) const {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
+        using mode_t = backend::mode::distances_predecessors;
+        return backend::multi_source_delta_stepping<
+            decltype(cpu),
+            EdgeValue,
+            mode_t,
+            backend::delta_stepping_fused<decltype(cpu), EdgeValue, mode_t>>{}(desc,
+                                                                               t,
+                                                                               vals,
+                                                                               alloc_ptr);
+    });
+}
+
 template struct ONEDAL_EXPORT delta_stepping<float,
                                              task::one_to_all,
                                              dal::preview::detail::topology<std::int32_t>,
@@ -75,4 +198,66 @@ template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
                                                        dal::preview::detail::topology<std::int32_t>,
                                                        double>;
 
+template struct ONEDAL_EXPORT delta_stepping<float,
+                                             task::many_to_all,
+                                             dal::preview::detail::topology<std::int32_t>,
+                                             std::int32_t>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping<float, task::many_to_all, dal::preview::detail::topology<std::int32_t>, double>;
+
+template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
+                                                       task::many_to_all,
+                                                       dal::preview::detail::topology<std::int32_t>,
+                                                       std::int32_t>;
+
+template struct ONEDAL_EXPORT delta_stepping_with_pred<float,
+                                                       task::many_to_all,
+                                                       dal::preview::detail::topology<std::int32_t>,
+                                                       double>;
+
+template struct ONEDAL_EXPORT delta_stepping_fused<float,
+                                                   task::one_to_all,
+                                                   dal::preview::detail::topology<std::int32_t>,
+                                                   std::int32_t>;
+
+template struct ONEDAL_EXPORT delta_stepping_fused<float,
+                                                   task::one_to_all,
+                                                   dal::preview::detail::topology<std::int32_t>,
+                                                   double>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping_fused_with_pred<float,
+                                   task::one_to_all,
+                                   dal::preview::detail::topology<std::int32_t>,
+                                   std::int32_t>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping_fused_with_pred<float,
+                                   task::one_to_all,
+                                   dal::preview::detail::topology<std::int32_t>,
+                                   double>;
+
+template struct ONEDAL_EXPORT delta_stepping_fused<float,
+                                                   task::many_to_all,
+                                                   dal::preview::detail::topology<std::int32_t>,
+                                                   std::int32_t>;
+
+template struct ONEDAL_EXPORT delta_stepping_fused<float,
+                                                   task::many_to_all,
+                                                   dal::preview::detail::topology<std::int32_t>,
+                                                   double>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping_fused_with_pred<float,
+                                   task::many_to_all,
+                                   dal::preview::detail::topology<std::int32_t>,
+                                   std::int32_t>;
+
+template struct ONEDAL_EXPORT
+    delta_stepping_fused_with_pred<float,
+                                   task::many_to_all,
+                                   dal::preview::detail::topology<std::int32_t>,
+                                   double>;
+
 } // namespace oneapi::dal::preview::shortest_paths::detail
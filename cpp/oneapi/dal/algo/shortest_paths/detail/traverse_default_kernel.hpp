@@ -58,6 +58,19 @@ struct delta_stepping<Float,
         byte_alloc_iface* alloc) const;
 };
 
+template <typename Float, typename EdgeValue>
+struct delta_stepping<Float,
+                      task::many_to_all,
+                      dal::preview::detail::topology<std::int32_t>,
+                      EdgeValue> {
+    traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
 template <typename Float, typename Task, typename Topology, typename EdgeValue, typename... Param>
 struct delta_stepping_with_pred {
     traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
@@ -80,6 +93,89 @@ struct delta_stepping_with_pred<Float,
         byte_alloc_iface* alloc) const;
 };
 
+template <typename Float, typename EdgeValue>
+struct delta_stepping_with_pred<Float,
+                                task::many_to_all,
+                                dal::preview::detail::topology<std::int32_t>,
+                                EdgeValue> {
+    traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename Task, typename Topology, typename EdgeValue, typename... Param>
+struct delta_stepping_fused {
+    traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                     const detail::descriptor_base<Task>& desc,
+                                     const Topology& t,
+                                     const EdgeValue* vals,
+                                     byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename EdgeValue>
+struct delta_stepping_fused<Float,
+                            task::one_to_all,
+                            dal::preview::detail::topology<std::int32_t>,
+                            EdgeValue> {
+    traverse_result<task::one_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename EdgeValue>
+struct delta_stepping_fused<Float,
+                            task::many_to_all,
+                            dal::preview::detail::topology<std::int32_t>,
+                            EdgeValue> {
+    traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename Task, typename Topology, typename EdgeValue, typename... Param>
+struct delta_stepping_fused_with_pred {
+    traverse_result<Task> operator()(const dal::detail::host_policy& ctx,
+                                     const detail::descriptor_base<Task>& desc,
+                                     const Topology& t,
+                                     const EdgeValue* vals,
+                                     byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename EdgeValue>
+struct delta_stepping_fused_with_pred<Float,
+                                      task::one_to_all,
+                                      dal::preview::detail::topology<std::int32_t>,
+                                      EdgeValue> {
+    traverse_result<task::one_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
+template <typename Float, typename EdgeValue>
+struct delta_stepping_fused_with_pred<Float,
+                                      task::many_to_all,
+                                      dal::preview::detail::topology<std::int32_t>,
+                                      EdgeValue> {
+    traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const dal::preview::detail::topology<std::int32_t>& t,
+        const EdgeValue* vals,
+        byte_alloc_iface* alloc) const;
+};
+
 template <typename Allocator, typename Graph>
 struct traverse_kernel_cpu<method::delta_stepping, task::one_to_all, Allocator, Graph> {
     inline traverse_result<task::one_to_all> operator()(
@@ -110,4 +206,96 @@ struct traverse_kernel_cpu<method::delta_stepping, task::one_to_all, Allocator,
     }
 };
 
+template <typename Allocator, typename Graph>
+struct traverse_kernel_cpu<method::delta_stepping_fused, task::one_to_all, Allocator, Graph> {
+    inline traverse_result<task::one_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::one_to_all>& desc,
+        const Allocator& alloc,
+        const Graph& g) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        using value_type = edge_user_value_type<Graph>;
+        const auto& t = dal::preview::detail::csr_topology_builder<Graph>()(g);
+        const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
+        alloc_connector<Allocator> alloc_con(alloc);
+        if (desc.get_optional_results() & optional_results::predecessors) {
+            return delta_stepping_fused_with_pred<float,
+                                                  task::one_to_all,
+                                                  topology_type,
+                                                  value_type>{}(ctx, desc, t, vals, &alloc_con);
+        }
+        else {
+            return delta_stepping_fused<float, task::one_to_all, topology_type, value_type>{}(
+                ctx,
+                desc,
+                t,
+                vals,
+                &alloc_con);
+        }
+    }
+};
+
+template <typename Allocator, typename Graph>
+struct traverse_kernel_cpu<method::delta_stepping, task::many_to_all, Allocator, Graph> {
+    inline traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const Allocator& alloc,
+        const Graph& g) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        using value_type = edge_user_value_type<Graph>;
+        const auto& t = dal::preview::detail::csr_topology_builder<Graph>()(g);
+        const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
+        alloc_connector<Allocator> alloc_con(alloc);
+        if (desc.get_optional_results() & optional_results::predecessors) {
+            return delta_stepping_with_pred<float, task::many_to_all, topology_type, value_type>{}(
+                ctx,
+                desc,
+                t,
+                vals,
+                &alloc_con);
+        }
+        else {
+            return delta_stepping<float, task::many_to_all, topology_type, value_type>{}(
+                ctx,
+                desc,
+                t,
+                vals,
+                &alloc_con);
+        }
+    }
+};
+
+/// The bucket fusion applies when there are fewer sources than threads and each
+/// source is processed by the parallel kernel, otherwise the sources are
+/// processed by the same sequential kernel as for the delta_stepping method
+template <typename Allocator, typename Graph>
+struct traverse_kernel_cpu<method::delta_stepping_fused, task::many_to_all, Allocator, Graph> {
+    inline traverse_result<task::many_to_all> operator()(
+        const dal::detail::host_policy& ctx,
+        const detail::descriptor_base<task::many_to_all>& desc,
+        const Allocator& alloc,
+        const Graph& g) const {
+        using topology_type = typename graph_traits<Graph>::impl_type::topology_type;
+        using value_type = edge_user_value_type<Graph>;
+        const auto& t = dal::preview::detail::csr_topology_builder<Graph>()(g);
+        const auto vals = dal::detail::get_impl(g).get_edge_values().get_data();
+        alloc_connector<Allocator> alloc_con(alloc);
+        if (desc.get_optional_results() & optional_results::predecessors) {
+            return delta_stepping_fused_with_pred<float,
+                                                  task::many_to_all,
+                                                  topology_type,
+                                                  value_type>{}(ctx, desc, t, vals, &alloc_con);
+        }
+        else {
+            return delta_stepping_fused<float, task::many_to_all, topology_type, value_type>{}(
+                ctx,
+                desc,
+                t,
+                vals,
+                &alloc_con);
+        }
+    }
+};
+
 } // namespace oneapi::dal::preview::shortest_paths::detail
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/algo/shortest_paths/traverse.hpp"
 #include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
@@ -119,6 +120,34 @@ public:
 
         const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
     }
+
+    template <typename GraphType>
+    void check_multiple_sources(const std::vector<std::int64_t>& sources,
+                                const std::vector<std::int64_t>& targets) {
+        using namespace dal::preview::shortest_paths;
+        GraphType graph_data;
+
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int,
+            double,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+
+        const auto& graph = graph_builder.get_graph();
+
+        const auto shortest_paths_desc =
+            descriptor<float, method::delta_stepping, task::many_to_all>(
+                dal::array<std::int64_t>::wrap(sources.data(), sources.size()),
+                5)
+                .set_targets(dal::array<std::int64_t>::wrap(targets.data(), targets.size()));
+
+        const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
+    }
 };
 
 #define SHORTEST_PATHS_BADARG_TEST(name) \
@@ -136,6 +165,25 @@ SHORTEST_PATHS_BADARG_TEST("Check source is in graph ") {
     REQUIRE_THROWS_AS((this->check_shortest_paths<example_graph_type>(5, 100)), invalid_argument);
 }
 
+SHORTEST_PATHS_BADARG_TEST("Check sources are in graph") {
+    REQUIRE_THROWS_AS((this->check_multiple_sources<example_graph_type>({ 0, -1 }, {})),
+                      invalid_argument);
+    REQUIRE_THROWS_AS((this->check_multiple_sources<example_graph_type>({ 6, 0 }, {})),
+                      invalid_argument);
+}
+
+SHORTEST_PATHS_BADARG_TEST("Check source list is not empty") {
+    REQUIRE_THROWS_AS((this->check_multiple_sources<example_graph_type>({}, {})),
+                      invalid_argument);
+}
+
+SHORTEST_PATHS_BADARG_TEST("Check targets are in graph") {
+    REQUIRE_THROWS_AS((this->check_multiple_sources<example_graph_type>({ 0 }, { 1, -1 })),
+                      invalid_argument);
+    REQUIRE_THROWS_AS((this->check_multiple_sources<example_graph_type>({ 0 }, { 6 })),
+                      invalid_argument);
+}
+
 SHORTEST_PATHS_BADARG_TEST("Check empty graph") {
     REQUIRE_THROWS_AS((this->check_shortest_paths<empty_graph_type>(5, 0)), invalid_argument);
 }
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/algo/shortest_paths/traverse.hpp"
+#include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::algo::shortest_paths::test {
+
+namespace dal = oneapi::dal;
+namespace sp = dal::preview::shortest_paths;
+
+/// Road-network-like graph: a square grid where every vertex is connected to
+/// its four neighbors with random weights. Such graphs have a large diameter,
+/// so delta-stepping walks through many small buckets.
+class grid_graph_data {
+public:
+    explicit grid_graph_data(std::int64_t side) : vertex_count(side * side) {
+        std::mt19937 generator(7777);
+        std::uniform_real_distribution<double> weight_distribution(1.0, 100.0);
+
+        rows.reserve(vertex_count + 1);
+        rows.push_back(0);
+        for (std::int64_t row = 0; row < side; ++row) {
+            for (std::int64_t col = 0; col < side; ++col) {
+                const std::int64_t neighbors[4][2] = { { row - 1, col },
+                                                       { row + 1, col },
+                                                       { row, col - 1 },
+                                                       { row, col + 1 } };
+                for (const auto& neighbor : neighbors) {
+                    if (neighbor[0] >= 0 && neighbor[0] < side && neighbor[1] >= 0 &&
+                        neighbor[1] < side) {
+                        cols.push_back(std::int32_t(neighbor[0] * side + neighbor[1]));
+                        weights.push_back(weight_distribution(generator));
+                    }
+                }
+                rows.push_back(cols.size());
+            }
+        }
+    }
+
+    std::int64_t vertex_count;
+    std::vector<std::int64_t> rows;
+    std::vector<std::int32_t> cols;
+    std::vector<double> weights;
+};
+
+class shortest_paths_perf_test {
+public:
+    using graph_builder_t =
+        dal::preview::detail::directed_adjacency_vector_graph_builder<std::int32_t, double>;
+
+    template <typename Method>
+    void run(const std::string& method_name, std::int64_t side, double delta) {
+        const grid_graph_data data(side);
+        const graph_builder_t builder(data.vertex_count,
+                                      data.cols.size(),
+                                      data.rows.data(),
+                                      data.cols.data(),
+                                      data.weights.data());
+        const auto& graph = builder.get_graph();
+        const auto desc =
+            sp::descriptor<float, Method, sp::task::one_to_all>(0,
+                                                                delta,
+                                                                sp::optional_results::distances);
+
+        const auto name = fmt::format("Shortest paths {}: {}x{} grid, delta {}",
+                                      method_name,
+                                      side,
+                                      side,
+                                      delta);
+        BENCHMARK(name.c_str()) {
+            return dal::preview::traverse(desc, graph);
+        };
+    }
+
+    void run_multiple_sources(std::int64_t side, std::int64_t source_count, bool with_targets) {
+        const grid_graph_data data(side);
+        const graph_builder_t builder(data.vertex_count,
+                                      data.cols.size(),
+                                      data.rows.data(),
+                                      data.cols.data(),
+                                      data.weights.data());
+        const auto& graph = builder.get_graph();
+
+        // Sources form a square block in the center of the grid, the targets are
+        // close to it, so the traversals with the targets stop early
+        const std::int64_t block_side =
+            std::max(std::int64_t(1), std::int64_t(std::sqrt(source_count)));
+        const std::int64_t center = side / 2;
+        std::vector<std::int64_t> sources(source_count);
+        for (std::int64_t i = 0; i < source_count; ++i) {
+            sources[i] = (center + (i / block_side) % block_side) * side + center + i % block_side;
+        }
+        std::vector<std::int64_t> targets;
+        if (with_targets) {
+            for (std::int64_t shift = 0; shift < 8; ++shift) {
+                targets.push_back((center - 2 * block_side) * side + center + shift);
+            }
+        }
+
+        const auto desc =
+            sp::descriptor<float, sp::method::delta_stepping, sp::task::many_to_all>(
+                dal::array<std::int64_t>::wrap(sources.data(), sources.size()),
+                50.0,
+                sp::optional_results::distances)
+                .set_targets(dal::array<std::int64_t>::wrap(targets.data(), targets.size()));
+
+        const auto name = fmt::format("Shortest paths many_to_all: {}x{} grid, {} sources{}",
+                                      side,
+                                      side,
+                                      source_count,
+                                      with_targets ? ", targets" : "");
+        BENCHMARK(name.c_str()) {
+            return dal::preview::traverse(desc, graph);
+        };
+    }
+};
+
+#define SHORTEST_PATHS_PERF_TEST(name) \
+    TEST_M(shortest_paths_perf_test, name, "[shortest_paths][perf]")
+
+SHORTEST_PATHS_PERF_TEST("delta_stepping vs delta_stepping_fused on grid graph") {
+    const std::int64_t side = GENERATE(1000, 3000);
+    const double delta = GENERATE(25.0, 200.0);
+    this->run<sp::method::delta_stepping>("delta_stepping", side, delta);
+    this->run<sp::method::delta_stepping_fused>("delta_stepping_fused", side, delta);
+}
+
+SHORTEST_PATHS_PERF_TEST("many_to_all on grid graph") {
+    const bool with_targets = GENERATE(false, true);
+    this->run_multiple_sources(500, 256, with_targets);
+}
+
+} // namespace oneapi::dal::algo::shortest_paths::test
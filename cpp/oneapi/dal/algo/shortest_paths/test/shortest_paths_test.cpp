@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <array>
+#include <numeric>
 
 #include "oneapi/dal/algo/shortest_paths/traverse.hpp"
 #include "oneapi/dal/graph/detail/directed_adjacency_vector_graph_builder.hpp"
@@ -746,7 +747,42 @@ public:
         return result;
     }
 
-    template <typename EdgeValueType, typename Allocator, size_t Size>
+    template <typename T>
+    std::vector<T> get_all_data_from_table(const oneapi::dal::table& table) {
+        auto arr = oneapi::dal::row_accessor<const T>(table).pull();
+        return std::vector<T>(arr.get_data(), arr.get_data() + arr.get_count());
+    }
+
+    template <typename DirectedGraphType, typename EdgeValueType>
+    bool check_path(const DirectedGraphType& graph,
+                    const int32_t* predecessors,
+                    int64_t source,
+                    int64_t target,
+                    EdgeValueType distance) {
+        if (distance == std::numeric_limits<EdgeValueType>::max()) {
+            return predecessors[target] == -1;
+        }
+        const int64_t vertex_count = oneapi::dal::preview::get_vertex_count(graph);
+        EdgeValueType path_length = 0;
+        int64_t vertex = target;
+        for (int64_t step = 0; vertex != source; ++step) {
+            const int32_t predecessor = predecessors[vertex];
+            if (predecessor == -1 || step == vertex_count) {
+                return false;
+            }
+            oneapi::dal::preview::vertex_outward_edge_size_type<DirectedGraphType> from =
+                predecessor;
+            oneapi::dal::preview::vertex_outward_edge_size_type<DirectedGraphType> to = vertex;
+            path_length += oneapi::dal::preview::get_edge_value(graph, from, to);
+            vertex = predecessor;
+        }
+        return compare_distances(path_length, distance);
+    }
+
+    template <typename Method = dal::preview::shortest_paths::method::delta_stepping,
+              typename EdgeValueType,
+              typename Allocator,
+              size_t Size>
     void general_shortest_paths_check(
         const oneapi::dal::preview::directed_adjacency_vector_graph<
             int32_t,
@@ -761,7 +797,7 @@ public:
         const Allocator& alloc) {
         using namespace dal::preview::shortest_paths;
         const auto shortest_paths_desc =
-            descriptor<float, method::delta_stepping, task::one_to_all, Allocator>(
+            descriptor<float, Method, task::one_to_all, Allocator>(
                 source,
                 delta,
                 result_type,
@@ -786,7 +822,9 @@ public:
         }
     }
 
-    template <typename DirectedGraphType, typename EdgeValueType>
+    template <typename DirectedGraphType,
+              typename EdgeValueType,
+              typename Method = dal::preview::shortest_paths::method::delta_stepping>
     void shortest_paths_check(double delta, bool calculate_distances, bool calculate_predecessors) {
         DirectedGraphType graph_data;
         const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
@@ -802,12 +840,124 @@ public:
         const auto& graph = graph_builder.get_graph();
         std::allocator<char> alloc;
         const auto result_type = get_result_type(calculate_distances, calculate_predecessors);
-        general_shortest_paths_check(graph,
-                                     delta,
-                                     graph_data.get_source(),
-                                     result_type,
-                                     graph_data.distances,
-                                     alloc);
+        general_shortest_paths_check<Method>(graph,
+                                             delta,
+                                             graph_data.get_source(),
+                                             result_type,
+                                             graph_data.distances,
+                                             alloc);
+    }
+
+    template <typename DirectedGraphType,
+              typename EdgeValueType,
+              typename Method = dal::preview::shortest_paths::method::delta_stepping>
+    void targets_check(double delta, const std::vector<int64_t>& targets) {
+        using namespace dal::preview::shortest_paths;
+        DirectedGraphType graph_data;
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const auto shortest_paths_desc =
+            descriptor<float, Method, task::one_to_all>(
+                graph_data.get_source(),
+                delta,
+                optional_results::distances | optional_results::predecessors)
+                .set_targets(dal::array<int64_t>::wrap(targets.data(), targets.size()));
+        const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
+
+        const std::vector<EdgeValueType> distances =
+            get_data_from_table<EdgeValueType>(result_shortest_paths.get_distances());
+        const std::vector<int32_t> predecessors =
+            get_data_from_table<int32_t>(result_shortest_paths.get_predecessors());
+        REQUIRE(distances.size() == targets.size());
+        REQUIRE(predecessors.size() == static_cast<size_t>(graph_data.get_vertex_count()));
+        for (size_t i = 0; i < targets.size(); ++i) {
+            REQUIRE(compare_distances(graph_data.distances[targets[i]], distances[i]));
+            REQUIRE(check_path(graph,
+                               predecessors.data(),
+                               graph_data.get_source(),
+                               targets[i],
+                               distances[i]));
+        }
+    }
+
+    template <typename DirectedGraphType,
+              typename EdgeValueType,
+              typename Method = dal::preview::shortest_paths::method::delta_stepping>
+    void multiple_sources_check(double delta,
+                                const std::vector<int64_t>& sources,
+                                const std::vector<int64_t>& targets,
+                                bool calculate_predecessors) {
+        using namespace dal::preview::shortest_paths;
+        DirectedGraphType graph_data;
+        const auto graph_builder = dal::preview::detail::directed_adjacency_vector_graph_builder<
+            int32_t,
+            EdgeValueType,
+            oneapi::dal::preview::empty_value,
+            int,
+            std::allocator<char>>(graph_data.get_vertex_count(),
+                                  graph_data.get_edge_count(),
+                                  graph_data.rows.data(),
+                                  graph_data.cols.data(),
+                                  graph_data.edge_weights.data());
+        const auto& graph = graph_builder.get_graph();
+        const auto result_type = get_result_type(true, calculate_predecessors);
+        const auto shortest_paths_desc =
+            descriptor<float, Method, task::many_to_all>(
+                dal::array<int64_t>::wrap(sources.data(), sources.size()),
+                delta,
+                result_type)
+                .set_targets(dal::array<int64_t>::wrap(targets.data(), targets.size()));
+        const auto result_shortest_paths = dal::preview::traverse(shortest_paths_desc, graph);
+
+        const int64_t vertex_count = graph_data.get_vertex_count();
+        const int64_t source_count = sources.size();
+        const int64_t column_count = targets.empty() ? vertex_count : targets.size();
+        const auto& distances_table = result_shortest_paths.get_distances();
+        REQUIRE(distances_table.get_row_count() == source_count);
+        REQUIRE(distances_table.get_column_count() == column_count);
+        const std::vector<EdgeValueType> distances =
+            get_all_data_from_table<EdgeValueType>(distances_table);
+
+        std::vector<int32_t> predecessors;
+        if (calculate_predecessors) {
+            const auto& predecessors_table = result_shortest_paths.get_predecessors();
+            REQUIRE(predecessors_table.get_row_count() == source_count);
+            REQUIRE(predecessors_table.get_column_count() == vertex_count);
+            predecessors = get_all_data_from_table<int32_t>(predecessors_table);
+        }
+        else {
+            REQUIRE_THROWS_AS(result_shortest_paths.get_predecessors(),
+                              uninitialized_optional_result);
+        }
+
+        for (int64_t i = 0; i < source_count; ++i) {
+            const auto reference_desc =
+                descriptor<float, method::delta_stepping, task::one_to_all>(sources[i], delta);
+            const std::vector<EdgeValueType> reference_distances =
+                get_data_from_table<EdgeValueType>(
+                    dal::preview::traverse(reference_desc, graph).get_distances());
+            for (int64_t j = 0; j < column_count; ++j) {
+                const int64_t target = targets.empty() ? j : targets[j];
+                REQUIRE(compare_distances(reference_distances[target],
+                                          distances[i * column_count + j]));
+                if (calculate_predecessors) {
+                    REQUIRE(check_path(graph,
+                                       predecessors.data() + i * vertex_count,
+                                       sources[i],
+                                       target,
+                                       reference_distances[target]));
+                }
+            }
+        }
     }
 
     template <typename DirectedGraphType, typename EdgeValueType, typename AllocatorType>
@@ -943,4 +1093,129 @@ SHORTEST_PATHS_TEST("Non-zero source vertex, predecessors") {
     this->shortest_paths_check<d_k_15_double_edges_source_5_graph_type, double>(50, false, true);
 }
 
+using fused_method = dal::preview::shortest_paths::method::delta_stepping_fused;
+
+SHORTEST_PATHS_TEST("Fused: bucket count > number of threads, distances + predecessors") {
+    this->shortest_paths_check<d_thread_buckets_graph_type, double, fused_method>(10, true, true);
+}
+
+SHORTEST_PATHS_TEST(
+    "Fused: vertex count inside bucket > number of threads && < max_elements_in_bin, predecessors") {
+    this->shortest_paths_check<d_thread_bucket_size_graph_type, double, fused_method>(100,
+                                                                                      false,
+                                                                                      true);
+}
+
+SHORTEST_PATHS_TEST("Fused: bucket size > max_elemnents_in_bin, distances + predecessors") {
+    this->shortest_paths_check<d_max_element_bin_graph_type, double, fused_method>(1000,
+                                                                                   true,
+                                                                                   true);
+}
+
+SHORTEST_PATHS_TEST("Fused: all vertexes are isolated, int32_t edge weights") {
+    this->shortest_paths_check<d_isolated_vertexes_int_graph_type, int32_t, fused_method>(15,
+                                                                                          true,
+                                                                                          true);
+}
+
+SHORTEST_PATHS_TEST("Fused: all edge weights > delta, distances + predecessors") {
+    this->shortest_paths_check<d_graph_3_graph_type, double, fused_method>(9, true, true);
+}
+
+SHORTEST_PATHS_TEST("Fused: all vertexes inside 1 bucket, predecessors") {
+    this->shortest_paths_check<d_one_bucket_graph_type, double, fused_method>(10, false, true);
+}
+
+SHORTEST_PATHS_TEST("Fused: double edge weights, distances only") {
+    this->shortest_paths_check<d_net_10_10_double_edges_graph_type, double, fused_method>(40,
+                                                                                          true,
+                                                                                          false);
+}
+
+SHORTEST_PATHS_TEST("Fused: int32_t edge weights, distances + predecessors") {
+    this->shortest_paths_check<d_net_10_10_int_edges_graph_type, int32_t, fused_method>(40,
+                                                                                        true,
+                                                                                        true);
+}
+
+SHORTEST_PATHS_TEST("Fused: multiple connectivity components") {
+    this->shortest_paths_check<d_multiple_connectivity_components_graph_type,
+                               double,
+                               fused_method>(1.5, true, true);
+}
+
+SHORTEST_PATHS_TEST("Fused: non-zero source vertex, distances + predecessors") {
+    this->shortest_paths_check<d_k_15_double_edges_source_5_graph_type, double, fused_method>(
+        50,
+        true,
+        true);
+}
+
+SHORTEST_PATHS_TEST("Targets: double edge weights, targets near the source") {
+    this->targets_check<d_net_10_10_double_edges_graph_type, double>(40, { 1, 10, 11, 0 });
+}
+
+SHORTEST_PATHS_TEST("Targets: int32_t edge weights, all vertices") {
+    std::vector<int64_t> targets(100);
+    std::iota(targets.begin(), targets.end(), 0);
+    this->targets_check<d_net_10_10_int_edges_graph_type, int32_t>(40, targets);
+}
+
+SHORTEST_PATHS_TEST("Targets: unreachable targets") {
+    this->targets_check<d_multiple_connectivity_components_graph_type, double>(1.5, { 2, 6, 3 });
+}
+
+SHORTEST_PATHS_TEST("Fused: targets, double edge weights") {
+    this->targets_check<d_k_15_double_edges_source_5_graph_type, double, fused_method>(
+        50,
+        { 8, 3, 5 });
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: double edge weights, distances + predecessors") {
+    this->multiple_sources_check<d_net_10_10_double_edges_graph_type, double>(40,
+                                                                              { 0, 17, 55, 99, 0 },
+                                                                              {},
+                                                                              true);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: int32_t edge weights, all vertices as sources") {
+    std::vector<int64_t> sources(100);
+    std::iota(sources.begin(), sources.end(), 0);
+    this->multiple_sources_check<d_net_10_10_int_edges_graph_type, int32_t>(40,
+                                                                           sources,
+                                                                           {},
+                                                                           false);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: targets, distances + predecessors") {
+    this->multiple_sources_check<d_net_10_10_double_edges_graph_type, double>(40,
+                                                                              { 3, 50, 77 },
+                                                                              { 99, 0, 45, 3 },
+                                                                              true);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: unreachable targets") {
+    this->multiple_sources_check<d_multiple_connectivity_components_graph_type, double>(
+        1.5,
+        { 0, 4, 7 },
+        { 3, 7, 1 },
+        true);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: single source, distances + predecessors") {
+    // Fewer sources than threads, so the sources are processed by the parallel kernel
+    this->multiple_sources_check<d_net_10_10_double_edges_graph_type, double>(40,
+                                                                              { 17 },
+                                                                              { 99, 0 },
+                                                                              true);
+}
+
+SHORTEST_PATHS_TEST("Multiple sources: fused method") {
+    this->multiple_sources_check<d_k_15_double_edges_source_5_graph_type, double, fused_method>(
+        50,
+        { 5, 0, 14 },
+        {},
+        true);
+}
+
 } // namespace oneapi::dal::algo::shortest_paths::test
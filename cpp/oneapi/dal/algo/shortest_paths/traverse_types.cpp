@@ -62,5 +62,6 @@ void traverse_result<Task>::set_predecessors_impl(const table& value) {
 }
 
 template class ONEDAL_EXPORT traverse_result<task::one_to_all>;
+template class ONEDAL_EXPORT traverse_result<task::many_to_all>;
 
 } // namespace oneapi::dal::preview::shortest_paths
@@ -63,13 +63,18 @@ public:
     traverse_result();
 
     /// Returns the table with computed distances from the source to each vertex
-    /// represented as the type of weights of the graph (std::int32_t or double)
+    /// represented as the type of weights of the graph (std::int32_t or double).
+    /// For the one_to_all task the table has a single column, for the many_to_all
+    /// task the row `i` contains the distances from the i-th source. If the
+    /// targets are set, the distances are computed to the targets only.
     const table& get_distances() const {
         return get_distances_impl();
     }
 
     /// Returns the table with computed predecessors from the source to each vertex
-    // represented as std::int32_t
+    /// represented as std::int32_t, laid out in the same way as the distances.
+    /// The predecessors are returned for all the vertices even if the targets are
+    /// set, so the paths to the targets can be restored.
     const table& get_predecessors() const {
         return get_predecessors_impl();
     }
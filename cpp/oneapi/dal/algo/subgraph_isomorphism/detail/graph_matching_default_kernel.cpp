@@ -30,7 +30,7 @@ ONEDAL_EXPORT subgraph_isomorphism::graph_matching_result<task::compute> call_ke
     const dal::preview::detail::topology<std::int32_t>& p_data,
     std::int64_t* vv_t,
     std::int64_t* vv_p) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::si_call_kernel<decltype(cpu)>(si_kind,
                                                       max_match_count,
                                                       alloc_ptr,
@@ -20,6 +20,8 @@
 
 #include <daal/src/services/service_defines.h>
 
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+
 namespace oneapi::dal::preview::triangle_counting::backend {
 
 template <typename Cpu>
@@ -30,22 +32,30 @@ struct intersection_local_tc {
                                                std::int32_t n_v,
                                                std::int64_t* tc,
                                                std::int64_t tc_size) {
-        std::int64_t total = 0;
-        std::int32_t i_u = 0, i_v = 0;
-        while (i_u < n_u && i_v < n_v) {
-            if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-                return total;
-            }
-            if (neigh_u[i_u] == neigh_v[i_v]) {
-                total++, tc[neigh_u[i_u]]++;
-                i_u++, i_v++;
-            }
-            else if (neigh_u[i_u] < neigh_v[i_v])
-                i_u++;
-            else if (neigh_u[i_u] > neigh_v[i_v])
-                i_v++;
-        }
-        return total;
+        const auto count_triangle = [tc](std::int32_t w) {
+            tc[w]++;
+        };
+        return preview::backend::intersection_scalar(neigh_u, neigh_v, n_u, n_v, count_triangle);
+    }
+};
+
+template <>
+struct intersection_local_tc<dal::backend::cpu_dispatch_avx2> {
+    ONEDAL_FORCEINLINE std::int64_t operator()(const std::int32_t* neigh_u,
+                                               const std::int32_t* neigh_v,
+                                               std::int32_t n_u,
+                                               std::int32_t n_v,
+                                               std::int64_t* tc,
+                                               std::int64_t tc_size) {
+        const auto count_triangle = [tc](std::int32_t w) {
+            tc[w]++;
+        };
+        return preview::backend::intersection_simd<dal::backend::cpu_dispatch_avx2>(
+            neigh_u,
+            neigh_v,
+            n_u,
+            n_v,
+            count_triangle);
     }
 };
 
@@ -76,9 +86,19 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
                                                std::int32_t n_v,
                                                std::int64_t* tc,
                                                std::int64_t tc_size) {
+#if !defined(__INTEL_COMPILER)
+        const auto count_triangle = [tc](std::int32_t w) {
+            tc[w]++;
+        };
+        return preview::backend::intersection_simd<dal::backend::cpu_dispatch_avx512>(
+            neigh_u,
+            neigh_v,
+            n_u,
+            n_v,
+            count_triangle);
+#else
         std::int64_t total = 0;
         std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
         while (i_u < (n_u / 16) * 16 && i_v < (n_v / 16) * 16) { // not in last n%16 elements
             // assumes neighbor list is ordered
             std::int32_t min_neigh_u = neigh_u[i_u];
@@ -402,7 +422,6 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
             }
             i_v += 4;
         }
-#endif
         while (i_u < n_u && i_v < n_v) {
             if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
                 return total;
@@ -417,6 +436,7 @@ struct intersection_local_tc<dal::backend::cpu_dispatch_avx512> {
                 i_v++;
         }
         return total;
+#endif
     }
 };
 
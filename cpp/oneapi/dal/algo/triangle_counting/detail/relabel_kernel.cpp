@@ -24,7 +24,7 @@ void sort_ids_by_degree(const dal::detail::host_policy& policy,
                         const std::int32_t* degrees,
                         std::pair<std::int32_t, std::size_t>* degree_id_pairs,
                         std::int64_t vertex_count) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::sort_ids_by_degree<decltype(cpu)>(degrees, degree_id_pairs, vertex_count);
     });
 }
@@ -39,7 +39,7 @@ void fill_new_degrees_and_ids(const dal::detail::host_policy& policy,
                               std::int32_t* new_ids,
                               std::int32_t* degrees_relabel,
                               std::int64_t vertex_count) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::fill_new_degrees_and_ids<decltype(cpu)>(degree_id_pairs,
                                                                 new_ids,
                                                                 degrees_relabel,
@@ -55,7 +55,7 @@ void parallel_prefix_sum(const dal::detail::host_policy& policy,
                          std::int64_t block_size,
                          std::int64_t num_blocks,
                          std::int64_t vertex_count) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::parallel_prefix_sum<decltype(cpu)>(degrees_relabel,
                                                            offsets,
                                                            part_prefix,
@@ -72,7 +72,7 @@ void fill_relabeled_topology(const dal::detail::host_policy& policy,
                              std::int64_t* edge_offsets_relabel,
                              std::int64_t* offsets,
                              const std::int32_t* new_ids) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::fill_relabeled_topology<decltype(cpu)>(t,
                                                                vertex_neighbors_relabel,
                                                                edge_offsets_relabel,
@@ -26,7 +26,7 @@ triangle_counting<Float, task::local, dal::preview::detail::topology<std::int32_
 operator()(const dal::detail::host_policy& policy,
            const dal::preview::detail::topology<std::int32_t>& t,
            std::int64_t* triangles_local) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::triangle_counting_local<decltype(cpu)>(t, triangles_local);
     });
 }
@@ -36,7 +36,7 @@ std::int64_t
 triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, scalar>::
 operator()(const dal::detail::host_policy& policy,
            const dal::preview::detail::topology<std::int32_t>& t) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::triangle_counting_global_scalar<decltype(cpu)>(t);
     });
 }
@@ -46,7 +46,7 @@ std::int64_t
 triangle_counting<Float, task::global, dal::preview::detail::topology<std::int32_t>, vector>::
 operator()(const dal::detail::host_policy& policy,
            const dal::preview::detail::topology<std::int32_t>& t) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::triangle_counting_global_vector<decltype(cpu)>(t);
     });
 }
@@ -62,7 +62,7 @@ std::int64_t triangle_counting<Float,
                                                       const std::int32_t* degrees,
                                                       std::int64_t vertex_count,
                                                       std::int64_t edge_count) const {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::triangle_counting_global_vector_relabel<decltype(cpu)>(vertex_neighbors,
                                                                                edge_offsets,
                                                                                degrees,
@@ -74,7 +74,7 @@ std::int64_t triangle_counting<Float,
 std::int64_t compute_global_triangles(const dal::detail::host_policy& policy,
                                       const array<std::int64_t>& local_triangles,
                                       std::int64_t vertex_count) {
-    return dal::backend::dispatch_by_cpu(dal::backend::context_cpu{ policy }, [&](auto cpu) {
+    return dal::backend::dispatch_by_cpu_with_threading(policy, [&](auto cpu) {
         return backend::compute_global_triangles<decltype(cpu)>(local_triangles, vertex_count);
     });
 }
@@ -142,6 +142,17 @@ struct vertex_ranking_kernel_cpu<method::ordered_count, task::global, Allocator,
             if (average_degree < average_degree_sparsity_boundary) {
                 triangles = triangle_counting<float, task::global, Topology, scalar>()(ctx, t);
             }
+            else if (t.has_degree_ordered_topology()) {
+                // The kernel visits only the neighbors with the lower index, so it
+                // gives the same result on both symmetric and oriented views
+                triangles = triangle_counting<float, task::global, Topology, vector, relabeled>()(
+                    ctx,
+                    t._ordered_cols.get_data(),
+                    t._ordered_rows.get_data(),
+                    t._ordered_degrees.get_data(),
+                    vertex_count,
+                    edge_count);
+            }
             else {
                 std::int32_t* g_vertex_neighbors_relabel = nullptr;
                 std::int64_t* g_edge_offsets_relabel = nullptr;
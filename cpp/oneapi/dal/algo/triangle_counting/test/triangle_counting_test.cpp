@@ -17,6 +17,7 @@
 #include <array>
 
 #include "oneapi/dal/algo/triangle_counting/vertex_ranking.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
 
 #include "oneapi/dal/test/engine/common.hpp"
 
@@ -348,6 +349,32 @@ public:
         const auto result_vertex_ranking = dal::preview::vertex_ranking(tc_desc, g);
         REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
     }
+
+    template <typename GraphType>
+    void check_global_task_degree_ordered(dal::preview::degree_ordered_topology_kind kind) {
+        GraphType graph_data;
+        auto g = create_graph<GraphType>();
+        std::int64_t global_triangle_count = graph_data.get_global_triangle_count();
+
+        dal::preview::build_degree_ordered_topology(g, kind);
+        const auto &t = oneapi::dal::detail::get_impl(g).get_topology();
+        REQUIRE(t.has_degree_ordered_topology());
+
+        std::allocator<char> alloc;
+        const auto tc_desc = dal::preview::triangle_counting::descriptor<
+                                 float,
+                                 dal::preview::triangle_counting::method::ordered_count,
+                                 dal::preview::triangle_counting::task::global,
+                                 std::allocator<char>>(alloc)
+                                 .set_relabel(dal::preview::triangle_counting::relabel::yes);
+
+        // The view is kept in the graph and reused by the repeated calls
+        for (std::int32_t i = 0; i < 2; i++) {
+            const auto result_vertex_ranking = dal::preview::vertex_ranking(tc_desc, g);
+            REQUIRE(result_vertex_ranking.get_global_rank() == global_triangle_count);
+            REQUIRE(t.has_degree_ordered_topology());
+        }
+    }
 };
 
 TEST_M(triangle_counting_test, "Local task: graph with average_degree < 4") {
@@ -400,6 +427,22 @@ TEST_M(triangle_counting_test, "Global task: not relabeled graph with average_de
     this->check_global_task_not_relabeled<graph_with_isolated_vertex_11_type>();
 }
 
+TEST_M(triangle_counting_test, "Global task: graph with symmetric degree-ordered topology") {
+    using dal::preview::degree_ordered_topology_kind;
+    this->check_global_task_degree_ordered<complete_graph_9_type>(
+        degree_ordered_topology_kind::symmetric);
+    this->check_global_task_degree_ordered<graph_with_isolated_vertex_11_type>(
+        degree_ordered_topology_kind::symmetric);
+}
+
+TEST_M(triangle_counting_test, "Global task: graph with oriented degree-ordered topology") {
+    using dal::preview::degree_ordered_topology_kind;
+    this->check_global_task_degree_ordered<complete_graph_9_type>(
+        degree_ordered_topology_kind::oriented);
+    this->check_global_task_degree_ordered<graph_with_isolated_vertex_11_type>(
+        degree_ordered_topology_kind::oriented);
+}
+
 TEST_M(triangle_counting_test, "Local task: null graph") {
     dal::preview::undirected_adjacency_vector_graph<> null_graph;
     std::allocator<char> alloc;
@@ -67,8 +67,10 @@ public:
             : public_comm_(comm),
               is_distributed_(false) {}
 
+    /// Returns true if the communicator spans more than one rank. A single-rank
+    /// communicator takes the same code path as a non-distributed run.
     bool is_distributed() const {
-        return is_distributed_;
+        return is_distributed_ && get_rank_count() > 1;
     }
 
     std::int64_t get_rank() const {
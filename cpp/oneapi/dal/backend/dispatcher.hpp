@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <exception>
+#include <optional>
+
 #include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/detail/spmd_policy.hpp"
 
 #include "oneapi/dal/backend/common.hpp"
@@ -28,6 +32,9 @@
 #define KERNEL_SINGLE_NODE_CPU(...) \
     KERNEL_SPEC(::oneapi::dal::backend::single_node_cpu_kernel, __VA_ARGS__)
 
+#define KERNEL_UNIVERSAL_SPMD_CPU(...) \
+    KERNEL_SPEC(::oneapi::dal::backend::universal_spmd_cpu_kernel, __VA_ARGS__)
+
 #define KERNEL_SINGLE_NODE_GPU(...) \
     KERNEL_SPEC(::oneapi::dal::backend::single_node_gpu_kernel, __VA_ARGS__)
 
@@ -135,9 +142,56 @@ inline auto dispatch_by_device(const detail::data_parallel_policy& policy,
 }
 #endif
 
+/// Runs the body in the dedicated task arena if the host policy limits the
+/// thread count, requests isolation or pins the threads, otherwise runs it
+/// in the calling thread's arena
+template <typename Body>
+inline auto dispatch_by_threading(const detail::host_policy& policy, Body&& body) {
+    if (!policy.has_threading_constraints()) {
+        return body();
+    }
+
+    const auto max_threads =
+        dal::detail::integral_cast<std::int32_t>(policy.get_max_threads());
+    const auto& cpu_ids = policy.get_cpu_affinity();
+    const auto cpu_count = dal::detail::integral_cast<std::int32_t>(cpu_ids.size());
+
+    using result_t = decltype(body());
+    std::optional<std::conditional_t<std::is_void_v<result_t>, bool, result_t>> result;
+    std::exception_ptr error;
+
+    // The exception is not thrown through the threading layer,
+    // it is rethrown in the calling thread instead
+    detail::threader_execute_in_arena(max_threads, cpu_ids.data(), cpu_count, [&]() {
+        try {
+            if constexpr (std::is_void_v<result_t>) {
+                body();
+                result.emplace(true);
+            }
+            else {
+                result.emplace(body());
+            }
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+    });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    if constexpr (!std::is_void_v<result_t>) {
+        return std::move(*result);
+    }
+}
+
 /// Tag that indicates CPU kernel for single-node
 struct single_node_cpu_kernel {};
 
+/// Tag that indicates universal CPU kernel for single-node and SPMD modes
+struct universal_spmd_cpu_kernel {};
+
 /// Tag that indicates GPU kernel for single-node
 struct single_node_gpu_kernel {};
 
@@ -168,7 +222,9 @@ template <typename CpuKernel>
 struct kernel_dispatcher<kernel_spec<single_node_cpu_kernel, CpuKernel>> {
     template <typename... Args>
     auto operator()(const detail::host_policy& policy, Args&&... args) const {
-        return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+        return dispatch_by_threading(policy, [&]() {
+            return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+        });
     }
 
     template <typename... Args>
@@ -209,6 +265,44 @@ struct kernel_dispatcher<kernel_spec<single_node_cpu_kernel, CpuKernel>> {
 #endif
 };
 
+/// Dispatcher for the case of only CPU algorithm based on universal SPMD kernel.
+/// The kernel gets the communicator of the SPMD policy via the context, in the
+/// single-node mode the communicator consists of the only rank
+template <typename CpuKernel>
+struct kernel_dispatcher<kernel_spec<universal_spmd_cpu_kernel, CpuKernel>> {
+    template <typename... Args>
+    auto operator()(const detail::host_policy& policy, Args&&... args) const {
+        return dispatch_by_threading(policy, [&]() {
+            return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+        });
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_host_policy& policy, Args&&... args) const {
+        return dispatch_by_threading(policy.get_local(), [&]() {
+            return CpuKernel{}(context_cpu{ policy }, std::forward<Args>(args)...);
+        });
+    }
+
+#ifdef ONEDAL_DATA_PARALLEL
+    template <typename... Args>
+    auto operator()(const detail::data_parallel_policy& policy, Args&&... args) const {
+        return kernel_dispatcher<kernel_spec<single_node_cpu_kernel, CpuKernel>>{}(
+            policy,
+            std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    auto operator()(const detail::spmd_data_parallel_policy& policy, Args&&... args) const
+        -> cpu_kernel_return_t<CpuKernel, Args...> {
+        // We have to specify return type for this function as compiler cannot
+        // infer it from a body that consist of single `throw` expression
+        using msg = detail::error_messages;
+        throw unimplemented{ msg::spmd_version_of_algorithm_is_not_implemented() };
+    }
+#endif
+};
+
 #ifdef ONEDAL_DATA_PARALLEL
 /// Dispatcher for the case of single-node CPU and GPU algorithm
 template <typename CpuKernel, typename GpuKernel>
@@ -297,6 +391,16 @@ inline constexpr auto dispatch_by_cpu(const context_cpu& ctx, Op&& op) {
     return op(cpu_dispatch_default{});
 }
 
+/// Dispatches the body by the CPU extensions of the host policy and runs it in
+/// the task arena requested by the threading settings of the policy. Used by the
+/// kernels that are called without the kernel dispatcher, e.g. graph algorithms
+template <typename Op>
+inline auto dispatch_by_cpu_with_threading(const detail::host_policy& policy, Op&& op) {
+    return dispatch_by_threading(policy, [&]() {
+        return dispatch_by_cpu(context_cpu{ policy }, std::forward<Op>(op));
+    });
+}
+
 template <typename Op>
 inline constexpr auto dispatch_by_data_type(data_type dtype, Op&& op) {
     using msg = dal::detail::error_messages;
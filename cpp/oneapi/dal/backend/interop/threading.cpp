@@ -137,6 +137,18 @@ ONEDAL_EXPORT void _onedal_del_mutex(void *mutex_ptr) {
     _daal_del_mutex(mutex_ptr);
 }
 
+ONEDAL_EXPORT void _onedal_execute_in_arena(std::int32_t max_concurrency,
+                                            const std::int32_t *cpu_ids,
+                                            std::int32_t cpu_count,
+                                            const void *a,
+                                            oneapi::dal::preview::functype_arena func) {
+    _daal_execute_in_arena(max_concurrency,
+                           cpu_ids,
+                           cpu_count,
+                           a,
+                           static_cast<daal::functype_arena>(func));
+}
+
 namespace oneapi::dal::detail {
 
 typedef std::pair<std::int32_t, size_t> pair_int32_t_size_t;
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::backend {
+
+namespace de = dal::detail;
+
+#if defined(_WIN32) || defined(_WIN64)
+
+mapped_file::mapped_file(const std::string& file_name) {
+    HANDLE file = CreateFileA(file_name.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw invalid_argument{ de::error_messages::file_not_found() };
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        throw internal_error{ de::error_messages::file_mapping_failed() };
+    }
+    size_ = static_cast<std::int64_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw internal_error{ de::error_messages::file_mapping_failed() };
+    }
+    mapping_handle_ = mapping;
+
+    data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw internal_error{ de::error_messages::file_mapping_failed() };
+    }
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+}
+
+#else
+
+mapped_file::mapped_file(const std::string& file_name) {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw invalid_argument{ de::error_messages::file_not_found() };
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw internal_error{ de::error_messages::file_mapping_failed() };
+    }
+    size_ = static_cast<std::int64_t>(file_stat.st_size);
+    if (size_ == 0) {
+        close(fd);
+        return;
+    }
+
+    void* data = mmap(nullptr, static_cast<std::size_t>(size_), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw internal_error{ de::error_messages::file_mapping_failed() };
+    }
+
+#if defined(MADV_SEQUENTIAL)
+    madvise(data, static_cast<std::size_t>(size_), MADV_SEQUENTIAL);
+#endif
+    data_ = static_cast<const char*>(data);
+}
+
+mapped_file::~mapped_file() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), static_cast<std::size_t>(size_));
+    }
+}
+
+#endif
+
+} // namespace oneapi::dal::backend
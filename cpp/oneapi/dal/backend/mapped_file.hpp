@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/backend/common.hpp"
+
+namespace oneapi::dal::backend {
+
+/// Read-only memory mapping of the whole file. The mapped region is released
+/// together with the object, so the pointers returned by `get_data` must not
+/// outlive it.
+class mapped_file : public base {
+public:
+    explicit mapped_file(const std::string& file_name);
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    const char* get_data() const {
+        return data_;
+    }
+
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+private:
+    const char* data_ = nullptr;
+    std::int64_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace oneapi::dal::backend
@@ -17,31 +17,13 @@
 #pragma once
 
 #include <immintrin.h>
+#include <type_traits>
 
 #include <daal/src/services/service_defines.h>
 
-namespace oneapi::dal::preview::backend {
+#include "oneapi/dal/backend/dispatcher.hpp"
 
-template <typename Cpu>
-ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
-                                             const std::int32_t *neigh_v,
-                                             std::int32_t n_u,
-                                             std::int32_t n_v) {
-    std::int64_t total = 0;
-    std::int32_t i_u = 0, i_v = 0;
-    while (i_u < n_u && i_v < n_v) {
-        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-            return total;
-        }
-        if (neigh_u[i_u] == neigh_v[i_v])
-            total++, i_u++, i_v++;
-        else if (neigh_u[i_u] < neigh_v[i_v])
-            i_u++;
-        else if (neigh_u[i_u] > neigh_v[i_v])
-            i_v++;
-    }
-    return total;
-}
+namespace oneapi::dal::preview::backend {
 
 #if defined(__INTEL_COMPILER)
 ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
@@ -62,15 +44,208 @@ ONEDAL_FORCEINLINE std::int32_t _popcnt32_redef(const std::int32_t &x) {
     {}
 #endif
 
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define ONEDAL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ONEDAL_TARGET_AVX2
+#endif
+
+/// Action on the common elements of the sets that does nothing,
+/// the intersection kernels only count the common elements with it
+struct ignore_matches {
+    ONEDAL_FORCEINLINE void operator()(std::int32_t) const {}
+};
+
+/// The size ratio of the sets starting from which the elements of the smaller set
+/// are searched in the larger set instead of merging the sets
+constexpr std::int32_t galloping_size_ratio = 32;
+
+/// Merge-based intersection of two sorted sets. Calls `on_match` for every common element
+/// and returns the number of the common elements
+template <typename OnMatch>
+ONEDAL_FORCEINLINE std::int64_t intersection_merge(const std::int32_t *neigh_u,
+                                                   const std::int32_t *neigh_v,
+                                                   std::int32_t n_u,
+                                                   std::int32_t n_v,
+                                                   OnMatch &&on_match) {
+    std::int64_t total = 0;
+    std::int32_t i_u = 0, i_v = 0;
+    while (i_u < n_u && i_v < n_v) {
+        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
+            return total;
+        }
+        if (neigh_u[i_u] == neigh_v[i_v]) {
+            on_match(neigh_u[i_u]);
+            total++, i_u++, i_v++;
+        }
+        else if (neigh_u[i_u] < neigh_v[i_v])
+            i_u++;
+        else if (neigh_u[i_u] > neigh_v[i_v])
+            i_v++;
+    }
+    return total;
+}
+
+/// Intersection of a small sorted set with a much larger one. Every element of the small
+/// set is searched in the large set by the exponential search starting from the position
+/// of the previous element, so the complexity is O(n_small * log(n_large / n_small))
+template <typename OnMatch>
+ONEDAL_FORCEINLINE std::int64_t intersection_galloping(const std::int32_t *neigh_small,
+                                                       const std::int32_t *neigh_large,
+                                                       std::int32_t n_small,
+                                                       std::int32_t n_large,
+                                                       OnMatch &&on_match) {
+    std::int64_t total = 0;
+    std::int64_t low = 0;
+    for (std::int32_t i = 0; i < n_small; i++) {
+        const std::int32_t value = neigh_small[i];
+        std::int64_t high = low;
+        for (std::int64_t step = 1; high < n_large && neigh_large[high] < value; step *= 2) {
+            low = high + 1;
+            high += step;
+        }
+        high = (high < n_large) ? high : n_large;
+        // neigh_large[low - 1] < value <= neigh_large[high]
+        while (low < high) {
+            const std::int64_t middle = low + (high - low) / 2;
+            if (neigh_large[middle] < value)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        if (low == n_large) {
+            break;
+        }
+        if (neigh_large[low] == value) {
+            on_match(value);
+            total++, low++;
+        }
+    }
+    return total;
+}
+
+/// Scalar intersection of two sorted sets, chooses between the merge and the galloping
+/// search depending on the set sizes
+template <typename OnMatch>
+ONEDAL_FORCEINLINE std::int64_t intersection_scalar(const std::int32_t *neigh_u,
+                                                    const std::int32_t *neigh_v,
+                                                    std::int32_t n_u,
+                                                    std::int32_t n_v,
+                                                    OnMatch &&on_match) {
+    if (n_u == 0 || n_v == 0) {
+        return 0;
+    }
+    if (n_u > galloping_size_ratio * static_cast<std::int64_t>(n_v)) {
+        return intersection_galloping(neigh_v, neigh_u, n_v, n_u, on_match);
+    }
+    if (n_v > galloping_size_ratio * static_cast<std::int64_t>(n_u)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v, on_match);
+    }
+    return intersection_merge(neigh_u, neigh_v, n_u, n_v, on_match);
+}
+
+/// AVX2 intersection of two sorted sets without duplicates. The sets are processed by
+/// blocks of 8 elements, each pair of overlapping blocks is compared with all 8 cyclic
+/// shifts of one of the blocks. The remainders of the sets are merged by the scalar code.
+/// The function is compiled for AVX2 regardless of the flags of the translation unit,
+/// the callers must check that the CPU supports AVX2
+template <typename OnMatch>
+ONEDAL_TARGET_AVX2 inline std::int64_t intersection_avx2(const std::int32_t *neigh_u,
+                                                         const std::int32_t *neigh_v,
+                                                         std::int32_t n_u,
+                                                         std::int32_t n_v,
+                                                         OnMatch &&on_match) {
+    if (n_u == 0 || n_v == 0) {
+        return 0;
+    }
+    if (n_u > galloping_size_ratio * static_cast<std::int64_t>(n_v)) {
+        return intersection_galloping(neigh_v, neigh_u, n_v, n_u, on_match);
+    }
+    if (n_v > galloping_size_ratio * static_cast<std::int64_t>(n_u)) {
+        return intersection_galloping(neigh_u, neigh_v, n_u, n_v, on_match);
+    }
+
+    const __m256i shift = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+    std::int64_t total = 0;
+    std::int32_t i_u = 0, i_v = 0;
+    while (i_u + 8 <= n_u && i_v + 8 <= n_v) {
+        const std::int32_t max_neigh_u = neigh_u[i_u + 7];
+        const std::int32_t max_neigh_v = neigh_v[i_v + 7];
+        if (neigh_u[i_u] > max_neigh_v) {
+            i_v += 8;
+            continue;
+        }
+        if (neigh_v[i_v] > max_neigh_u) {
+            i_u += 8;
+            continue;
+        }
+
+        const __m256i v_u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_u + i_u));
+        __m256i v_v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_v + i_v));
+        __m256i match = _mm256_cmpeq_epi32(v_u, v_v);
+        for (std::int32_t k = 1; k < 8; k++) {
+            v_v = _mm256_permutevar8x32_epi32(v_v, shift);
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi32(v_u, v_v));
+        }
+        const std::int32_t scalar_match = _mm256_movemask_ps(_mm256_castsi256_ps(match));
+        if (scalar_match != 0) {
+            total += _popcnt32_redef(scalar_match);
+            for (std::int32_t k = 0; k < 8; k++) {
+                if (scalar_match & (1 << k)) {
+                    on_match(neigh_u[i_u + k]);
+                }
+            }
+        }
+
+        i_u = (max_neigh_u <= max_neigh_v) ? i_u + 8 : i_u;
+        i_v = (max_neigh_v <= max_neigh_u) ? i_v + 8 : i_v;
+    }
+    if (i_u < n_u && i_v < n_v) {
+        total +=
+            intersection_merge(neigh_u + i_u, neigh_v + i_v, n_u - i_u, n_v - i_v, on_match);
+    }
+    return total;
+}
+
+/// Intersection of two sorted sets with the instruction set of the CPU dispatch tag
+template <typename Cpu, typename OnMatch>
+ONEDAL_FORCEINLINE std::int64_t intersection_simd(const std::int32_t *neigh_u,
+                                                  const std::int32_t *neigh_v,
+                                                  std::int32_t n_u,
+                                                  std::int32_t n_v,
+                                                  OnMatch &&on_match) {
+    if constexpr (std::is_same_v<Cpu, dal::backend::cpu_dispatch_avx2> ||
+                  std::is_same_v<Cpu, dal::backend::cpu_dispatch_avx512>) {
+        return intersection_avx2(neigh_u, neigh_v, n_u, n_v, on_match);
+    }
+    else {
+        return intersection_scalar(neigh_u, neigh_v, n_u, n_v, on_match);
+    }
+}
+
+template <typename Cpu>
+ONEDAL_FORCEINLINE std::int64_t intersection(const std::int32_t *neigh_u,
+                                             const std::int32_t *neigh_v,
+                                             std::int32_t n_u,
+                                             std::int32_t n_v) {
+    return intersection_scalar(neigh_u, neigh_v, n_u, n_v, ignore_matches{});
+}
+
 template <>
 ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
     const std::int32_t *neigh_u,
     const std::int32_t *neigh_v,
     std::int32_t n_u,
     std::int32_t n_v) {
+#if !defined(__INTEL_COMPILER)
+    return intersection_simd<dal::backend::cpu_dispatch_avx512>(neigh_u,
+                                                                neigh_v,
+                                                                n_u,
+                                                                n_v,
+                                                                ignore_matches{});
+#else
     std::int64_t total = 0;
     std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
     while (i_u < (n_u / 16) * 16 && i_v < (n_v / 16) * 16) { // not in last n%16 elements
         // assumes neighbor list is ordered
         std::int32_t min_neigh_u = neigh_u[i_u];
@@ -339,7 +514,6 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
         }
         i_v += 4;
     }
-#endif
     while (i_u < n_u && i_v < n_v) {
         if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
             return total;
@@ -352,6 +526,7 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx512>(
             i_v++;
     }
     return total;
+#endif
 }
 
 template <>
@@ -360,214 +535,11 @@ ONEDAL_FORCEINLINE std::int64_t intersection<dal::backend::cpu_dispatch_avx2>(
     const std::int32_t *neigh_v,
     std::int32_t n_u,
     std::int32_t n_v) {
-    std::int64_t total = 0;
-    std::int32_t i_u = 0, i_v = 0;
-#if defined(__INTEL_COMPILER)
-    const std::int32_t n_u_8_end = n_u - 8;
-    const std::int32_t n_v_8_end = n_v - 8;
-    while (i_u <= n_u_8_end && i_v <= n_v_8_end) {
-        const std::int32_t min_neigh_u = neigh_u[i_u];
-        const std::int32_t max_neigh_v = neigh_v[i_v + 7];
-
-        if (min_neigh_u > max_neigh_v) {
-            if (min_neigh_u > neigh_v[n_v - 1]) {
-                return total;
-            }
-            i_v += 8;
-            continue;
-        }
-
-        const std::int32_t max_neigh_u = neigh_u[i_u + 7]; // assumes neighbor list is ordered
-        const std::int32_t min_neigh_v = neigh_v[i_v];
-
-        if (min_neigh_v > max_neigh_u) {
-            if (min_neigh_v > neigh_u[n_u - 1]) {
-                return total;
-            }
-            i_u += 8;
-            continue;
-        }
-
-        __m256i v_u = _mm256_loadu_si256(
-            reinterpret_cast<const __m256i *>(neigh_u + i_u)); // load 8 neighbors of u
-        __m256i v_v = _mm256_loadu_si256(
-            reinterpret_cast<const __m256i *>(neigh_v + i_v)); // load 8 neighbors of v
-
-        i_v = (max_neigh_u >= max_neigh_v) ? i_v + 8 : i_v;
-        i_u = (max_neigh_u <= max_neigh_v) ? i_u + 8 : i_u;
-
-        __m256i match = _mm256_cmpeq_epi32(v_u, v_v);
-        unsigned int scalar_match = _mm256_movemask_ps(_mm256_castsi256_ps(match));
-
-        if (scalar_match != 255) { // shortcut case where all neighbors match
-            __m256i circ1 = _mm256_set_epi32(0,
-                                             7,
-                                             6,
-                                             5,
-                                             4,
-                                             3,
-                                             2,
-                                             1); // all possible circular shifts for 16 elements
-            __m256i circ2 = _mm256_set_epi32(1, 0, 7, 6, 5, 4, 3, 2);
-            __m256i circ3 = _mm256_set_epi32(2, 1, 0, 7, 6, 5, 4, 3);
-            __m256i circ4 = _mm256_set_epi32(3, 2, 1, 0, 7, 6, 5, 4);
-            __m256i circ5 = _mm256_set_epi32(4, 3, 2, 1, 0, 7, 6, 5);
-            __m256i circ6 = _mm256_set_epi32(5, 4, 3, 2, 1, 0, 7, 6);
-            __m256i circ7 = _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 7);
-
-            __m256i v_v1 = _mm256_permutevar8x32_epi32(v_v, circ1);
-            __m256i v_v2 = _mm256_permutevar8x32_epi32(v_v, circ2);
-            __m256i v_v3 = _mm256_permutevar8x32_epi32(v_v, circ3);
-            __m256i v_v4 = _mm256_permutevar8x32_epi32(v_v, circ4);
-            __m256i v_v5 = _mm256_permutevar8x32_epi32(v_v, circ5);
-            __m256i v_v6 = _mm256_permutevar8x32_epi32(v_v, circ6);
-            __m256i v_v7 = _mm256_permutevar8x32_epi32(v_v, circ7);
-
-            __m256i tmp_match1 = _mm256_cmpeq_epi32(v_u, v_v1); // find matches
-            __m256i tmp_match2 = _mm256_cmpeq_epi32(v_u, v_v2);
-            __m256i tmp_match3 = _mm256_cmpeq_epi32(v_u, v_v3);
-            __m256i tmp_match4 = _mm256_cmpeq_epi32(v_u, v_v4);
-            __m256i tmp_match5 = _mm256_cmpeq_epi32(v_u, v_v5);
-            __m256i tmp_match6 = _mm256_cmpeq_epi32(v_u, v_v6);
-            __m256i tmp_match7 = _mm256_cmpeq_epi32(v_u, v_v7);
-
-            unsigned int scalar_match1 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match1));
-            unsigned int scalar_match2 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match2));
-            unsigned int scalar_match3 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match3));
-            unsigned int scalar_match4 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match4));
-            unsigned int scalar_match5 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match5));
-            unsigned int scalar_match6 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match6));
-            unsigned int scalar_match7 = _mm256_movemask_ps(_mm256_castsi256_ps(tmp_match7));
-            unsigned int final_match = scalar_match | scalar_match1 | scalar_match2 |
-                                       scalar_match3 | scalar_match4 | scalar_match5 |
-                                       scalar_match6 | scalar_match7;
-
-            total += _popcnt32_redef(final_match);
-        }
-        else {
-            total += 8; //count number of matches
-        }
-    }
-
-    for (; i_u <= n_u_8_end && i_v < n_v; i_u += 8) {
-        __m256i v_u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(neigh_u + i_u));
-
-        const std::int32_t neighu_iu = neigh_u[i_u + 7];
-        for (; neigh_v[i_v] <= neighu_iu && i_v < n_v; i_v++) {
-            __m256i tmp_v_v = _mm256_set1_epi32(neigh_v[i_v]);
-
-            __m256i match = _mm256_cmpeq_epi32(v_u, tmp_v_v);
-            unsigned int scalar_match = _mm256_movemask_ps(_mm256_castsi256_ps(match));
-            total = scalar_match != 0 ? total + 1 : total;
-        }
-    }
-    for (; i_v <= n_v_8_end && i_u < n_u; i_v += 8) {
-        __m256i v_v = _mm256_loadu_si256(
-            reinterpret_cast<const __m256i *>(neigh_v + i_v)); // load 8 neighbors of v
-        const std::int32_t neighv_iv = neigh_v[i_v + 7];
-        for (; neigh_u[i_u] <= neighv_iv && i_u < n_u; i_u++) {
-            __m256i tmp_v_u = _mm256_set1_epi32(neigh_u[i_u]);
-            __m256i match = _mm256_cmpeq_epi32(v_v, tmp_v_u);
-            unsigned int scalar_match = _mm256_movemask_ps(_mm256_castsi256_ps(match));
-            total = scalar_match != 0 ? total + 1 : total;
-        }
-    }
-
-    const std::int32_t n_u_4_end = n_u - 4;
-    const std::int32_t n_v_4_end = n_v - 4;
-
-    while (i_u <= n_u_4_end && i_v <= n_v_4_end) { // not in last n%8 elements
-        // assumes neighbor list is ordered
-        std::int32_t min_neigh_u = neigh_u[i_u];
-        std::int32_t max_neigh_v = neigh_v[i_v + 3];
-
-        if (min_neigh_u > max_neigh_v) {
-            if (min_neigh_u > neigh_v[n_v - 1]) {
-                return total;
-            }
-            i_v += 4;
-            continue;
-        }
-        std::int32_t min_neigh_v = neigh_v[i_v];
-        std::int32_t max_neigh_u = neigh_u[i_u + 3];
-        if (min_neigh_v > max_neigh_u) {
-            if (min_neigh_v > neigh_u[n_u - 1]) {
-                return total;
-            }
-            i_u += 4;
-            continue;
-        }
-
-        __m128i v_u = _mm_loadu_si128(
-            reinterpret_cast<const __m128i *>(neigh_u + i_u)); // load 8 neighbors of u
-        __m128i v_v = _mm_loadu_si128(
-            reinterpret_cast<const __m128i *>(neigh_v + i_v)); // load 8 neighbors of v
-
-        i_v = (max_neigh_u >= max_neigh_v) ? i_v + 4 : i_v;
-        i_u = (max_neigh_u <= max_neigh_v) ? i_u + 4 : i_u;
-
-        __m128i match = _mm_cmpeq_epi32(v_u, v_v);
-        unsigned int scalar_match = _mm_movemask_ps(_mm_castsi128_ps(match));
-
-        if (scalar_match != 15) { // shortcut case where all neighbors match
-            __m128i v_v1 = _mm_shuffle_epi32(v_v, _MM_SHUFFLE(0, 3, 2, 1));
-            __m128i v_v2 = _mm_shuffle_epi32(v_v, _MM_SHUFFLE(1, 0, 3, 2));
-            __m128i v_v3 = _mm_shuffle_epi32(v_v, _MM_SHUFFLE(2, 1, 0, 3));
-
-            __m128i tmp_match1 = _mm_cmpeq_epi32(v_u, v_v1); // find matches
-            __m128i tmp_match2 = _mm_cmpeq_epi32(v_u, v_v2);
-            __m128i tmp_match3 = _mm_cmpeq_epi32(v_u, v_v3);
-
-            unsigned int scalar_match1 = _mm_movemask_ps(_mm_castsi128_ps(tmp_match1));
-            unsigned int scalar_match2 = _mm_movemask_ps(_mm_castsi128_ps(tmp_match2));
-            unsigned int scalar_match3 = _mm_movemask_ps(_mm_castsi128_ps(tmp_match3));
-
-            unsigned int final_match = scalar_match | scalar_match1 | scalar_match2 | scalar_match3;
-
-            total += _popcnt32_redef(final_match);
-        }
-        else {
-            total += 4; //count number of matches
-        }
-    }
-
-    if (i_u <= n_u_4_end && i_v < n_v) {
-        __m128i v_u = _mm_loadu_si128(
-            reinterpret_cast<const __m128i *>(neigh_u + i_u)); // load 8 neighbors of u
-        const std::int32_t neighu_iu = neigh_u[i_u + 3];
-        for (; neigh_v[i_v] <= neighu_iu && i_v < n_v; i_v++) {
-            __m128i tmp_v_v = _mm_set1_epi32(neigh_v[i_v]);
-            __m128i match = _mm_cmpeq_epi32(v_u, tmp_v_v);
-            unsigned int scalar_match = _mm_movemask_ps(_mm_castsi128_ps(match));
-            total = scalar_match != 0 ? total + 1 : total;
-        }
-        i_u += 4;
-    }
-    if (i_v <= n_v_4_end && i_u < n_u) {
-        __m128i v_v = _mm_loadu_si128(
-            reinterpret_cast<const __m128i *>(neigh_v + i_v)); // load 8 neighbors of v
-        const std::int32_t neighv_iv = neigh_v[i_v + 3];
-        for (; neigh_u[i_u] <= neighv_iv && i_u < n_u; i_u++) {
-            __m128i tmp_v_u = _mm_set1_epi32(neigh_u[i_u]);
-            __m128i match = _mm_cmpeq_epi32(v_v, tmp_v_u);
-            unsigned int scalar_match = _mm_movemask_ps(_mm_castsi128_ps(match));
-            total = scalar_match != 0 ? total + 1 : total;
-        }
-        i_v += 4;
-    }
-#endif
-    while (i_u < n_u && i_v < n_v) {
-        if ((neigh_u[i_u] > neigh_v[n_v - 1]) || (neigh_v[i_v] > neigh_u[n_u - 1])) {
-            return total;
-        }
-        if (neigh_u[i_u] == neigh_v[i_v])
-            total++, i_u++, i_v++;
-        else if (neigh_u[i_u] < neigh_v[i_v])
-            i_u++;
-        else if (neigh_u[i_u] > neigh_v[i_v])
-            i_v++;
-    }
-    return total;
+    return intersection_simd<dal::backend::cpu_dispatch_avx2>(neigh_u,
+                                                              neigh_v,
+                                                              n_u,
+                                                              n_v,
+                                                              ignore_matches{});
 }
 
 } // namespace oneapi::dal::preview::backend
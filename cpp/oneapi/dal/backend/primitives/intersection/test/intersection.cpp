@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/backend/primitives/intersection/intersection.hpp"
+
+namespace oneapi::dal::backend::primitives::test {
+
+namespace pb = oneapi::dal::preview::backend;
+
+class intersection_test {
+public:
+    std::vector<std::int32_t> generate_set(std::int32_t size, std::int32_t max_value) {
+        std::uniform_int_distribution<std::int32_t> distribution(0, max_value);
+        std::vector<std::int32_t> set(size);
+        for (auto& value : set) {
+            value = distribution(engine_);
+        }
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+        return set;
+    }
+
+    void check_intersection(const std::vector<std::int32_t>& u,
+                            const std::vector<std::int32_t>& v) {
+        std::vector<std::int32_t> expected;
+        std::set_intersection(u.begin(), u.end(), v.begin(), v.end(), std::back_inserter(expected));
+        const auto n_u = static_cast<std::int32_t>(u.size());
+        const auto n_v = static_cast<std::int32_t>(v.size());
+        const auto expected_count = static_cast<std::int64_t>(expected.size());
+
+        std::vector<std::int32_t> matches;
+        const auto collect = [&](std::int32_t w) {
+            matches.push_back(w);
+        };
+
+        REQUIRE(pb::intersection_scalar(u.data(), v.data(), n_u, n_v, collect) == expected_count);
+        std::sort(matches.begin(), matches.end());
+        REQUIRE(matches == expected);
+
+        REQUIRE(pb::intersection<dal::backend::cpu_dispatch_default>(u.data(),
+                                                                     v.data(),
+                                                                     n_u,
+                                                                     n_v) == expected_count);
+
+        // The AVX2 kernel is compiled regardless of the test flags, so it is checked
+        // against the scalar one on every CPU that supports it
+        if (!is_avx2_supported()) {
+            return;
+        }
+        matches.clear();
+        REQUIRE(pb::intersection_avx2(u.data(), v.data(), n_u, n_v, collect) == expected_count);
+        std::sort(matches.begin(), matches.end());
+        REQUIRE(matches == expected);
+
+        REQUIRE(pb::intersection<dal::backend::cpu_dispatch_avx2>(u.data(),
+                                                                  v.data(),
+                                                                  n_u,
+                                                                  n_v) == expected_count);
+    }
+
+    bool is_avx2_supported() const {
+        return dal::backend::test_cpu_extension(dal::backend::detect_top_cpu_extension(),
+                                                dal::detail::cpu_extension::avx2);
+    }
+
+private:
+    std::mt19937 engine_{ 7777 };
+};
+
+TEST_M(intersection_test, "intersection of equal sized sets", "[intersection]") {
+    const std::int32_t size = GENERATE(0, 1, 7, 8, 9, 16, 63, 100, 1000);
+    const std::int32_t max_value = GENERATE(10, 200, 5000);
+    const auto u = generate_set(size, max_value);
+    const auto v = generate_set(size, max_value);
+    check_intersection(u, v);
+    check_intersection(v, u);
+    check_intersection(u, u);
+}
+
+TEST_M(intersection_test, "intersection of sets with skewed sizes", "[intersection]") {
+    const std::int32_t small_size = GENERATE(1, 5, 30);
+    const std::int32_t large_size = GENERATE(40, 1000, 20000);
+    const auto u = generate_set(small_size, 2 * large_size);
+    const auto v = generate_set(large_size, 2 * large_size);
+    check_intersection(u, v);
+    check_intersection(v, u);
+}
+
+TEST_M(intersection_test, "intersection of disjoint and nested sets", "[intersection]") {
+    std::vector<std::int32_t> evens, odds, all;
+    for (std::int32_t i = 0; i < 500; i++) {
+        (i % 2 ? odds : evens).push_back(i);
+        all.push_back(i);
+    }
+    check_intersection(evens, odds);
+    check_intersection(evens, all);
+    check_intersection(all, odds);
+}
+
+} // namespace oneapi::dal::backend::primitives::test
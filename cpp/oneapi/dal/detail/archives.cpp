@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "oneapi/dal/detail/archives.hpp"
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::detail::v1 {
+
+file_output_archive::file_output_archive(const std::string& file_name, std::int64_t buffer_size) {
+    ONEDAL_ASSERT(buffer_size > 0);
+    file_ = std::fopen(file_name.c_str(), "wb");
+    if (!file_) {
+        throw internal_error{ error_messages::file_write_failed() };
+    }
+    // The archive buffers the small values itself and passes the large ones
+    // to the file as is, so the stream buffer would only add a copy
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+    buffer_ = array<byte_t>::empty(buffer_size);
+}
+
+file_output_archive::~file_output_archive() {
+    try {
+        flush();
+    }
+    catch (...) {
+        // The destructor must not throw, the write errors are reported by epilogue
+    }
+    std::fclose(file_);
+}
+
+void file_output_archive::prologue() {
+    is_valid_ = false;
+    const std::uint32_t magic = binary_archive_magic;
+    operator()(&magic, make_data_type<std::uint32_t>());
+}
+
+void file_output_archive::epilogue() {
+    flush();
+    if (std::fflush(file_) != 0) {
+        throw internal_error{ error_messages::file_write_failed() };
+    }
+    is_valid_ = true;
+}
+
+void file_output_archive::operator()(const void* data, data_type dtype, std::int64_t count) {
+    ONEDAL_ASSERT(data);
+    ONEDAL_ASSERT(count > 0);
+
+    const std::int64_t type_size = get_data_type_size(dtype);
+    const std::int64_t byte_count = check_mul_overflow(type_size, count);
+
+    write(reinterpret_cast<const byte_t*>(data), byte_count);
+    size_ += byte_count;
+}
+
+void file_output_archive::write(const byte_t* data, std::int64_t byte_count) {
+    const std::int64_t capacity = buffer_.get_count();
+    if (buffer_count_ + byte_count <= capacity) {
+        std::memcpy(buffer_.get_mutable_data() + buffer_count_, data, byte_count);
+        buffer_count_ += byte_count;
+        return;
+    }
+
+    flush();
+    if (byte_count < capacity) {
+        std::memcpy(buffer_.get_mutable_data(), data, byte_count);
+        buffer_count_ = byte_count;
+        return;
+    }
+
+    const std::size_t size = integral_cast<std::size_t>(byte_count);
+    if (std::fwrite(data, 1, size, file_) != size) {
+        throw internal_error{ error_messages::file_write_failed() };
+    }
+}
+
+void file_output_archive::flush() {
+    if (buffer_count_ == 0) {
+        return;
+    }
+    const std::size_t size = integral_cast<std::size_t>(buffer_count_);
+    buffer_count_ = 0;
+    if (std::fwrite(buffer_.get_data(), 1, size, file_) != size) {
+        throw internal_error{ error_messages::file_write_failed() };
+    }
+}
+
+file_input_archive::file_input_archive(const std::string& file_name, std::int64_t buffer_size) {
+    ONEDAL_ASSERT(buffer_size > 0);
+    file_ = std::fopen(file_name.c_str(), "rb");
+    if (!file_) {
+        throw invalid_argument{ error_messages::file_not_found() };
+    }
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+    buffer_ = array<byte_t>::empty(buffer_size);
+}
+
+file_input_archive::~file_input_archive() {
+    std::fclose(file_);
+}
+
+void file_input_archive::prologue() {
+    is_valid_ = false;
+
+    std::uint32_t magic;
+    operator()(&magic, make_data_type<std::uint32_t>());
+    if (magic != binary_archive_magic) {
+        throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+    }
+}
+
+void file_input_archive::operator()(void* data, data_type dtype, std::int64_t count) {
+    ONEDAL_ASSERT(data);
+    ONEDAL_ASSERT(count > 0);
+
+    const std::int64_t type_size = get_data_type_size(dtype);
+    const std::int64_t byte_count = check_mul_overflow(type_size, count);
+
+    read(reinterpret_cast<byte_t*>(data), byte_count);
+}
+
+void file_input_archive::read(byte_t* data, std::int64_t byte_count) {
+    const std::int64_t buffered_count = std::min(byte_count, buffer_count_ - buffer_position_);
+    std::memcpy(data, buffer_.get_data() + buffer_position_, buffered_count);
+    buffer_position_ += buffered_count;
+    data += buffered_count;
+    byte_count -= buffered_count;
+    if (byte_count == 0) {
+        return;
+    }
+
+    if (byte_count >= buffer_.get_count()) {
+        if (read_from_file(data, byte_count) != byte_count) {
+            throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+        }
+        return;
+    }
+
+    buffer_count_ = read_from_file(buffer_.get_mutable_data(), buffer_.get_count());
+    buffer_position_ = 0;
+    if (buffer_count_ < byte_count) {
+        throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+    }
+    std::memcpy(data, buffer_.get_data(), byte_count);
+    buffer_position_ = byte_count;
+}
+
+std::int64_t file_input_archive::read_from_file(byte_t* data, std::int64_t byte_count) {
+    const std::size_t size = integral_cast<std::size_t>(byte_count);
+    const std::size_t read_count = std::fread(data, 1, size, file_);
+    if (read_count != size && std::ferror(file_)) {
+        throw internal_error{ error_messages::file_read_failed() };
+    }
+    return integral_cast<std::int64_t>(read_count);
+}
+
+mapped_file_input_archive::mapped_file_input_archive(const std::string& file_name) {
+    const auto file = std::make_shared<backend::mapped_file>(file_name);
+    data_ = shared<const byte_t>(file, reinterpret_cast<const byte_t*>(file->get_data()));
+    size_ = file->get_size();
+}
+
+void mapped_file_input_archive::prologue() {
+    is_valid_ = false;
+
+    std::uint32_t magic;
+    operator()(&magic, make_data_type<std::uint32_t>());
+    if (magic != binary_archive_magic) {
+        throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+    }
+}
+
+void mapped_file_input_archive::operator()(void* data, data_type dtype, std::int64_t count) {
+    ONEDAL_ASSERT(data);
+    ONEDAL_ASSERT(count > 0);
+
+    const std::int64_t type_size = get_data_type_size(dtype);
+    const std::int64_t byte_count = check_mul_overflow(type_size, count);
+
+    std::memcpy(data, consume(byte_count), byte_count);
+}
+
+shared<const byte_t> mapped_file_input_archive::view(std::int64_t size_in_bytes,
+                                                     std::int64_t alignment) {
+    ONEDAL_ASSERT(size_in_bytes > 0);
+    ONEDAL_ASSERT(alignment > 0);
+
+    const byte_t* data = data_.get() + position_;
+    if (reinterpret_cast<std::uintptr_t>(data) % alignment > 0) {
+        return shared<const byte_t>{};
+    }
+    return shared<const byte_t>(data_, consume(size_in_bytes));
+}
+
+const byte_t* mapped_file_input_archive::consume(std::int64_t size_in_bytes) {
+    if (size_in_bytes > size_ - position_) {
+        throw invalid_argument{ error_messages::archive_content_does_not_match_type() };
+    }
+    const byte_t* data = data_.get() + position_;
+    position_ += size_in_bytes;
+    return data;
+}
+
+} // namespace oneapi::dal::detail::v1
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstdio>
+#include <string>
+
 #include "oneapi/dal/detail/paged_vector.hpp"
 
 namespace oneapi::dal::detail {
@@ -125,9 +128,125 @@ private:
     bool is_valid_ = true;
 };
 
+/// The default size of the buffer of the file archives in bytes
+constexpr std::int64_t file_archive_buffer_size = 4 * 1024 * 1024;
+
+/// Writes the serialized content to the file in the format of
+/// :expr:`binary_output_archive`. The small values are collected in the buffer,
+/// while the payloads that do not fit into it are written to the file directly,
+/// so the whole content is never kept in memory.
+class ONEDAL_EXPORT file_output_archive : public base {
+public:
+    explicit file_output_archive(const std::string& file_name,
+                                 std::int64_t buffer_size = file_archive_buffer_size);
+    ~file_output_archive();
+
+    file_output_archive(const file_output_archive&) = delete;
+    file_output_archive& operator=(const file_output_archive&) = delete;
+
+    void prologue();
+
+    /// Writes the buffered content to the file, so it is complete once the
+    /// serialization returns
+    void epilogue();
+
+    void operator()(const void* data, data_type dtype, std::int64_t count = 1);
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+    /// The number of the serialized bytes
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+private:
+    void write(const byte_t* data, std::int64_t byte_count);
+    void flush();
+
+    std::FILE* file_ = nullptr;
+    array<byte_t> buffer_;
+    std::int64_t buffer_count_ = 0;
+    std::int64_t size_ = 0;
+    bool is_valid_ = true;
+};
+
+/// Reads the content written by :expr:`file_output_archive` or
+/// :expr:`binary_output_archive` from the file. The payloads that do not fit
+/// into the buffer are read directly to the destination.
+class ONEDAL_EXPORT file_input_archive : public base {
+public:
+    explicit file_input_archive(const std::string& file_name,
+                                std::int64_t buffer_size = file_archive_buffer_size);
+    ~file_input_archive();
+
+    file_input_archive(const file_input_archive&) = delete;
+    file_input_archive& operator=(const file_input_archive&) = delete;
+
+    void prologue();
+
+    void epilogue() {
+        is_valid_ = true;
+    }
+
+    void operator()(void* data, data_type dtype, std::int64_t count = 1);
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+private:
+    void read(byte_t* data, std::int64_t byte_count);
+    std::int64_t read_from_file(byte_t* data, std::int64_t byte_count);
+
+    std::FILE* file_ = nullptr;
+    array<byte_t> buffer_;
+    std::int64_t buffer_position_ = 0;
+    std::int64_t buffer_count_ = 0;
+    bool is_valid_ = true;
+};
+
+/// Reads the content written by :expr:`file_output_archive` or
+/// :expr:`binary_output_archive` from the memory-mapped file. The archive
+/// supports views, so the arrays deserialized from it alias the mapped
+/// region instead of being copied. The mapping is released when the last
+/// array that references it is destroyed, and the read-only pages are shared
+/// between the processes that load the same file.
+class ONEDAL_EXPORT mapped_file_input_archive : public base {
+public:
+    explicit mapped_file_input_archive(const std::string& file_name);
+
+    void prologue();
+
+    void epilogue() {
+        is_valid_ = true;
+    }
+
+    void operator()(void* data, data_type dtype, std::int64_t count = 1);
+
+    shared<const byte_t> view(std::int64_t size_in_bytes, std::int64_t alignment);
+
+    bool is_valid() const {
+        return is_valid_;
+    }
+
+private:
+    const byte_t* consume(std::int64_t size_in_bytes);
+
+    shared<const byte_t> data_;
+    std::int64_t size_ = 0;
+    std::int64_t position_ = 0;
+    bool is_valid_ = true;
+};
+
 } // namespace v1
 
 using v1::binary_output_archive;
 using v1::binary_input_archive;
+using v1::file_archive_buffer_size;
+using v1::file_output_archive;
+using v1::file_input_archive;
+using v1::mapped_file_input_archive;
 
 } // namespace oneapi::dal::detail
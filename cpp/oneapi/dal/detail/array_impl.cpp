@@ -21,7 +21,12 @@
 
 namespace oneapi::dal::detail::v2 {
 
-using deserialize_result_t = std::tuple<shared<byte_t>, std::int64_t>;
+using deserialize_result_t =
+    std::tuple<std::variant<shared<byte_t>, shared<const byte_t>>, std::int64_t>;
+
+/// The byte arrays hold the data of tables of any type, so the views of the
+/// archive content are taken only if they are aligned as the widest data type
+constexpr std::int64_t min_view_alignment = sizeof(double);
 
 inline void serialize_array_on_host(output_archive& archive,
                                     const byte_t* data,
@@ -54,6 +59,12 @@ inline deserialize_result_t deserialize_array_on_host(input_archive& archive,
     }
 
     if (size_in_bytes > 0) {
+        const std::int64_t alignment =
+            std::max(get_data_type_size(expected_dtype), min_view_alignment);
+        if (auto data_view = archive.view(size_in_bytes, alignment)) {
+            return { std::move(data_view), size_in_bytes };
+        }
+
         auto deleter = make_default_delete<byte_t>(detail::default_host_policy{});
         byte_t* data_placeholder = malloc<byte_t>(detail::default_host_policy{}, size_in_bytes);
         auto shared_data_placeholder = shared<byte_t>{ data_placeholder, std::move(deleter) };
@@ -108,19 +119,24 @@ inline deserialize_result_t deserialize_array_impl(const data_parallel_policy& p
 
     const auto [shared_data_host, size_in_bytes] =
         deserialize_array_on_host(archive, expected_dtype);
+    const byte_t* data_host = std::visit(
+        [](const auto& data) -> const byte_t* {
+            return data.get();
+        },
+        shared_data_host);
 
     if (size_in_bytes > 0) {
         auto deleter = make_default_delete<byte_t>(policy);
         byte_t* data_device = backend::malloc_device<byte_t>(q, size_in_bytes);
         auto shared_data_device = shared<byte_t>{ data_device, std::move(deleter) };
 
-        backend::copy_host2usm(q, data_device, shared_data_host.get(), size_in_bytes);
+        backend::copy_host2usm(q, data_device, data_host, size_in_bytes);
 
         return { shared_data_device, size_in_bytes };
     }
     else {
-        ONEDAL_ASSERT(shared_data_host.get() == nullptr);
-        return { shared_data_host, size_in_bytes };
+        ONEDAL_ASSERT(data_host == nullptr);
+        return { shared<byte_t>{}, size_in_bytes };
     }
 }
 #endif
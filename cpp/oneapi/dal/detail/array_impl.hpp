@@ -53,10 +53,13 @@ void serialize_array(const Policy& policy,
 ///                           stored in the archive, the function throws an exception.
 ///
 /// @return The tuple of shared pointer to the deserialized buffer and its size in bytes.
+///         If the archive supports views and the data is placed on host, the buffer
+///         is a read-only view of the archive content instead of a mutable copy.
 template <typename Policy>
-std::tuple<shared<byte_t>, std::int64_t> deserialize_array(const Policy& policy,
-                                                           input_archive& archive,
-                                                           data_type expected_dtype);
+std::tuple<std::variant<shared<byte_t>, shared<const byte_t>>, std::int64_t> deserialize_array(
+    const Policy& policy,
+    input_archive& archive,
+    data_type expected_dtype);
 
 template <typename T>
 class array_impl : public base {
@@ -241,7 +244,7 @@ public:
         using data_t = detail::trivial_serialization_type_t<T>;
         const data_type expected_dtype = make_data_type<data_t>();
 
-        detail::shared<byte_t> data_shared;
+        std::variant<detail::shared<byte_t>, detail::shared<const byte_t>> data_shared;
         std::int64_t size_in_bytes;
 
         __ONEDAL_IF_QUEUE__(get_queue(), {
@@ -258,7 +261,13 @@ public:
         // TODO: Use exception
         ONEDAL_ASSERT(size_in_bytes % sizeof(data_t) == 0);
 
-        data_owned_ = shared{ data_shared, reinterpret_cast<T*>(data_shared.get()) };
+        if (const auto* data_view = std::get_if<detail::shared<const byte_t>>(&data_shared)) {
+            data_owned_ = cshared{ *data_view, reinterpret_cast<const T*>(data_view->get()) };
+        }
+        else {
+            const auto& data = std::get<detail::shared<byte_t>>(data_shared);
+            data_owned_ = shared{ data, reinterpret_cast<T*>(data.get()) };
+        }
         count_ = size_in_bytes / sizeof(data_t);
     }
 
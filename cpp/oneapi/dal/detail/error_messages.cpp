@@ -61,6 +61,8 @@ MSG(empty_set_of_result_options, "Empty set of result options")
 MSG(this_result_is_not_enabled_via_result_options, "This result is not enabled via result options")
 MSG(spmd_error_holder_message, "SPMD failure occurred, use e.rethrow_actual() to get actual error")
 MSG(spmd_coworker_failure, "SPMD execution was interrupted because of coworker's failure")
+MSG(max_thread_count_lt_zero, "Maximal thread count is lower than zero")
+MSG(cpu_id_lt_zero, "CPU identifier is lower than zero")
 
 /* Primitives */
 MSG(invalid_number_of_elements_to_process, "Invalid number of elements to process")
@@ -124,7 +126,13 @@ MSG(unimplemented_sorting_procedure, "Unimplemented sorting procedure")
 MSG(edge_values_are_empty, "Edge values are empty")
 
 /* IO */
+MSG(file_mapping_failed, "Failed to map file into memory")
 MSG(file_not_found, "File not found")
+MSG(file_read_failed, "Failed to read file")
+MSG(file_write_failed, "Failed to write file")
+MSG(graph_snapshot_does_not_match_graph_type,
+    "Graph snapshot does not match the requested graph type")
+MSG(invalid_graph_snapshot, "File is not a valid graph snapshot")
 MSG(unsupported_read_mode, "Unsupported read mode")
 
 /* Serialization */
@@ -137,6 +145,10 @@ MSG(archive_is_in_invalid_state,
 /* General algorithms */
 MSG(accuracy_threshold_lt_zero, "Accuracy_threshold is lower than zero")
 MSG(class_count_leq_one, "Class count is lower than or equal to one")
+MSG(incompatible_partial_results,
+    "Partial results are computed on data with different column count")
+MSG(input_data_cc_neq_partial_result_cc,
+    "Input data column count is not equal to column count of the partial result")
 MSG(input_data_is_empty, "Input data is empty")
 MSG(input_data_rc_neq_input_responses_rc,
     "Input data row count is not equal to input responses row count")
@@ -154,6 +166,7 @@ MSG(max_iteration_count_leq_zero, "Max iteration count lower than or equal to ze
 MSG(max_iteration_count_lt_zero, "Max iteration count lower than zero")
 
 /* K-Means */
+MSG(batch_size_leq_zero, "Batch size is lower than or equal to zero")
 MSG(cluster_count_leq_zero, "Cluster count is lower than or equal to zero")
 MSG(cluster_count_exceeds_data_row_count, "Cluster count exceeds data row count")
 MSG(cluster_count_gt_max_int32, "Cluster count is greater than max int32 value")
@@ -168,11 +181,17 @@ MSG(input_model_centroids_cc_neq_input_data_cc,
     "Input model centroids column count is not equal to input data column count")
 MSG(input_model_centroids_rc_neq_desc_cluster_count,
     "Input model centroids row count is not equal to descriptor cluster count")
+MSG(kmeans_hamerly_dense_method_is_not_implemented_for_gpu,
+    "K-Means Hamerly dense method is not implemented for GPU")
 MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ parallel dense method is not implemented for GPU")
 MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu,
     "K-Means init++ dense method is not implemented for GPU")
+MSG(kmeans_minibatch_dense_method_is_not_implemented_for_gpu,
+    "K-Means mini-batch dense method is not implemented for GPU")
 MSG(objective_function_value_lt_zero, "Objective function value is lower than zero")
+MSG(partial_result_cluster_sizes_rc_neq_desc_cluster_count,
+    "Cluster sizes row count of the partial result is not equal to descriptor cluster count")
 
 /* k-NN */
 MSG(knn_kd_tree_method_is_not_implemented_for_gpu,
@@ -193,6 +212,11 @@ MSG(invalid_set_of_result_options_to_search,
 /* Minkowski distance */
 MSG(invalid_minkowski_degree, "Minkowski degree should be greater than zero")
 
+/* Connected Components */
+MSG(neighbor_round_count_lt_zero, "Neighbor round count is lower than zero")
+MSG(sample_count_leq_zero, "Sample count is lower than or equal to zero")
+MSG(sample_count_gt_max_int32, "Sample count is greater than max int32 value")
+
 /* Jaccard */
 MSG(column_begin_gt_column_end, "Column begin is greater than column end")
 MSG(empty_edge_list, "Empty edge list")
@@ -200,6 +224,7 @@ MSG(interval_gt_vertex_count, "Interval is greater than vertex count")
 MSG(negative_interval, "Negative interval")
 MSG(row_begin_gt_row_end, "Row begin is greater than row end")
 MSG(range_idx_gt_max_int32, "Range indexes are greater than max of int32")
+MSG(top_k_lt_zero, "Top-k parameter is lower than zero")
 
 /* Subgraph Isomorphism */
 MSG(max_match_count_lt_zero, "Maximum number of match count less that zero")
@@ -227,6 +252,8 @@ MSG(pca_svd_based_method_is_not_implemented_for_gpu,
 /* Shortest Paths */
 MSG(negative_source, "Source vertex is lower than zero")
 MSG(source_gte_vertex_count, "Source vertex is out of range")
+MSG(empty_source_list, "List of source vertices is empty")
+MSG(target_out_of_range, "Target vertex is out of range")
 MSG(negative_delta, "Delta parameter is lower than zero")
 MSG(nothing_to_compute, "Invalid combination of optional results: nothing to compute")
 MSG(distances_are_uninitialized, "Distances are not set as an optional result")
@@ -295,6 +322,9 @@ MSG(invalid_value_for_observations_per_tree_fraction,
 MSG(input_model_tree_has_invalid_size, "Input model tree size is invalid")
 
 /* DBSCAN */
+MSG(dbscan_kd_tree_method_is_not_implemented_for_gpu,
+    "DBSCAN k-d tree method is not implemented for GPU")
+MSG(memory_limit_lt_zero, "Memory limit is lower than zero")
 MSG(weight_dimension_doesnt_match_data_dimension,
     "Weights dimensions doesn't match data dimensions")
 MSG(weights_column_count_ne_1, "Weights is not a single-column table")
@@ -90,6 +90,8 @@ public:
     MSG(this_result_is_not_enabled_via_result_options);
     MSG(spmd_error_holder_message);
     MSG(spmd_coworker_failure);
+    MSG(max_thread_count_lt_zero);
+    MSG(cpu_id_lt_zero);
 
     /* Primitives */
     MSG(invalid_number_of_elements_to_process);
@@ -142,7 +144,12 @@ public:
     MSG(edge_values_are_empty);
 
     /* I/O */
+    MSG(file_mapping_failed);
     MSG(file_not_found);
+    MSG(file_read_failed);
+    MSG(file_write_failed);
+    MSG(graph_snapshot_does_not_match_graph_type);
+    MSG(invalid_graph_snapshot);
     MSG(unsupported_read_mode);
 
     /* Serialization */
@@ -153,6 +160,8 @@ public:
     /* General Algorithms */
     MSG(accuracy_threshold_lt_zero);
     MSG(class_count_leq_one);
+    MSG(incompatible_partial_results);
+    MSG(input_data_cc_neq_partial_result_cc);
     MSG(input_data_is_empty);
     MSG(input_data_rc_neq_input_responses_rc);
     MSG(input_data_rc_neq_input_weights_rc);
@@ -180,6 +189,11 @@ public:
     MSG(not_enough_memory_to_build_one_tree);
     MSG(input_model_tree_has_invalid_size);
 
+    /* Connected Components */
+    MSG(neighbor_round_count_lt_zero);
+    MSG(sample_count_leq_zero);
+    MSG(sample_count_gt_max_int32);
+
     /* Jaccard */
     MSG(column_begin_gt_column_end);
     MSG(empty_edge_list);
@@ -187,6 +201,7 @@ public:
     MSG(negative_interval);
     MSG(row_begin_gt_row_end);
     MSG(range_idx_gt_max_int32);
+    MSG(top_k_lt_zero);
 
     /* Subgraph Isomorphism */
     MSG(unsupported_kind);
@@ -199,6 +214,7 @@ public:
     MSG(target_graph_is_smaller_than_pattern_graph);
 
     /* K-Means and K-Means Init */
+    MSG(batch_size_leq_zero);
     MSG(cluster_count_leq_zero);
     MSG(cluster_count_exceeds_data_row_count);
     MSG(cluster_count_gt_max_int32);
@@ -209,9 +225,12 @@ public:
     MSG(input_model_centroids_are_empty);
     MSG(input_model_centroids_cc_neq_input_data_cc);
     MSG(input_model_centroids_rc_neq_desc_cluster_count);
+    MSG(kmeans_hamerly_dense_method_is_not_implemented_for_gpu);
     MSG(kmeans_init_parallel_plus_dense_method_is_not_implemented_for_gpu);
     MSG(kmeans_init_plus_plus_dense_method_is_not_implemented_for_gpu);
+    MSG(kmeans_minibatch_dense_method_is_not_implemented_for_gpu);
     MSG(objective_function_value_lt_zero);
+    MSG(partial_result_cluster_sizes_rc_neq_desc_cluster_count);
 
     /* k-NN */
     MSG(knn_kd_tree_method_is_not_implemented_for_gpu);
@@ -249,6 +268,8 @@ public:
     /* Shortest Paths */
     MSG(negative_source);
     MSG(source_gte_vertex_count);
+    MSG(empty_source_list);
+    MSG(target_out_of_range);
     MSG(negative_delta);
     MSG(nothing_to_compute);
     MSG(distances_are_uninitialized);
@@ -281,6 +302,8 @@ public:
     MSG(unknown_kernel_function_type);
 
     /* DBSCAN */
+    MSG(dbscan_kd_tree_method_is_not_implemented_for_gpu);
+    MSG(memory_limit_lt_zero);
     MSG(weight_dimension_doesnt_match_data_dimension);
     MSG(weights_column_count_ne_1);
 
@@ -17,6 +17,7 @@
 #include "oneapi/dal/detail/memory_impl_host.hpp"
 
 #include <daal/include/services/daal_memory.h>
+#include "src/threading/threading.h"
 
 namespace oneapi::dal::detail::v1 {
 
@@ -41,6 +42,14 @@ void free(const default_host_policy&, void* pointer) {
     daal::services::daal_free(pointer);
 }
 
+void enable_first_touch_allocation(bool enable) {
+    daal::threader_env()->enableFirstTouch(enable);
+}
+
+bool is_first_touch_allocation_enabled() {
+    return daal::threader_is_first_touch_enabled();
+}
+
 void memset(const default_host_policy&, void* dest, std::int32_t value, std::int64_t size) {
     ONEDAL_ASSERT(dest != nullptr);
     std::memset(dest, value, detail::integral_cast<std::size_t>(size));
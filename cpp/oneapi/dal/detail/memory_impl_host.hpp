@@ -36,6 +36,14 @@ ONEDAL_EXPORT void memcpy(const default_host_policy&,
                           const void* src,
                           std::int64_t size);
 
+/// Enables NUMA-aware first-touch mode of the host allocations. In this mode
+/// large blocks are zero-filled in parallel with the static partitioning of
+/// the pages between the threads, so the pages are placed on the NUMA nodes of
+/// the threads that process them. Affects the arrays and tables allocated on
+/// host and the internal scratch buffers.
+ONEDAL_EXPORT void enable_first_touch_allocation(bool enable = true);
+ONEDAL_EXPORT bool is_first_touch_allocation_enabled();
+
 template <typename T>
 inline T* malloc(const default_host_policy& policy, std::int64_t count) {
     ONEDAL_ASSERT_MUL_OVERFLOW(std::size_t, sizeof(T), count);
@@ -85,6 +93,8 @@ using v1::free;
 using v1::fill;
 using v1::memset;
 using v1::memcpy;
+using v1::enable_first_touch_allocation;
+using v1::is_first_touch_allocation_enabled;
 using v1::host_allocator;
 
 } // namespace oneapi::dal::detail
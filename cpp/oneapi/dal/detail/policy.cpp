@@ -16,6 +16,7 @@
 
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/exceptions.hpp"
 
 namespace oneapi::dal::detail {
 namespace v1 {
@@ -23,6 +24,9 @@ namespace v1 {
 class host_policy_impl : public base {
 public:
     cpu_extension cpu_extensions_mask = backend::detect_top_cpu_extension();
+    std::int64_t max_threads = 0;
+    bool isolated = false;
+    std::vector<std::int32_t> cpu_affinity;
 };
 
 host_policy::host_policy() : impl_(new host_policy_impl()) {}
@@ -35,6 +39,42 @@ cpu_extension host_policy::get_enabled_cpu_extensions() const noexcept {
     return impl_->cpu_extensions_mask;
 }
 
+std::int64_t host_policy::get_max_threads() const noexcept {
+    return impl_->max_threads;
+}
+
+bool host_policy::get_isolated() const noexcept {
+    return impl_->isolated;
+}
+
+const std::vector<std::int32_t>& host_policy::get_cpu_affinity() const noexcept {
+    return impl_->cpu_affinity;
+}
+
+bool host_policy::has_threading_constraints() const noexcept {
+    return impl_->max_threads > 0 || impl_->isolated || !impl_->cpu_affinity.empty();
+}
+
+void host_policy::set_max_threads_impl(std::int64_t value) {
+    if (value < 0) {
+        throw invalid_argument{ error_messages::max_thread_count_lt_zero() };
+    }
+    impl_->max_threads = value;
+}
+
+void host_policy::set_isolated_impl(bool value) noexcept {
+    impl_->isolated = value;
+}
+
+void host_policy::set_cpu_affinity_impl(const std::vector<std::int32_t>& cpu_ids) {
+    for (const std::int32_t id : cpu_ids) {
+        if (id < 0) {
+            throw invalid_argument{ error_messages::cpu_id_lt_zero() };
+        }
+    }
+    impl_->cpu_affinity = cpu_ids;
+}
+
 #ifdef ONEDAL_DATA_PARALLEL
 void data_parallel_policy::init_impl(const sycl::queue& queue) {
     this->impl_ = nullptr; // reserved for future use
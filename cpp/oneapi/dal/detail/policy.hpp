@@ -17,6 +17,7 @@
 #pragma once
 
 #include <type_traits>
+#include <vector>
 #ifdef ONEDAL_DATA_PARALLEL
 #include <CL/sycl.hpp>
 #endif
@@ -87,8 +88,41 @@ public:
         return *this;
     }
 
+    /// The maximal number of threads used by the computations.
+    /// Zero means that the global threading settings are used.
+    std::int64_t get_max_threads() const noexcept;
+
+    auto& set_max_threads(std::int64_t value) {
+        set_max_threads_impl(value);
+        return *this;
+    }
+
+    /// If `true`, the computations run in the dedicated task arena and
+    /// do not share the worker threads with the concurrent calls.
+    bool get_isolated() const noexcept;
+
+    auto& set_isolated(bool value) {
+        set_isolated_impl(value);
+        return *this;
+    }
+
+    /// The identifiers of the CPUs the threads are pinned to.
+    /// Empty list means that the threads are not pinned.
+    const std::vector<std::int32_t>& get_cpu_affinity() const noexcept;
+
+    auto& set_cpu_affinity(const std::vector<std::int32_t>& cpu_ids) {
+        set_cpu_affinity_impl(cpu_ids);
+        return *this;
+    }
+
+    /// Returns `true` if the computations need the dedicated task arena
+    bool has_threading_constraints() const noexcept;
+
 private:
     void set_enabled_cpu_extensions_impl(const cpu_extension& extensions) noexcept;
+    void set_max_threads_impl(std::int64_t value);
+    void set_isolated_impl(bool value) noexcept;
+    void set_cpu_affinity_impl(const std::vector<std::int32_t>& cpu_ids);
 
     pimpl<host_policy_impl> impl_;
 };
@@ -15,18 +15,82 @@
 *******************************************************************************/
 
 #include "oneapi/dal/detail/profiler.hpp"
+#include "src/externals/service_profiler.h"
 
 namespace oneapi::dal::detail {
+namespace {
+
+using daal_profiler = daal::internal::Profiler;
+
+constexpr const char* task_category = "onedal";
+
+static_assert(int(profiler_mode::disabled) == int(daal::internal::profilerDisabled));
+static_assert(int(profiler_mode::report) == int(daal::internal::profilerReport));
+static_assert(int(profiler_mode::trace) == int(daal::internal::profilerTrace));
+
+} // namespace
+
 profiler_task profiler::start_task(const char* task_name) {
+    daal_profiler::enterTask(task_name, task_category);
     return profiler_task(task_name);
 }
 
-void profiler::end_task(const char* task_name) {}
+void profiler::end_task(const char* task_name) {
+    daal_profiler::leaveTask(task_name);
+}
+
+bool profiler::is_enabled() {
+    return daal_profiler::isEnabled();
+}
+
+void profiler::set_mode(profiler_mode mode) {
+    daal_profiler::setMode(static_cast<daal::internal::ProfilerMode>(mode));
+}
+
+profiler_mode profiler::get_mode() {
+    return static_cast<profiler_mode>(daal_profiler::getMode());
+}
+
+void profiler::reset() {
+    daal_profiler::reset();
+}
+
+namespace {
+
+template <typename Getter>
+std::string get_text(Getter&& getter) {
+    std::string text;
+    // The text may grow between the calls, so the size is requested again
+    for (std::size_t size = getter(nullptr, 0); size >= text.size() + 1;) {
+        text.resize(size + 1);
+        size = getter(&text[0], text.size());
+        if (size < text.size()) {
+            text.resize(size);
+            break;
+        }
+    }
+    return text;
+}
+
+} // namespace
+
+std::string profiler::get_report() {
+    return get_text(daal_profiler::getReport);
+}
+
+std::string profiler::get_trace() {
+    return get_text(daal_profiler::getTrace);
+}
 
 profiler_task::profiler_task(const char* task_name) : task_name_(task_name) {}
 
 #ifdef ONEDAL_DATA_PARALLEL
 profiler_task profiler::start_task(const char* task_name, const sycl::queue& task_queue) {
+    if (is_enabled()) {
+        // Do not attribute the previously submitted kernels to this task
+        sycl::queue{ task_queue }.wait();
+    }
+    daal_profiler::enterTask(task_name, task_category);
     return profiler_task(task_name, task_queue);
 }
 
@@ -36,6 +100,11 @@ profiler_task::profiler_task(const char* task_name, const sycl::queue& task_queu
 #endif
 
 profiler_task::~profiler_task() {
+#ifdef ONEDAL_DATA_PARALLEL
+    if (profiler::is_enabled()) {
+        task_queue_.wait();
+    }
+#endif
     profiler::end_task(task_name_);
 }
 
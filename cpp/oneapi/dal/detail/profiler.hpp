@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #ifdef ONEDAL_DATA_PARALLEL
 #include <CL/sycl.hpp>
 #endif
@@ -31,7 +33,7 @@
 
 #define ONEDAL_PROFILER_TASK(...)                                                           \
     oneapi::dal::detail::profiler_task ONEDAL_PROFILER_CONCAT(__profiler_task__,            \
-                                                              ONEDAL_ITTNOTIFY_UNIQUE_ID) = \
+                                                              ONEDAL_PROFILER_UNIQUE_ID) =  \
         ONEDAL_PROFILER_GET_MACRO(__VA_ARGS__,                                              \
                                   ONEDAL_PROFILER_MACRO_2,                                  \
                                   ONEDAL_PROFILER_MACRO_1,                                  \
@@ -39,6 +41,18 @@
 
 namespace oneapi::dal::detail {
 
+/// Output produced by the profiler at process exit
+enum class profiler_mode {
+    /// Tasks are not recorded
+    disabled,
+
+    /// Hierarchical report with per-task wall time and call counts
+    report,
+
+    /// Chrome trace JSON that can be opened in chrome://tracing or Perfetto
+    trace
+};
+
 class profiler_task {
 public:
     profiler_task(const char* task_name);
@@ -61,6 +75,29 @@ public:
     static profiler_task start_task(const char* task_name, const sycl::queue& task_queue);
 #endif
     static void end_task(const char* task_name);
+
+    /// Returns `true` if tasks are currently recorded. The tasks are written
+    /// to the same per-thread stream as `DAAL_ITTNOTIFY_SCOPED_TASK`, so DAAL
+    /// kernel phases appear as children of the oneDAL tasks that call them.
+    /// The initial state is taken from the `ONEDAL_PROFILER` environment
+    /// variable which accepts `report` or `trace`. The output is written at
+    /// process exit to the file given in `ONEDAL_PROFILER_OUTPUT`, or to
+    /// stderr for the report and `onedal_trace.json` for the trace.
+    static bool is_enabled();
+
+    /// Changes the output produced at process exit, `profiler_mode::disabled`
+    /// stops recording of new tasks
+    static void set_mode(profiler_mode mode);
+    static profiler_mode get_mode();
+
+    /// Drops all recorded timings, tasks that are still running are kept
+    static void reset();
+
+    /// Hierarchical report for the tasks recorded so far
+    static std::string get_report();
+
+    /// Chrome trace JSON for the tasks recorded so far
+    static std::string get_trace();
 };
 
 } // namespace oneapi::dal::detail
@@ -55,6 +55,15 @@ public:
     virtual void deserialize(void* data, data_type dtype, std::int64_t count) = 0;
 };
 
+/// Optional archive interface for the views of the archive content. It is
+/// separate from :expr:`input_archive_iface`, so the layout of that interface
+/// is kept for the archives instantiated by the code built with older headers
+class input_archive_view_iface {
+public:
+    virtual ~input_archive_view_iface() = default;
+    virtual shared<const byte_t> view(std::int64_t size_in_bytes, std::int64_t alignment) = 0;
+};
+
 /// Archive interface for serialization
 class output_archive_iface {
 public:
@@ -97,8 +106,19 @@ struct trivial_serialization_type<T, true> {
 template <typename T>
 using trivial_serialization_type_t = typename trivial_serialization_type<T>::type;
 
+template <typename Archive, typename = void>
+struct has_view : std::false_type {};
+
 template <typename Archive>
-class input_archive_impl : public base, public input_archive_iface {
+struct has_view<Archive,
+                std::void_t<decltype(std::declval<Archive&>().view(std::int64_t(0),
+                                                                   std::int64_t(0)))>>
+        : std::true_type {};
+
+template <typename Archive>
+class input_archive_impl : public base,
+                           public input_archive_iface,
+                           public input_archive_view_iface {
 public:
     explicit input_archive_impl(Archive& archive) : archive_(archive) {}
 
@@ -118,6 +138,15 @@ public:
         archive_(data, dtype, count);
     }
 
+    shared<const byte_t> view(std::int64_t size_in_bytes, std::int64_t alignment) override {
+        if constexpr (has_view<std::remove_reference_t<Archive>>::value) {
+            return archive_.view(size_in_bytes, alignment);
+        }
+        else {
+            return shared<const byte_t>{};
+        }
+    }
+
 private:
     std::remove_reference_t<Archive>& archive_;
 };
@@ -203,6 +232,21 @@ public:
         return value;
     }
 
+    /// Returns the read-only view of the next `size_in_bytes` bytes of the
+    /// archive content and skips them. The view shares the ownership of the
+    /// content, so it stays valid after the archive is destroyed. Returns an
+    /// empty pointer and consumes nothing if the archive does not support
+    /// views or the content is not aligned to `alignment`.
+    shared<const byte_t> view(std::int64_t size_in_bytes, std::int64_t alignment) {
+        ONEDAL_ASSERT(size_in_bytes > 0);
+        ONEDAL_ASSERT(alignment > 0);
+        auto view_impl = dynamic_cast<input_archive_view_iface*>(&get_impl());
+        if (!view_impl) {
+            return shared<const byte_t>{};
+        }
+        return view_impl->view(size_in_bytes, alignment);
+    }
+
 private:
     template <typename T, enable_if_trivially_serializable_t<T>* = nullptr>
     void process(T& value) {
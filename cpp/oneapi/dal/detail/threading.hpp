@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
+#include <vector>
+
 #include "oneapi/dal/detail/common.hpp"
 #include "oneapi/dal/detail/error_messages.hpp"
 #include "oneapi/dal/exceptions.hpp"
@@ -31,6 +34,7 @@ typedef void (*functype_int64)(std::int64_t i, const void *a);
 typedef void (*functype_int32ptr)(const std::int32_t *i, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
+typedef void (*functype_arena)(const void *a);
 
 typedef std::int64_t (*loop_functype_int32_int64)(std::int32_t start_idx,
                                                   std::int32_t end_idx,
@@ -112,6 +116,12 @@ ONEDAL_EXPORT void *_onedal_new_mutex();
 ONEDAL_EXPORT void _onedal_lock_mutex(void *mutex_ptr);
 ONEDAL_EXPORT void _onedal_unlock_mutex(void *mutex_ptr);
 ONEDAL_EXPORT void _onedal_del_mutex(void *mutex_ptr);
+
+ONEDAL_EXPORT void _onedal_execute_in_arena(std::int32_t max_concurrency,
+                                            const std::int32_t *cpu_ids,
+                                            std::int32_t cpu_count,
+                                            const void *a,
+                                            oneapi::dal::preview::functype_arena func);
 }
 
 namespace oneapi::dal::detail {
@@ -141,6 +151,12 @@ inline void threader_func_int32ptr(const std::int32_t *i, const void *a) {
     lambda(i);
 }
 
+template <typename F>
+inline void threader_func_arena(const void *a) {
+    const F &lambda = *static_cast<const F *>(a);
+    lambda();
+}
+
 template <typename F>
 inline ONEDAL_EXPORT void threader_for(std::int32_t n,
                                        std::int32_t threads_request,
@@ -166,6 +182,20 @@ inline ONEDAL_EXPORT void threader_for_simple(std::int32_t n,
     _onedal_threader_for_simple(n, threads_request, a, threader_func<F>);
 }
 
+/// Executes the function in the dedicated task arena, so its parallel loops
+/// do not share the threads with the concurrent calls. The arena has at most
+/// `max_concurrency` threads or, if it is not positive, one thread per CPU
+/// from the list. If the list is not empty, the threads are pinned to its CPUs.
+template <typename F>
+inline ONEDAL_EXPORT void threader_execute_in_arena(std::int32_t max_concurrency,
+                                                    const std::int32_t *cpu_ids,
+                                                    std::int32_t cpu_count,
+                                                    const F &lambda) {
+    const void *a = static_cast<const void *>(&lambda);
+
+    _onedal_execute_in_arena(max_concurrency, cpu_ids, cpu_count, a, threader_func_arena<F>);
+}
+
 template <typename F>
 inline ONEDAL_EXPORT void threader_for_int32ptr(const std::int32_t *begin,
                                                 const std::int32_t *end,
@@ -252,6 +282,126 @@ inline Value parallel_reduce_int32ptr_int64_t_simple(const std::int32_t *begin,
         parallel_reduce_reduction_int64<Reduction>);
 }
 
+/// Returns the number of blocks to split `count` elements into, so that
+/// every block contains at least `min_block_size` elements and the number
+/// of blocks is large enough to balance the load between threads
+inline std::int64_t get_block_count(std::int64_t count, std::int64_t min_block_size) {
+    const std::int64_t max_block_count = 4 * std::int64_t(threader_get_max_threads());
+    const std::int64_t block_count = (count + min_block_size - 1) / min_block_size;
+    return std::max<std::int64_t>(1, std::min(block_count, max_block_count));
+}
+
+/// Splits the range [0, count) into `block_count` contiguous blocks and calls
+/// `lambda(block, begin, end)` for each non-empty block in parallel
+template <typename F>
+inline void threader_for_blocks(std::int64_t count, std::int64_t block_count, const F &lambda) {
+    const std::int64_t block_size = (count + block_count - 1) / block_count;
+    threader_for(block_count, block_count, [&](std::int32_t block) {
+        const std::int64_t begin = block * block_size;
+        const std::int64_t end = std::min(begin + block_size, count);
+        if (begin < end) {
+            lambda(block, begin, end);
+        }
+    });
+}
+
+/// Computes the exclusive prefix sum in two passes over the blocks of the input:
+/// `result[0] = 0`, `result[i + 1] = values[0] + ... + values[i]`.
+/// The `result` must contain `count + 1` elements.
+///
+/// @tparam Result The type of the sums
+///
+/// @return The sum of all values
+template <typename Result, typename Value, typename Output>
+inline Result parallel_exclusive_scan(const Value *values, std::int64_t count, Output *result) {
+    constexpr std::int64_t min_block_size = 1 << 14;
+    const std::int64_t block_count = get_block_count(count, min_block_size);
+
+    if (block_count == 1) {
+        Result total = 0;
+        for (std::int64_t i = 0; i < count; ++i) {
+            result[i] = total;
+            total += values[i];
+        }
+        result[count] = total;
+        return total;
+    }
+
+    std::vector<Result> block_sums(block_count + 1, Result(0));
+    threader_for_blocks(count,
+                        block_count,
+                        [&](std::int64_t block, std::int64_t begin, std::int64_t end) {
+                            Result sum = 0;
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                sum += values[i];
+                            }
+                            block_sums[block + 1] = sum;
+                        });
+
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_sums[block + 1] += block_sums[block];
+    }
+
+    threader_for_blocks(count,
+                        block_count,
+                        [&](std::int64_t block, std::int64_t begin, std::int64_t end) {
+                            Result sum = block_sums[block];
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                result[i] = sum;
+                                sum += values[i];
+                            }
+                        });
+
+    result[count] = block_sums[block_count];
+    return block_sums[block_count];
+}
+
+/// Returns the maximum of `init` and `lambda(i)` over all `i` in [0, count)
+template <typename Value, typename F>
+inline Value parallel_max(std::int64_t count, Value init, const F &lambda) {
+    constexpr std::int64_t min_block_size = 1 << 14;
+    const std::int64_t block_count = get_block_count(count, min_block_size);
+
+    std::vector<Value> block_max(block_count, init);
+    threader_for_blocks(count,
+                        block_count,
+                        [&](std::int64_t block, std::int64_t begin, std::int64_t end) {
+                            Value max_value = init;
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                max_value = std::max<Value>(max_value, lambda(i));
+                            }
+                            block_max[block] = max_value;
+                        });
+
+    return *std::max_element(block_max.begin(), block_max.end());
+}
+
+/// Returns the sum of `lambda(i)` over all `i` in [0, count). The partial sums
+/// of the blocks are added in the block order, so the result does not depend
+/// on the scheduling of the blocks.
+template <typename Value, typename F>
+inline Value parallel_sum(std::int64_t count, const F &lambda) {
+    constexpr std::int64_t min_block_size = 1 << 14;
+    const std::int64_t block_count = get_block_count(count, min_block_size);
+
+    std::vector<Value> block_sums(block_count, Value(0));
+    threader_for_blocks(count,
+                        block_count,
+                        [&](std::int64_t block, std::int64_t begin, std::int64_t end) {
+                            Value sum = 0;
+                            for (std::int64_t i = begin; i < end; ++i) {
+                                sum += lambda(i);
+                            }
+                            block_sums[block] = sum;
+                        });
+
+    Value sum = 0;
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        sum += block_sums[block];
+    }
+    return sum;
+}
+
 template <typename F>
 ONEDAL_EXPORT void parallel_sort(F *begin_ptr, F *end_ptr) {
     throw unimplemented(dal::detail::error_messages::unimplemented_sorting_procedure());
@@ -72,6 +72,15 @@ struct graph_traits {
     using const_vertex_edge_range = empty_value;
 };
 
+/// The form of the degree-ordered topology view of an undirected graph
+enum class degree_ordered_topology_kind {
+    /// Every vertex keeps all its neighbors
+    symmetric,
+    /// Every vertex keeps only the neighbors with the greater or equal degree,
+    /// so each edge is stored once
+    oriented
+};
+
 /// Type of the graph properties
 /// @tparam Graph Type of the graph
 template <typename Graph>
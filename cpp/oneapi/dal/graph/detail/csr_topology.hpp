@@ -49,18 +49,19 @@ public:
     topology() = default;
     ~topology() = default;
 
-    inline void set_topology(vertex_set& cols,
-                             edge_set& rows,
-                             vertex_set& degrees,
+    inline void set_topology(const vertex_set& cols,
+                             const edge_set& rows,
+                             const vertex_set& degrees,
                              edge_size_type edge_count) {
         _vertex_count = degrees.get_count();
         _edge_count = edge_count;
         _cols = cols;
         _rows = rows;
         _degrees = degrees;
-        _cols_ptr = _cols.get_mutable_data();
-        _rows_ptr = _rows.get_mutable_data();
-        _degrees_ptr = _degrees.get_mutable_data();
+        _cols_ptr = _cols.get_data();
+        _rows_ptr = _rows.get_data();
+        _degrees_ptr = _degrees.get_data();
+        reset_degree_ordered_topology();
     }
 
     inline void set_topology(vertex_size_type vertex_count,
@@ -77,6 +78,7 @@ public:
         _rows_ptr = _rows.get_data();
         _cols_ptr = _cols.get_data();
         _degrees_ptr = _degrees.get_data();
+        reset_degree_ordered_topology();
     }
 
     inline void set_topology(vertex_size_type vertex_count,
@@ -93,6 +95,7 @@ public:
         _rows_ptr = _rows.get_data();
         _cols_ptr = _cols.get_data();
         _degrees_ptr = _degrees.get_data();
+        reset_degree_ordered_topology();
     }
 
     ONEDAL_FORCEINLINE std::int64_t get_vertex_count() const {
@@ -124,6 +127,28 @@ public:
         -> const_vertex_edge_iterator {
         return _cols_ptr + _rows[vertex + 1];
     }
+
+    inline void set_degree_ordered_topology(const vertex_set& cols,
+                                            const edge_set& rows,
+                                            const vertex_set& degrees,
+                                            bool is_oriented) {
+        _ordered_cols = cols;
+        _ordered_rows = rows;
+        _ordered_degrees = degrees;
+        _is_ordered_oriented = is_oriented;
+    }
+
+    inline void reset_degree_ordered_topology() {
+        _ordered_cols.reset();
+        _ordered_rows.reset();
+        _ordered_degrees.reset();
+        _is_ordered_oriented = false;
+    }
+
+    ONEDAL_FORCEINLINE bool has_degree_ordered_topology() const {
+        return _ordered_rows.get_count() > 0;
+    }
+
     vertex_set _cols;
     vertex_set _degrees;
     edge_set _rows;
@@ -135,6 +160,15 @@ public:
 
     std::int64_t _vertex_count = 0;
     std::int64_t _edge_count = 0;
+
+    // Copy of the topology with the vertices relabeled by non-increasing degree
+    // and sorted adjacency lists. In the oriented form, every vertex keeps only
+    // the neighbors with the lower new index. Built on demand and kept while the
+    // topology is not reset, so the algorithms run on the same graph share it
+    vertex_set _ordered_cols;
+    vertex_set _ordered_degrees;
+    edge_set _ordered_rows;
+    bool _is_ordered_oriented = false;
 };
 
 } // namespace oneapi::dal::preview::detail
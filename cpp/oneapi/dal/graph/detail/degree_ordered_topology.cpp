@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "oneapi/dal/graph/detail/degree_ordered_topology.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+// The adjacency lists are sorted inside the parallel loop over the vertices,
+// so only the lists of the high-degree vertices are worth sorting in parallel
+constexpr std::int64_t parallel_sort_min_count = 1 << 16;
+
+void build_degree_ordered_topology(const dal::detail::host_policy& policy,
+                                   topology<std::int32_t>& t,
+                                   bool is_oriented) {
+    const std::int64_t vertex_count = t.get_vertex_count();
+    if (vertex_count == 0) {
+        t.reset_degree_ordered_topology();
+        return;
+    }
+
+    // The same order as in the triangle counting relabeling: the vertices are
+    // sorted by (degree, index) and the order is reversed
+    auto degree_id_pairs = array<pair_int32_t_size_t>::empty(vertex_count);
+    auto degree_id_pairs_ptr = degree_id_pairs.get_mutable_data();
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t u) {
+        degree_id_pairs_ptr[u] = std::make_pair(t.get_vertex_degree(u), std::size_t(u));
+    });
+    dal::detail::parallel_sort(degree_id_pairs_ptr, degree_id_pairs_ptr + vertex_count);
+
+    auto new_ids = array<std::int32_t>::empty(vertex_count);
+    auto old_ids = array<std::int32_t>::empty(vertex_count);
+    auto new_ids_ptr = new_ids.get_mutable_data();
+    auto old_ids_ptr = old_ids.get_mutable_data();
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t n) {
+        const auto u = std::int32_t(degree_id_pairs_ptr[vertex_count - n - 1].second);
+        new_ids_ptr[u] = n;
+        old_ids_ptr[n] = u;
+    });
+    degree_id_pairs.reset();
+
+    auto degrees = array<std::int32_t>::empty(vertex_count);
+    auto degrees_ptr = degrees.get_mutable_data();
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t n) {
+        const std::int32_t u = old_ids_ptr[n];
+        if (!is_oriented) {
+            degrees_ptr[n] = t.get_vertex_degree(u);
+            return;
+        }
+        std::int32_t degree = 0;
+        for (auto v = t.get_vertex_neighbors_begin(u); v != t.get_vertex_neighbors_end(u); ++v) {
+            degree += (new_ids_ptr[*v] < n);
+        }
+        degrees_ptr[n] = degree;
+    });
+
+    auto rows = array<std::int64_t>::empty(vertex_count + 1);
+    auto rows_ptr = rows.get_mutable_data();
+    rows_ptr[0] = 0;
+    for (std::int64_t n = 0; n < vertex_count; ++n) {
+        rows_ptr[n + 1] = rows_ptr[n] + degrees_ptr[n];
+    }
+
+    auto cols = array<std::int32_t>::empty(rows_ptr[vertex_count]);
+    auto cols_ptr = cols.get_mutable_data();
+    dal::detail::threader_for(vertex_count, vertex_count, [&](std::int32_t n) {
+        const std::int32_t u = old_ids_ptr[n];
+        std::int32_t* neighbors = cols_ptr + rows_ptr[n];
+        std::int64_t count = 0;
+        for (auto v = t.get_vertex_neighbors_begin(u); v != t.get_vertex_neighbors_end(u); ++v) {
+            const std::int32_t new_v = new_ids_ptr[*v];
+            if (!is_oriented || new_v < n) {
+                neighbors[count++] = new_v;
+            }
+        }
+        if (count >= parallel_sort_min_count) {
+            dal::detail::parallel_sort(neighbors, neighbors + count);
+        }
+        else {
+            std::sort(neighbors, neighbors + count);
+        }
+    });
+
+    t.set_degree_ordered_topology(cols, rows, degrees, is_oriented);
+}
+
+} // namespace oneapi::dal::preview::detail
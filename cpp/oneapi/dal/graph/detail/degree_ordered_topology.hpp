@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/detail/policy.hpp"
+#include "oneapi/dal/graph/detail/csr_topology.hpp"
+
+namespace oneapi::dal::preview::detail {
+
+/// Relabels the vertices of the topology by non-increasing degree, sorts the
+/// relabeled adjacency lists and stores the result in the topology itself.
+/// If `is_oriented` is true, every vertex keeps only its neighbors with the
+/// lower new index, so each undirected edge is stored once.
+ONEDAL_EXPORT void build_degree_ordered_topology(const dal::detail::host_policy& policy,
+                                                 topology<std::int32_t>& t,
+                                                 bool is_oriented);
+
+} // namespace oneapi::dal::preview::detail
@@ -23,6 +23,7 @@
 #include "oneapi/dal/graph/common.hpp"
 #include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
 #include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::preview::detail {
 
@@ -48,9 +49,9 @@ public:
         rebinded_allocator ra(graph_impl._vertex_allocator);
         auto [degrees_array, degrees] = ra.template allocate_array<vertex_set_t>(vertex_count);
 
-        for (std::int64_t u = 0; u < vertex_count; u++) {
+        dal::detail::threader_for_int64(vertex_count, [&](std::int64_t u) {
             degrees[u] = rows[u + 1] - rows[u];
-        }
+        });
 
         graph_impl.set_topology(vertex_count, edge_count, rows, cols, edge_count, degrees);
         graph_impl.get_topology()._degrees = degrees_array;
@@ -18,6 +18,7 @@
 
 #include "oneapi/dal/graph/common.hpp"
 #include "oneapi/dal/graph/detail/container.hpp"
+#include "oneapi/dal/graph/detail/degree_ordered_topology.hpp"
 
 namespace oneapi::dal::preview::detail {
 
@@ -68,4 +69,12 @@ constexpr auto get_edge_value_impl(const Graph &g, vertex_type<Graph> u, vertex_
     return dal::detail::get_impl(g).get_edge_value(u, v);
 }
 
+template <typename Graph>
+void build_degree_ordered_topology_impl(Graph &g, degree_ordered_topology_kind kind) {
+    auto &t = dal::detail::get_impl(g).get_topology();
+    build_degree_ordered_topology(dal::detail::host_policy::get_default(),
+                                  t,
+                                  kind == degree_ordered_topology_kind::oriented);
+}
+
 } // namespace oneapi::dal::preview::detail
@@ -99,6 +99,19 @@ template <typename Graph>
 constexpr auto get_edge_value(const Graph &g, vertex_type<Graph> u, vertex_type<Graph> v)
     -> const edge_user_value_type<Graph> &;
 
+/// Builds the view of the graph topology with the vertices relabeled by
+/// non-increasing degree and keeps it in the graph object. The view is shared
+/// by all copies of the graph and is reused by the subsequent algorithm calls
+/// instead of relabeling the graph on every call.
+///
+/// @tparam Graph  Type of the graph
+/// @param [in]   g     Input graph object
+/// @param [in]   kind  The form of the view
+template <typename Graph>
+void build_degree_ordered_topology(
+    Graph &g,
+    degree_ordered_topology_kind kind = degree_ordered_topology_kind::symmetric);
+
 //Functions implementation
 template <typename Graph>
 constexpr auto get_vertex_count(const Graph &g) noexcept -> vertex_size_type<Graph> {
@@ -165,4 +178,11 @@ constexpr auto get_edge_value(const Graph &g, vertex_type<Graph> u, vertex_type<
     return detail::get_edge_value_impl(g, u, v);
 }
 
+template <typename Graph>
+void build_degree_ordered_topology(Graph &g, degree_ordered_topology_kind kind) {
+    static_assert(!is_directed<Graph>,
+                  "build_degree_ordered_topology requires graph undirectness");
+    detail::build_degree_ordered_topology_impl(g, kind);
+}
+
 } // namespace oneapi::dal::preview
@@ -27,11 +27,10 @@ namespace oneapi::dal::preview::csv::backend {
 
 template <typename Cpu>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
-    std::int32_t max_id = edges[0].first;
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        std::int32_t edge_max = std::max(edges[i].first, edges[i].second);
-        max_id = std::max(max_id, edge_max);
-    }
+    const std::int32_t max_id =
+        dal::detail::parallel_max(edges.size(), edges[0].first, [&](std::int64_t i) {
+            return std::max(edges[i].first, edges[i].second);
+        });
     const std::int64_t vertex_count = max_id + 1;
     return vertex_count;
 }
@@ -40,13 +39,9 @@ template <typename Cpu>
 std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return dal::detail::parallel_exclusive_scan<std::int64_t>(degrees,
+                                                              degrees_count,
+                                                              edge_offsets);
 }
 
 template <typename Cpu>
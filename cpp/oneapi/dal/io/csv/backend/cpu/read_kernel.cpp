@@ -23,21 +23,143 @@
 
 #endif
 
+#include <atomic>
+#include <limits>
+#include <vector>
+
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/detail/profiler.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/line_chunks.hpp"
+#include "oneapi/dal/io/csv/detail/read_graph_service.hpp"
 #include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/table/homogen.hpp"
 
 namespace oneapi::dal::csv::backend {
 
 namespace interop = dal::backend::interop;
 namespace daal_dm = daal::data_management;
 
-template <>
-table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
-                                         const detail::data_source_base& ds,
-                                         const read_args<table>& args) const {
+using value_t = DAAL_DATA_TYPE;
+
+inline bool is_blank(char c, char delimiter) {
+    return (c == ' ' || c == '\t') && c != delimiter;
+}
+
+inline const char* skip_blanks(const char* ptr, const char* end, char delimiter) {
+    while (ptr < end && is_blank(*ptr, delimiter)) {
+        ptr++;
+    }
+    return ptr;
+}
+
+inline std::int64_t count_columns(const char* begin, const char* end, char delimiter) {
+    return std::int64_t(std::count(begin, end, delimiter)) + 1;
+}
+
+/// Parses one line into `row`. Missing values are filled with NaN, extra
+/// values are ignored. Returns `false` if the line contains a non-numeric value.
+inline bool parse_row(const char* begin,
+                      const char* end,
+                      char delimiter,
+                      std::int64_t column_count,
+                      value_t* row) {
+    const char* ptr = begin;
+    for (std::int64_t j = 0; j < column_count; j++) {
+        ptr = skip_blanks(ptr, end, delimiter);
+        if (ptr >= end || *ptr == delimiter) {
+            row[j] = std::numeric_limits<value_t>::quiet_NaN();
+        }
+        else {
+            char* value_end = nullptr;
+            const double value = dal::preview::csv::detail::daal_string_to_double(ptr, &value_end);
+            if (value_end == ptr || value_end > end) {
+                return false;
+            }
+            row[j] = static_cast<value_t>(value);
+            ptr = skip_blanks(value_end, end, delimiter);
+            if (ptr < end && *ptr != delimiter) {
+                return false;
+            }
+        }
+        ptr += (ptr < end);
+    }
+    return true;
+}
+
+/// Reads numeric CSV file in parallel. The rows of each chunk of lines are
+/// counted first, then each chunk is parsed directly into the table memory at
+/// the offset given by the row counts of the preceding chunks.
+/// Returns an empty table if the file contains non-numeric values, they
+/// require the dictionary-based parsing.
+static table read_numeric_table(const detail::data_source_base& ds) {
+    ONEDAL_PROFILER_TASK(read_numeric_table);
+
+    const dal::backend::mapped_file file{ ds.get_file_name() };
+    const char* data = file.get_data();
+    const char* data_end = data + file.get_size();
+    const char delimiter = ds.get_delimiter();
+
+    const char* body = data;
+    if (ds.get_parse_header()) {
+        body = std::min(data_end, find_line_end(data, data_end) + 1);
+    }
+
+    // The number of columns is defined by the first non-empty line
+    std::int64_t column_count = 0;
+    for (const char* line = body; line < data_end && column_count == 0;) {
+        const char* line_end = find_line_end(line, data_end);
+        const char* first_line_end = std::find(line, line_end, '\r');
+        if (first_line_end > line) {
+            column_count = count_columns(line, first_line_end, delimiter);
+        }
+        line = line_end + 1;
+    }
+    if (column_count == 0) {
+        return table{};
+    }
+
+    const auto bounds = split_by_lines(body, std::int64_t(data_end - body));
+    const std::int64_t chunk_count = std::int64_t(bounds.size()) - 1;
+    ONEDAL_ASSERT(chunk_count <= dal::detail::limits<std::int32_t>::max());
+
+    std::vector<std::int64_t> row_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        row_offsets[i + 1] = count_lines(body + bounds[i], body + bounds[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; i++) {
+        row_offsets[i + 1] += row_offsets[i];
+    }
+    const std::int64_t row_count = row_offsets[chunk_count];
+
+    auto values = array<value_t>::empty(row_count * column_count);
+    value_t* values_ptr = values.get_mutable_data();
+
+    std::atomic<bool> is_numeric = true;
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        value_t* row = values_ptr + row_offsets[i] * column_count;
+        for_each_line(body + bounds[i],
+                      body + bounds[i + 1],
+                      data_end,
+                      [&](const char* begin, const char* end) {
+                          if (!parse_row(begin, end, delimiter, column_count, row)) {
+                              is_numeric.store(false, std::memory_order_relaxed);
+                          }
+                          row += column_count;
+                      });
+    });
+
+    if (!is_numeric.load()) {
+        return table{};
+    }
+
+    return homogen_table::wrap(values, row_count, column_count);
+}
+
+static table read_with_daal_data_source(const detail::data_source_base& ds) {
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
@@ -56,4 +178,15 @@ table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
         daal_data_source.getNumericTable());
 }
 
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    table result = read_numeric_table(ds);
+    if (result.has_data()) {
+        return result;
+    }
+    return read_with_daal_data_source(ds);
+}
+
 } // namespace oneapi::dal::csv::backend
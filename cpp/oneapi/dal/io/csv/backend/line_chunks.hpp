@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/detail/threading.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Minimal size of the text chunk processed by a single thread
+constexpr std::int64_t min_line_chunk_size = 1 << 20;
+
+inline const char* find_line_end(const char* begin, const char* end) {
+    const void* line_end = std::memchr(begin, '\n', std::size_t(end - begin));
+    return line_end ? static_cast<const char*>(line_end) : end;
+}
+
+/// Splits the text into chunks that start at the beginning of a line.
+/// Returns `chunk_count + 1` offsets of the chunk boundaries, the number of
+/// chunks is chosen to load all the threads, but may be smaller for short texts.
+inline std::vector<std::int64_t> split_by_lines(const char* data, std::int64_t size) {
+    const std::int64_t max_chunk_count = 4 * std::int64_t(dal::detail::threader_get_max_threads());
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(1,
+                               std::min(max_chunk_count,
+                                        (size + min_line_chunk_size - 1) / min_line_chunk_size));
+
+    std::vector<std::int64_t> bounds;
+    bounds.reserve(chunk_count + 1);
+    bounds.push_back(0);
+    for (std::int64_t i = 1; i < chunk_count; i++) {
+        const std::int64_t guess = std::max(bounds.back(), size * i / chunk_count);
+        const char* line_end = find_line_end(data + guess, data + size);
+        const std::int64_t bound = std::min(size, std::int64_t(line_end - data) + 1);
+        if (bound > bounds.back() && bound < size) {
+            bounds.push_back(bound);
+        }
+    }
+    bounds.push_back(size);
+    return bounds;
+}
+
+/// Calls `body(line_begin, line_end)` for each non-empty line of the chunk.
+/// The character at `line_end` always stops number parsing: it is either a
+/// line terminator or the null terminator of a copy that is made for the last
+/// line of the text if it does not end with a newline.
+template <typename Body>
+inline void for_each_line(const char* begin, const char* end, const char* text_end, Body&& body) {
+    const char* line_begin = begin;
+    while (line_begin < end) {
+        const char* line_end = find_line_end(line_begin, end);
+        const char* content_end = line_end;
+        while (content_end > line_begin && content_end[-1] == '\r') {
+            content_end--;
+        }
+
+        if (content_end > line_begin) {
+            if (line_end == text_end) {
+                const std::string last_line{ line_begin, content_end };
+                body(last_line.c_str(), last_line.c_str() + last_line.size());
+            }
+            else {
+                body(line_begin, content_end);
+            }
+        }
+        line_begin = line_end + 1;
+    }
+}
+
+/// Counts non-empty lines of the chunk
+inline std::int64_t count_lines(const char* begin, const char* end) {
+    std::int64_t count = 0;
+    const char* line_begin = begin;
+    while (line_begin < end) {
+        const char* line_end = find_line_end(line_begin, end);
+        const char* content_end = line_end;
+        while (content_end > line_begin && content_end[-1] == '\r') {
+            content_end--;
+        }
+        count += (content_end > line_begin);
+        line_begin = line_end + 1;
+    }
+    return count;
+}
+
+} // namespace oneapi::dal::csv::backend
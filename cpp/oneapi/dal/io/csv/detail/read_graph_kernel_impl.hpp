@@ -18,8 +18,10 @@
 
 #include <algorithm>
 #include <atomic>
-#include <fstream>
+#include <string>
+#include <vector>
 
+#include "oneapi/dal/backend/mapped_file.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/common.hpp"
@@ -27,124 +29,156 @@
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/io/csv/detail/read_graph_service.hpp"
 #include "oneapi/dal/io/csv/detail/common.hpp"
+#include "oneapi/dal/io/csv/backend/line_chunks.hpp"
 
 namespace oneapi::dal::preview::csv::detail {
 
-template <typename EdgeList>
-inline void read_edge_list(const std::string &name, EdgeList &elist);
+inline bool has_only_spaces(const char *begin, const char *end) {
+    return std::all_of(begin, end, [](char c) {
+        return std::isspace(c);
+    });
+}
 
-template <typename Vertex>
-inline void read_edge_list(const std::string &name, edge_list<Vertex> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+/// Parses the value that follows optional spaces at `begin`. Returns the end
+/// of the value, or `begin` if the line has no value there. The character at
+/// `end` must stop number parsing, so the value never runs past the line.
+template <typename T>
+inline const char *parse_value(const char *begin, const char *end, T &value) {
+    const char *value_begin = begin;
+    while (value_begin < end && std::isspace(*value_begin)) {
+        value_begin++;
+    }
+    if (value_begin == end) {
+        return begin;
     }
-    elist.reserve(1024);
 
-    std::string line;
-    char *source_endptr;
-    char *dest_endptr;
-    const char *edgeline;
-    Vertex source_vertex;
-    Vertex destination_vertex;
+    char *value_end;
+    value = daal_string_to<T>(value_begin, &value_end);
+    ONEDAL_ASSERT(value_end <= end);
+    return value_end == value_begin ? begin : value_end;
+}
 
-    while (getline(file, line)) {
-        if (line.empty()) {
-            continue;
-        }
-        edgeline = line.c_str();
-        source_vertex = daal_string_to_int(edgeline, &source_endptr);
-        if (std::isspace(*source_endptr)) {
-            source_endptr++;
-        }
-        destination_vertex = daal_string_to_int(source_endptr, &dest_endptr);
+inline void throw_invalid_line(const char *begin, const char *end) {
+    throw invalid_argument("Invalid line content: " + std::string(begin, end));
+}
 
-        if (source_endptr == dest_endptr) {
-            throw invalid_argument("Invalid line content: " + line);
-        }
+template <typename Vertex>
+inline void parse_edge(const char *begin, const char *end, std::pair<Vertex, Vertex> &edge) {
+    Vertex source_vertex;
+    Vertex destination_vertex;
 
-        if (source_vertex < 0 || destination_vertex < 0) {
-            throw invalid_argument("Negative vertex ids: " + line);
-        }
+    const char *source_end = parse_value(begin, end, source_vertex);
+    if (source_end == begin) {
+        throw_invalid_line(begin, end);
+    }
+    const char *dest_end = parse_value(source_end, end, destination_vertex);
+    if (dest_end == source_end) {
+        throw_invalid_line(begin, end);
+    }
 
-        if (*dest_endptr != '\0') {
-            while (*dest_endptr != '\0') {
-                if (!std::isspace(*dest_endptr)) {
-                    throw invalid_argument("Invalid line content: " + line);
-                }
-                dest_endptr++;
-            }
-        }
+    if (source_vertex < 0 || destination_vertex < 0) {
+        throw invalid_argument("Negative vertex ids: " + std::string(begin, end));
+    }
 
-        auto edge = std::make_pair(source_vertex, destination_vertex);
-        elist.push_back(edge);
+    if (!has_only_spaces(dest_end, end)) {
+        throw_invalid_line(begin, end);
     }
-    file.close();
+
+    edge = std::make_pair(source_vertex, destination_vertex);
 }
 
 template <typename Vertex, typename Weight>
-inline void read_edge_list(const std::string &name, weighted_edge_list<Vertex, Weight> &elist) {
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
-    }
-    elist.reserve(1024);
-
-    std::string line;
-    char *source_endptr;
-    char *dest_endptr;
-    char *value_endptr;
-    const char *edgeline;
+inline void parse_edge(const char *begin,
+                       const char *end,
+                       std::tuple<Vertex, Vertex, Weight> &edge) {
     Vertex source_vertex;
     Vertex destination_vertex;
     Weight edge_value;
 
-    while (getline(file, line)) {
-        if (line.empty()) {
-            continue;
-        }
-        edgeline = line.c_str();
-        source_vertex = daal_string_to<Vertex>(edgeline, &source_endptr);
-        if (std::isspace(*source_endptr)) {
-            source_endptr++;
-        }
-        destination_vertex = daal_string_to<Vertex>(source_endptr, &dest_endptr);
-        if (std::isspace(*dest_endptr)) {
-            dest_endptr++;
-        }
-        edge_value = daal_string_to<Weight>(dest_endptr, &value_endptr);
+    const char *source_end = parse_value(begin, end, source_vertex);
+    if (source_end == begin) {
+        throw_invalid_line(begin, end);
+    }
+    const char *dest_end = parse_value(source_end, end, destination_vertex);
+    if (dest_end == source_end) {
+        throw_invalid_line(begin, end);
+    }
+    const char *value_end = parse_value(dest_end, end, edge_value);
+    if (value_end == dest_end) {
+        throw_invalid_line(begin, end);
+    }
 
-        if (dest_endptr == value_endptr) {
-            throw invalid_argument("Invalid line content: " + line);
-        }
+    if (source_vertex < 0 || destination_vertex < 0) {
+        throw invalid_argument("Negative vertex ids: " + std::string(begin, end));
+    }
 
-        if (source_vertex < 0 || destination_vertex < 0) {
-            throw invalid_argument("Negative vertex ids: " + line);
-        }
+    if (!has_only_spaces(value_end, end)) {
+        throw_invalid_line(begin, end);
+    }
 
-        if (*value_endptr != '\0') {
-            while (*value_endptr != '\0') {
-                if (!std::isspace(*value_endptr)) {
-                    throw invalid_argument("Invalid line content: " + line);
-                }
-                value_endptr++;
-            }
-        }
+    edge = std::tuple<Vertex, Vertex, Weight>(source_vertex, destination_vertex, edge_value);
+}
+
+/// Reads the edge list from the memory-mapped file. The file is split into
+/// chunks at line boundaries, each chunk is parsed by its own thread directly
+/// into the position of its first edge in the list.
+template <typename EdgeList>
+inline void read_edge_list(const std::string &name, EdgeList &elist) {
+    namespace csv_backend = dal::csv::backend;
 
-        auto edge =
-            std::tuple<Vertex, Vertex, Weight>(source_vertex, destination_vertex, edge_value);
-        elist.push_back(edge);
+    const dal::backend::mapped_file file{ name };
+    const char *data = file.get_data();
+    const std::int64_t size = file.get_size();
+
+    const auto bounds = csv_backend::split_by_lines(data, size);
+    const std::int64_t chunk_count = std::int64_t(bounds.size()) - 1;
+    ONEDAL_ASSERT(chunk_count <= dal::detail::limits<std::int32_t>::max());
+
+    std::vector<std::int64_t> edge_offsets(chunk_count + 1, 0);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        edge_offsets[i + 1] = csv_backend::count_lines(data + bounds[i], data + bounds[i + 1]);
+    });
+    for (std::int64_t i = 0; i < chunk_count; i++) {
+        edge_offsets[i + 1] += edge_offsets[i];
+    }
+
+    elist.resize(edge_offsets[chunk_count]);
+    auto *edges = elist.get_mutable_data();
+
+    // Exceptions cannot leave the parallel region, so the first error of each
+    // chunk is kept and the error of the earliest chunk is rethrown
+    std::vector<std::string> errors(chunk_count);
+    dal::detail::threader_for(chunk_count, chunk_count, [&](std::int32_t i) {
+        std::int64_t edge_index = edge_offsets[i];
+        csv_backend::for_each_line(data + bounds[i],
+                                   data + bounds[i + 1],
+                                   data + size,
+                                   [&](const char *begin, const char *end) {
+                                       if (!errors[i].empty()) {
+                                           return;
+                                       }
+                                       try {
+                                           parse_edge(begin, end, edges[edge_index++]);
+                                       }
+                                       catch (const invalid_argument &ex) {
+                                           errors[i] = ex.what();
+                                       }
+                                   });
+    });
+
+    for (const auto &error : errors) {
+        if (!error.empty()) {
+            throw invalid_argument(error);
+        }
     }
-    file.close();
 }
 
 template <typename EdgeList>
 std::int64_t get_vertex_count_from_edge_list(const EdgeList &edges) {
-    auto max_id = std::get<0>(edges[0]);
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        auto edge_max = std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
-        max_id = std::max(max_id, edge_max);
-    }
+    const auto max_id =
+        dal::detail::parallel_max(edges.size(), std::get<0>(edges[0]), [&](std::int64_t i) {
+            return std::max(std::get<0>(edges[i]), std::get<1>(edges[i]));
+        });
 
     const std::int64_t vertex_count = max_id + 1;
     return vertex_count;
@@ -197,26 +231,16 @@ template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
 EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
                                     std::int64_t degrees_count,
                                     AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return dal::detail::parallel_exclusive_scan<EdgeIndex>(degrees,
+                                                           degrees_count,
+                                                           edge_offsets_atomic);
 }
 
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
                              EdgeIndex *edge_offsets) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return dal::detail::parallel_exclusive_scan<EdgeIndex>(degrees, degrees_count, edge_offsets);
 }
 
 template <>
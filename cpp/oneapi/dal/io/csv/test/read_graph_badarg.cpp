@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/io/csv/backend/line_chunks.hpp"
 #include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
 #include "oneapi/dal/graph/service_functions.hpp"
 
@@ -307,4 +308,30 @@ READ_GRAPH_BADARG_TEST("Vertex id is greater than int32_max") {
     delete_test_data(filename);
 }
 
+READ_GRAPH_BADARG_TEST("The error of the first invalid line is reported") {
+    // Invalid lines go to the first and the last of several chunks that are
+    // parsed in parallel, the error must not depend on which chunk fails first
+    constexpr std::int32_t edge_count = 400000;
+    std::string file_content = "0 1\n1 2ab\n";
+    for (std::int32_t i = 2; i < edge_count; ++i) {
+        file_content += std::to_string(i) + " " + std::to_string(i + 1) + "\n";
+    }
+    file_content += "3 4cd\n";
+    REQUIRE(dal::csv::backend::split_by_lines(file_content.data(), file_content.size()).size() >
+            2);
+
+    std::string filename = "several_invalid_lines.csv";
+    std::ofstream(filename) << file_content;
+    std::string error;
+    try {
+        dal::read<unweighted_graph_t>(dal::csv::data_source{ filename });
+    }
+    catch (const invalid_argument& ex) {
+        error = ex.what();
+    }
+    delete_test_data(filename);
+
+    REQUIRE(error.find("1 2ab") != std::string::npos);
+}
+
 } //namespace oneapi::dal::preview::csv::test
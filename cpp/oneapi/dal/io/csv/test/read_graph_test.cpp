@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/io/csv/backend/line_chunks.hpp"
 #include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
 #include "oneapi/dal/graph/service_functions.hpp"
 
@@ -453,6 +454,51 @@ READ_GRAPH_TEST("Symmetrized edge list, weighted") {
     this->general_check(graph_data, true, full_filename);
 }
 
+READ_GRAPH_TEST("Edge list split into several chunks") {
+    // The path over all the vertices is long enough to be read by several
+    // threads, every edge must land at its position in the list
+    constexpr std::int32_t edge_count = 400000;
+    std::string content;
+    for (std::int32_t i = 0; i < edge_count; ++i) {
+        content += std::to_string(i) + " " + std::to_string(i + 1) + "\n";
+    }
+    REQUIRE(dal::csv::backend::split_by_lines(content.data(), content.size()).size() > 2);
+
+    std::string filename = "path_graph" + std::to_string(std::rand()) + ".csv";
+    std::ofstream(filename) << content;
+
+    edge_list_t elist;
+    read_edge_list(filename, elist);
+    REQUIRE(elist.size() == edge_count);
+    std::int32_t num_correct_edges = 0;
+    for (std::int32_t i = 0; i < edge_count; ++i) {
+        if (elist[i].first == i && elist[i].second == i + 1)
+            num_correct_edges++;
+    }
+    REQUIRE(num_correct_edges == edge_count);
+
+    const auto graph = dal::read<unweighted_graph_t>(dal::csv::data_source{ filename });
+    REQUIRE(dal::preview::get_vertex_count(graph) == edge_count + 1);
+    REQUIRE(dal::preview::get_edge_count(graph) == edge_count);
+    delete_test_data(filename);
+}
+
+READ_GRAPH_TEST("The last line has no trailing newline") {
+    std::string filename = "no_trailing_newline" + std::to_string(std::rand()) + ".csv";
+    std::ofstream(filename) << "0 1\n1 2\r\n2 3";
+    edge_list_t elist;
+    read_edge_list(filename, elist);
+    REQUIRE(elist.size() == 3);
+    REQUIRE(elist[2] == std::make_pair(2, 3));
+
+    std::ofstream(filename) << "0 1 5\n1 2 7 ";
+    weighted_edge_list_t weighted_elist;
+    read_edge_list(filename, weighted_elist);
+    REQUIRE(weighted_elist.size() == 2);
+    REQUIRE(std::get<2>(weighted_elist[1]) == 7);
+    delete_test_data(filename);
+}
+
 // READ_GRAPH_TEST("Check usage of custom allocator") {
 //     K10_graph_data graph_data;
 //     CountingAllocator<char> alloc;
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::csv::test {
+
+class read_table_test {
+public:
+    ~read_table_test() {
+        std::remove(filename_.c_str());
+    }
+
+    void write_test_data(const std::string& content) {
+        std::ofstream outf(filename_, std::ios::binary);
+        REQUIRE(outf.is_open());
+        outf << content;
+    }
+
+    table read(const data_source& ds) {
+        return dal::read<table>(ds);
+    }
+
+    void check_table(const table& t,
+                     std::int64_t row_count,
+                     std::int64_t column_count,
+                     const std::vector<float>& expected) {
+        REQUIRE(t.get_row_count() == row_count);
+        REQUIRE(t.get_column_count() == column_count);
+
+        const auto rows = row_accessor<const float>{ t }.pull();
+        REQUIRE(rows.get_count() == std::int64_t(expected.size()));
+        for (std::int64_t i = 0; i < rows.get_count(); i++) {
+            CAPTURE(i);
+            if (std::isnan(expected[i])) {
+                REQUIRE(std::isnan(rows[i]));
+            }
+            else {
+                REQUIRE(rows[i] == Approx(expected[i]));
+            }
+        }
+    }
+
+    const std::string& get_filename() const {
+        return filename_;
+    }
+
+private:
+    std::string filename_ = "read_table_test.csv";
+};
+
+TEST_M(read_table_test, "read numeric table", "[csv][table]") {
+    write_test_data("1.5,2,3\n4,-5.25,6e1\n7,8,9\n");
+    const auto t = read(data_source{ get_filename() });
+    check_table(t, 3, 3, { 1.5f, 2.f, 3.f, 4.f, -5.25f, 60.f, 7.f, 8.f, 9.f });
+}
+
+TEST_M(read_table_test, "read table without trailing newline", "[csv][table]") {
+    write_test_data("1,2\n3,4");
+    const auto t = read(data_source{ get_filename() });
+    check_table(t, 2, 2, { 1.f, 2.f, 3.f, 4.f });
+}
+
+TEST_M(read_table_test, "read table with header and CRLF line endings", "[csv][table]") {
+    write_test_data("a,b\r\n1,2\r\n\r\n3,4\r\n");
+    const auto t = read(data_source{ get_filename() }.set_parse_header(true));
+    check_table(t, 2, 2, { 1.f, 2.f, 3.f, 4.f });
+}
+
+TEST_M(read_table_test, "read table with custom delimiter", "[csv][table]") {
+    write_test_data("1;2;3\n4;5;6\n");
+    const auto t = read(data_source{ get_filename() }.set_delimiter(';'));
+    check_table(t, 2, 3, { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f });
+}
+
+TEST_M(read_table_test, "read table with missing values", "[csv][table]") {
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    write_test_data("1,,3\n4,5\n, 7 ,\n");
+    const auto t = read(data_source{ get_filename() });
+    check_table(t, 3, 3, { 1.f, nan, 3.f, 4.f, 5.f, nan, nan, 7.f, nan });
+}
+
+TEST_M(read_table_test, "read large table split into several chunks", "[csv][table]") {
+    constexpr std::int64_t row_count = 200000;
+    constexpr std::int64_t column_count = 4;
+
+    std::string content;
+    std::vector<float> expected;
+    for (std::int64_t i = 0; i < row_count; i++) {
+        for (std::int64_t j = 0; j < column_count; j++) {
+            const std::int64_t value = i * column_count + j;
+            content += std::to_string(value) + (j + 1 < column_count ? "," : "\n");
+            expected.push_back(float(value));
+        }
+    }
+    write_test_data(content);
+
+    const auto t = read(data_source{ get_filename() });
+    check_table(t, row_count, column_count, expected);
+}
+
+} // namespace oneapi::dal::csv::test
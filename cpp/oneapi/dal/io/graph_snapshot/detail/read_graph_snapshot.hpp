@@ -0,0 +1,244 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "oneapi/dal/backend/mapped_file.hpp"
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/graph/detail/common.hpp"
+#include "oneapi/dal/io/graph_snapshot/common.hpp"
+#include "oneapi/dal/io/graph_snapshot/detail/snapshot_format.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot::detail {
+
+template <typename Graph>
+inline std::int32_t get_weight_type() {
+    using value_t = edge_user_value_type<Graph>;
+    if constexpr (std::is_same_v<value_t, empty_value>) {
+        return -1;
+    }
+    else {
+        return static_cast<std::int32_t>(dal::detail::make_data_type<value_t>());
+    }
+}
+
+template <typename Graph>
+inline std::int32_t get_weight_size() {
+    using value_t = edge_user_value_type<Graph>;
+    if constexpr (std::is_same_v<value_t, empty_value>) {
+        return 0;
+    }
+    else {
+        return sizeof(value_t);
+    }
+}
+
+inline bool is_section_in_file(const snapshot_header& header,
+                               std::int64_t offset,
+                               std::int64_t count,
+                               std::int64_t element_size) {
+    return offset >= static_cast<std::int64_t>(sizeof(snapshot_header)) &&
+           offset % snapshot_alignment == 0 && count >= 0 &&
+           count <= (header.file_size - offset) / element_size;
+}
+
+inline const snapshot_header& read_snapshot_header(const dal::backend::mapped_file& file) {
+    if (file.get_size() < static_cast<std::int64_t>(sizeof(snapshot_header))) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    const auto& header = *reinterpret_cast<const snapshot_header*>(file.get_data());
+    if (header.magic != snapshot_magic || header.version != snapshot_version ||
+        header.file_size > file.get_size() || header.vertex_count < 0 ||
+        header.vertex_size <= 0 || header.edge_size <= 0 || header.vertex_edge_size <= 0 ||
+        header.weight_size < 0) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.neighbor_count;
+    bool is_valid =
+        is_section_in_file(header, header.degrees_offset, vertex_count, header.vertex_size) &&
+        is_section_in_file(header, header.offsets_offset, vertex_count + 1, header.edge_size) &&
+        is_section_in_file(header, header.neighbors_offset, neighbor_count, header.vertex_size);
+    if (header.flags & snapshot_flag_vertex_offsets) {
+        is_valid = is_valid && is_section_in_file(header,
+                                                  header.vertex_offsets_offset,
+                                                  vertex_count + 1,
+                                                  header.vertex_edge_size);
+    }
+    if (header.flags & snapshot_flag_weighted) {
+        is_valid = is_valid && header.weight_size > 0 &&
+                   is_section_in_file(header,
+                                      header.weights_offset,
+                                      neighbor_count,
+                                      header.weight_size);
+    }
+    if (!is_valid) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+
+    return header;
+}
+
+template <typename Graph>
+inline void check_snapshot_type(const snapshot_header& header) {
+    using graph_impl_t = typename graph_traits<Graph>::impl_type;
+    using vertex_t = typename graph_impl_t::vertex_type;
+    using edge_t = typename graph_impl_t::edge_type;
+    using vertex_edge_t = typename graph_impl_t::vertex_edge_type;
+
+    const bool is_directed_snapshot = (header.flags & snapshot_flag_directed) != 0;
+    const bool is_weighted_snapshot = (header.flags & snapshot_flag_weighted) != 0;
+    const bool is_weighted_graph = get_weight_size<Graph>() > 0;
+
+    if (is_directed_snapshot != is_directed<Graph> ||
+        header.vertex_size != static_cast<std::int32_t>(sizeof(vertex_t)) ||
+        header.edge_size != static_cast<std::int32_t>(sizeof(edge_t)) ||
+        header.vertex_edge_size != static_cast<std::int32_t>(sizeof(vertex_edge_t)) ||
+        is_weighted_snapshot != is_weighted_graph ||
+        (is_weighted_graph && (header.weight_type != get_weight_type<Graph>() ||
+                               header.weight_size != get_weight_size<Graph>()))) {
+        throw invalid_argument(
+            dal::detail::error_messages::graph_snapshot_does_not_match_graph_type());
+    }
+}
+
+/// Checks that the offsets are non-decreasing and agree with the degrees and
+/// the vertex offsets, and that the neighbors are valid vertex ids. The
+/// vertices and the neighbors are checked in blocks in parallel.
+template <typename Graph>
+inline bool is_topology_valid(const dal::backend::mapped_file& file,
+                              const snapshot_header& header) {
+    using graph_impl_t = typename graph_traits<Graph>::impl_type;
+    using vertex_t = typename graph_impl_t::vertex_type;
+    using edge_t = typename graph_impl_t::edge_type;
+    using vertex_edge_t = typename graph_impl_t::vertex_edge_type;
+
+    constexpr std::int64_t block_size = 1 << 14;
+    const std::int64_t vertex_count = header.vertex_count;
+    const std::int64_t neighbor_count = header.neighbor_count;
+    const bool has_vertex_offsets = (header.flags & snapshot_flag_vertex_offsets) != 0;
+
+    const auto degrees = reinterpret_cast<const vertex_t*>(file.get_data() + header.degrees_offset);
+    const auto offsets = reinterpret_cast<const edge_t*>(file.get_data() + header.offsets_offset);
+    const auto neighbors =
+        reinterpret_cast<const vertex_t*>(file.get_data() + header.neighbors_offset);
+    const auto vertex_offsets =
+        reinterpret_cast<const vertex_edge_t*>(file.get_data() + header.vertex_offsets_offset);
+
+    std::atomic<bool> is_valid{ true };
+
+    const std::int64_t vertex_block_count = (vertex_count + block_size - 1) / block_size;
+    dal::detail::threader_for_int64(vertex_block_count, [&](std::int64_t block_index) {
+        const std::int64_t begin = block_index * block_size;
+        const std::int64_t end = std::min(begin + block_size, vertex_count);
+        for (std::int64_t u = begin; u < end; ++u) {
+            if (offsets[u] > offsets[u + 1] || offsets[u + 1] - offsets[u] != degrees[u] ||
+                (has_vertex_offsets && std::int64_t(vertex_offsets[u + 1]) != offsets[u + 1])) {
+                is_valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+
+    const std::int64_t neighbor_block_count = (neighbor_count + block_size - 1) / block_size;
+    dal::detail::threader_for_int64(neighbor_block_count, [&](std::int64_t block_index) {
+        const std::int64_t begin = block_index * block_size;
+        const std::int64_t end = std::min(begin + block_size, neighbor_count);
+        for (std::int64_t i = begin; i < end; ++i) {
+            if (neighbors[i] < 0 || neighbors[i] >= vertex_count) {
+                is_valid.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+
+    return is_valid.load();
+}
+
+template <typename Graph>
+inline void check_snapshot_topology(const dal::backend::mapped_file& file,
+                                    const snapshot_header& header,
+                                    bool validate_topology) {
+    using edge_t = typename graph_traits<Graph>::impl_type::edge_type;
+    using vertex_edge_t = typename graph_traits<Graph>::impl_type::vertex_edge_type;
+
+    const std::int64_t vertex_count = header.vertex_count;
+    const auto offsets = reinterpret_cast<const edge_t*>(file.get_data() + header.offsets_offset);
+    bool is_valid = offsets[0] == 0 && std::int64_t(offsets[vertex_count]) == header.neighbor_count;
+    if (header.flags & snapshot_flag_vertex_offsets) {
+        const auto vertex_offsets =
+            reinterpret_cast<const vertex_edge_t*>(file.get_data() + header.vertex_offsets_offset);
+        is_valid = is_valid && vertex_offsets[0] == 0;
+    }
+    if (!is_valid || (validate_topology && !is_topology_valid<Graph>(file, header))) {
+        throw invalid_argument(dal::detail::error_messages::invalid_graph_snapshot());
+    }
+}
+
+/// Wraps the section of the mapped file into the array. The array shares
+/// the ownership of the mapping, so the graph keeps the file mapped.
+template <typename T>
+inline dal::array<T> wrap_section(const std::shared_ptr<dal::backend::mapped_file>& file,
+                                  std::int64_t offset,
+                                  std::int64_t count) {
+    const T* data = reinterpret_cast<const T*>(file->get_data() + offset);
+    return dal::array<T>(std::shared_ptr<const T>(file, data), count);
+}
+
+template <typename Graph>
+Graph read_graph_snapshot(const data_source_base& ds, bool validate_topology) {
+    using graph_impl_t = typename graph_traits<Graph>::impl_type;
+    using vertex_t = typename graph_impl_t::vertex_type;
+    using edge_t = typename graph_impl_t::edge_type;
+    using vertex_edge_t = typename graph_impl_t::vertex_edge_type;
+    using value_t = typename graph_impl_t::edge_user_value_type;
+
+    const auto file = std::make_shared<dal::backend::mapped_file>(ds.get_file_name());
+    const auto& header = read_snapshot_header(*file);
+    check_snapshot_type<Graph>(header);
+    check_snapshot_topology<Graph>(*file, header, validate_topology);
+
+    const auto degrees =
+        wrap_section<vertex_t>(file, header.degrees_offset, header.vertex_count);
+    const auto rows = wrap_section<edge_t>(file, header.offsets_offset, header.vertex_count + 1);
+    const auto cols = wrap_section<vertex_t>(file, header.neighbors_offset, header.neighbor_count);
+
+    Graph graph;
+    auto& graph_impl = oneapi::dal::detail::get_impl(graph);
+    graph_impl.set_topology(cols, rows, degrees, header.edge_count);
+
+    if (header.flags & snapshot_flag_vertex_offsets) {
+        graph_impl.get_topology()._rows_vertex =
+            wrap_section<vertex_edge_t>(file, header.vertex_offsets_offset, header.vertex_count + 1);
+    }
+
+    if constexpr (!std::is_same_v<value_t, empty_value>) {
+        auto weights = wrap_section<value_t>(file, header.weights_offset, header.neighbor_count);
+        graph_impl.set_edge_values(weights);
+    }
+
+    return graph;
+}
+
+} // namespace oneapi::dal::preview::graph_snapshot::detail
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/graph_snapshot/read_types.hpp"
+#include "oneapi/dal/io/graph_snapshot/detail/read_graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot::detail {
+namespace v1 {
+
+template <typename Object, typename DataSource>
+struct read_ops;
+
+template <typename Graph>
+struct read_ops<Graph, data_source> {
+    using input_t = read_args<Graph>;
+    using result_t = Graph;
+
+    void check_preconditions(const data_source_base& ds, const input_t& args) const {}
+
+    void check_postconditions(const data_source_base& ds,
+                              const input_t& args,
+                              const result_t& result) const {}
+
+    template <typename Policy>
+    auto operator()(const Policy& ctx, const data_source_base& ds, const input_t& args) const {
+        static_assert(dal::detail::is_one_of_v<Policy, dal::detail::host_policy>,
+                      "Host policy only is supported.");
+        check_preconditions(ds, args);
+        auto result = read_graph_snapshot<Graph>(ds, args.get_validate_topology());
+        check_postconditions(ds, args, result);
+        return result;
+    }
+};
+
+} // namespace v1
+
+using v1::read_ops;
+
+} // namespace oneapi::dal::preview::graph_snapshot::detail
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace oneapi::dal::preview::graph_snapshot::detail {
+
+/// "ODALSNAP" in little-endian byte order
+constexpr std::uint64_t snapshot_magic = 0x50414e534c41444fULL;
+constexpr std::uint32_t snapshot_version = 1;
+
+/// Alignment of the arrays in the snapshot file, the file is mapped at the
+/// page boundary, so the arrays keep this alignment in memory
+constexpr std::int64_t snapshot_alignment = 64;
+
+enum snapshot_flags : std::uint32_t {
+    snapshot_flag_directed = 1,
+    snapshot_flag_weighted = 2,
+    snapshot_flag_vertex_offsets = 4
+};
+
+/// Header at the beginning of the snapshot file. It is followed by the arrays
+/// in the order: degrees, offsets, neighbors, vertex offsets (optional),
+/// edge weights (optional). All values are stored in the native byte order.
+struct snapshot_header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t flags;
+
+    std::int64_t vertex_count;
+    std::int64_t edge_count;
+    std::int64_t neighbor_count;
+
+    /// Sizes of the vertex ids, the offsets and the optional vertex
+    /// offsets, they must match the types of the graph the file is read to
+    std::int32_t vertex_size;
+    std::int32_t edge_size;
+    std::int32_t vertex_edge_size;
+    std::int32_t weight_size;
+    std::int32_t weight_type;
+    std::int32_t reserved_0;
+
+    std::int64_t degrees_offset;
+    std::int64_t offsets_offset;
+    std::int64_t neighbors_offset;
+    std::int64_t vertex_offsets_offset;
+    std::int64_t weights_offset;
+    std::int64_t file_size;
+
+    std::int64_t reserved_1[2];
+};
+
+static_assert(sizeof(snapshot_header) == 128);
+
+inline std::int64_t align_snapshot_offset(std::int64_t offset) {
+    return (offset + snapshot_alignment - 1) / snapshot_alignment * snapshot_alignment;
+}
+
+/// Computes the positions of the arrays in the snapshot file
+inline snapshot_header make_snapshot_header(std::int64_t vertex_count,
+                                            std::int64_t edge_count,
+                                            std::int64_t neighbor_count,
+                                            std::uint32_t flags,
+                                            std::int32_t vertex_size,
+                                            std::int32_t edge_size,
+                                            std::int32_t vertex_edge_size,
+                                            std::int32_t weight_size,
+                                            std::int32_t weight_type) {
+    snapshot_header header = {};
+    header.magic = snapshot_magic;
+    header.version = snapshot_version;
+    header.flags = flags;
+    header.vertex_count = vertex_count;
+    header.edge_count = edge_count;
+    header.neighbor_count = neighbor_count;
+    header.vertex_size = vertex_size;
+    header.edge_size = edge_size;
+    header.vertex_edge_size = vertex_edge_size;
+    header.weight_size = weight_size;
+    header.weight_type = weight_type;
+
+    std::int64_t offset = align_snapshot_offset(sizeof(snapshot_header));
+    header.degrees_offset = offset;
+    offset = align_snapshot_offset(offset + vertex_count * vertex_size);
+
+    header.offsets_offset = offset;
+    offset = align_snapshot_offset(offset + (vertex_count + 1) * edge_size);
+
+    header.neighbors_offset = offset;
+    offset = align_snapshot_offset(offset + neighbor_count * vertex_size);
+
+    if (flags & snapshot_flag_vertex_offsets) {
+        header.vertex_offsets_offset = offset;
+        offset = align_snapshot_offset(offset + (vertex_count + 1) * vertex_edge_size);
+    }
+
+    if (flags & snapshot_flag_weighted) {
+        header.weights_offset = offset;
+        offset = align_snapshot_offset(offset + neighbor_count * weight_size);
+    }
+
+    header.file_size = offset;
+    return header;
+}
+
+} // namespace oneapi::dal::preview::graph_snapshot::detail
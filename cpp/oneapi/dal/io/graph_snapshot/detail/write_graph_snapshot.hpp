@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <vector>
+
+#include "oneapi/dal/io/graph_snapshot/detail/read_graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot::detail {
+
+inline void write_section(std::ofstream& stream,
+                          std::int64_t& position,
+                          std::int64_t offset,
+                          const void* data,
+                          std::int64_t size) {
+    static const std::vector<char> padding(snapshot_alignment, 0);
+    ONEDAL_ASSERT(offset >= position);
+    ONEDAL_ASSERT(offset - position <= snapshot_alignment);
+    stream.write(padding.data(), offset - position);
+    stream.write(reinterpret_cast<const char*>(data), size);
+    position = offset + size;
+}
+
+template <typename Graph>
+void write_graph_snapshot(const Graph& graph, const data_source_base& ds) {
+    using graph_impl_t = typename graph_traits<Graph>::impl_type;
+    using vertex_t = typename graph_impl_t::vertex_type;
+    using edge_t = typename graph_impl_t::edge_type;
+    using vertex_edge_t = typename graph_impl_t::vertex_edge_type;
+    using value_t = typename graph_impl_t::edge_user_value_type;
+
+    const auto& graph_impl = oneapi::dal::detail::get_impl(graph);
+    const auto& topology = graph_impl.get_topology();
+
+    const std::int64_t vertex_count = topology.get_vertex_count();
+    const std::int64_t neighbor_count = vertex_count > 0 ? topology._rows[vertex_count] : 0;
+    const bool has_vertex_offsets = topology._rows_vertex.get_count() == vertex_count + 1;
+    const bool is_weighted = get_weight_size<Graph>() > 0;
+
+    std::uint32_t flags = 0;
+    if (is_directed<Graph>) {
+        flags |= snapshot_flag_directed;
+    }
+    if (is_weighted) {
+        flags |= snapshot_flag_weighted;
+    }
+    if (has_vertex_offsets) {
+        flags |= snapshot_flag_vertex_offsets;
+    }
+
+    const auto header = make_snapshot_header(vertex_count,
+                                             topology.get_edge_count(),
+                                             neighbor_count,
+                                             flags,
+                                             sizeof(vertex_t),
+                                             sizeof(edge_t),
+                                             sizeof(vertex_edge_t),
+                                             get_weight_size<Graph>(),
+                                             get_weight_type<Graph>());
+
+    std::ofstream stream(ds.get_file_name(), std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+        throw internal_error(dal::detail::error_messages::file_write_failed());
+    }
+
+    std::int64_t position = 0;
+    write_section(stream, position, 0, &header, sizeof(header));
+    write_section(stream,
+                  position,
+                  header.degrees_offset,
+                  topology._degrees.get_data(),
+                  vertex_count * sizeof(vertex_t));
+    const edge_t empty_offsets = 0;
+    write_section(stream,
+                  position,
+                  header.offsets_offset,
+                  vertex_count > 0 ? topology._rows.get_data() : &empty_offsets,
+                  (vertex_count + 1) * sizeof(edge_t));
+    write_section(stream,
+                  position,
+                  header.neighbors_offset,
+                  topology._cols.get_data(),
+                  neighbor_count * sizeof(vertex_t));
+    if (has_vertex_offsets) {
+        write_section(stream,
+                      position,
+                      header.vertex_offsets_offset,
+                      topology._rows_vertex.get_data(),
+                      (vertex_count + 1) * sizeof(vertex_edge_t));
+    }
+    if constexpr (!std::is_same_v<value_t, empty_value>) {
+        write_section(stream,
+                      position,
+                      header.weights_offset,
+                      graph_impl.get_edge_values().get_data(),
+                      neighbor_count * sizeof(value_t));
+    }
+    write_section(stream, position, header.file_size, nullptr, 0);
+
+    if (!stream.good()) {
+        throw internal_error(dal::detail::error_messages::file_write_failed());
+    }
+}
+
+} // namespace oneapi::dal::preview::graph_snapshot::detail
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/graph_snapshot/common.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot {
+
+struct read_args_tag {};
+
+/// Arguments of the graph snapshot reading. The graph type is defined by the
+/// `Graph` parameter and must match the type the snapshot was written from.
+template <typename Graph>
+class read_args : public base {
+public:
+    using object_t = Graph;
+    using tag_t = read_args_tag;
+
+    read_args() = default;
+
+    /// If `true`, the offsets and the neighbors are checked in a parallel
+    /// pass over the mapped file before the graph is created. The check may be
+    /// disabled for trusted files, then a corrupted file leads to undefined
+    /// behavior in the algorithms.
+    /// @remark default = true
+    bool get_validate_topology() const {
+        return validate_topology_;
+    }
+
+    auto& set_validate_topology(bool value) {
+        validate_topology_ = value;
+        return *this;
+    }
+
+private:
+    bool validate_topology_ = true;
+};
+
+} // namespace oneapi::dal::preview::graph_snapshot
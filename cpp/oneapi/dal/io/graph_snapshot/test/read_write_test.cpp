@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/io/graph_snapshot.hpp"
+#include "oneapi/dal/graph/directed_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
+
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot::test {
+
+class graph_snapshot_test {
+public:
+    using unweighted_graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+    using weighted_graph_t = dal::preview::undirected_adjacency_vector_graph<empty_value, double>;
+    using directed_graph_t = dal::preview::directed_adjacency_vector_graph<empty_value, double>;
+
+    ~graph_snapshot_test() {
+        std::remove(edge_list_file_name.c_str());
+        std::remove(snapshot_file_name.c_str());
+    }
+
+    void write_edge_list(bool is_weighted) {
+        std::ofstream stream(edge_list_file_name);
+        const std::int32_t edges[][2] = { { 0, 1 }, { 0, 3 }, { 1, 2 }, { 2, 4 },
+                                          { 3, 4 }, { 4, 5 }, { 5, 0 } };
+        std::int32_t index = 0;
+        for (const auto& edge : edges) {
+            stream << edge[0] << " " << edge[1];
+            if (is_weighted) {
+                stream << " " << 0.5 * (++index);
+            }
+            stream << "\n";
+        }
+    }
+
+    template <typename Graph>
+    Graph read_edge_list() {
+        constexpr bool is_weighted = !std::is_same_v<edge_user_value_type<Graph>, empty_value>;
+        write_edge_list(is_weighted);
+        if constexpr (is_weighted) {
+            return dal::read<Graph>(dal::csv::data_source{ edge_list_file_name },
+                                    dal::preview::read_mode::weighted_edge_list);
+        }
+        else {
+            return dal::read<Graph>(dal::csv::data_source{ edge_list_file_name });
+        }
+    }
+
+    template <typename Graph>
+    Graph write_and_read(const Graph& graph) {
+        dal::preview::graph_snapshot::write(graph, data_source{ snapshot_file_name });
+        return dal::read<Graph>(data_source{ snapshot_file_name });
+    }
+
+    template <typename Graph>
+    void check_graphs_are_equal(const Graph& expected, const Graph& actual) {
+        const auto& expected_impl = dal::detail::get_impl(expected);
+        const auto& actual_impl = dal::detail::get_impl(actual);
+        const auto& expected_topology = expected_impl.get_topology();
+        const auto& actual_topology = actual_impl.get_topology();
+
+        const std::int64_t vertex_count = get_vertex_count(expected);
+        REQUIRE(get_vertex_count(actual) == vertex_count);
+        REQUIRE(get_edge_count(actual) == get_edge_count(expected));
+        REQUIRE(actual_topology._rows_vertex.get_count() ==
+                expected_topology._rows_vertex.get_count());
+
+        for (std::int64_t u = 0; u < vertex_count; ++u) {
+            REQUIRE(actual_topology._degrees[u] == expected_topology._degrees[u]);
+            REQUIRE(actual_topology._rows[u + 1] == expected_topology._rows[u + 1]);
+        }
+        for (std::int64_t i = 0; i < expected_topology._rows[vertex_count]; ++i) {
+            REQUIRE(actual_topology._cols[i] == expected_topology._cols[i]);
+        }
+        for (std::int64_t i = 0; i < expected_topology._rows_vertex.get_count(); ++i) {
+            REQUIRE(actual_topology._rows_vertex[i] == expected_topology._rows_vertex[i]);
+        }
+
+        if constexpr (!std::is_same_v<edge_user_value_type<Graph>, empty_value>) {
+            const auto expected_values = expected_impl.get_edge_values();
+            const auto actual_values = actual_impl.get_edge_values();
+            for (std::int64_t i = 0; i < expected_topology._rows[vertex_count]; ++i) {
+                REQUIRE(actual_values[i] == expected_values[i]);
+            }
+        }
+    }
+
+    template <typename Graph>
+    void check_round_trip() {
+        const auto graph = read_edge_list<Graph>();
+        const auto snapshot_graph = write_and_read(graph);
+        check_graphs_are_equal(graph, snapshot_graph);
+    }
+
+    void write_file(const std::string& content) {
+        std::ofstream stream(snapshot_file_name, std::ios::binary);
+        stream << content;
+    }
+
+    detail::snapshot_header read_header() {
+        detail::snapshot_header header = {};
+        std::ifstream stream(snapshot_file_name, std::ios::binary);
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        REQUIRE(stream.good());
+        return header;
+    }
+
+    template <typename T>
+    void overwrite_value(std::int64_t offset, const T& value) {
+        std::fstream stream(snapshot_file_name, std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(offset);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        REQUIRE(stream.good());
+    }
+
+    const std::string edge_list_file_name = "graph_snapshot_test_edge_list.csv";
+    const std::string snapshot_file_name = "graph_snapshot_test.bin";
+};
+
+#define GRAPH_SNAPSHOT_TEST(name) TEST_M(graph_snapshot_test, name, "[graph_snapshot]")
+
+GRAPH_SNAPSHOT_TEST("Unweighted undirected graph round trip") {
+    check_round_trip<unweighted_graph_t>();
+}
+
+GRAPH_SNAPSHOT_TEST("Weighted undirected graph round trip") {
+    check_round_trip<weighted_graph_t>();
+}
+
+GRAPH_SNAPSHOT_TEST("Weighted directed graph round trip") {
+    check_round_trip<directed_graph_t>();
+}
+
+GRAPH_SNAPSHOT_TEST("Snapshot graph outlives the data source") {
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    const auto snapshot_graph = write_and_read(graph);
+    std::remove(snapshot_file_name.c_str());
+    check_graphs_are_equal(graph, snapshot_graph);
+}
+
+GRAPH_SNAPSHOT_TEST("Snapshot graph refers to the mapped file") {
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    const auto snapshot_graph = write_and_read(graph);
+    const auto header = read_header();
+    const auto& topology = dal::detail::get_impl(snapshot_graph).get_topology();
+
+    // All arrays must lie at their offsets from the beginning of one mapping
+    const auto base = reinterpret_cast<const byte_t*>(topology._degrees.get_data()) -
+                      header.degrees_offset;
+    REQUIRE(reinterpret_cast<std::uintptr_t>(base) % detail::snapshot_alignment == 0);
+    REQUIRE(reinterpret_cast<const byte_t*>(topology._rows.get_data()) ==
+            base + header.offsets_offset);
+    REQUIRE(reinterpret_cast<const byte_t*>(topology._cols.get_data()) ==
+            base + header.neighbors_offset);
+}
+
+GRAPH_SNAPSHOT_TEST("Snapshot with invalid topology is rejected") {
+    using vertex_t = vertex_type<unweighted_graph_t>;
+    using edge_t = typename graph_traits<unweighted_graph_t>::impl_type::edge_type;
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    write(graph, data_source{ snapshot_file_name });
+    const auto header = read_header();
+
+    SECTION("neighbor is out of range") {
+        overwrite_value(header.neighbors_offset + sizeof(vertex_t),
+                        static_cast<vertex_t>(header.vertex_count));
+    }
+    SECTION("offsets are decreasing") {
+        overwrite_value(header.offsets_offset + 2 * sizeof(edge_t), edge_t(0));
+    }
+    SECTION("offsets do not match degrees") {
+        overwrite_value(header.degrees_offset, vertex_t(1));
+    }
+
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+
+    // The check can be skipped for trusted files
+    const auto args = read_args<unweighted_graph_t>{}.set_validate_topology(false);
+    REQUIRE_NOTHROW(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }, args));
+}
+
+GRAPH_SNAPSHOT_TEST("Snapshot with another size of offsets is rejected") {
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    write(graph, data_source{ snapshot_file_name });
+    auto header = read_header();
+    header.edge_size = sizeof(std::int32_t);
+    overwrite_value(0, header);
+
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+}
+
+GRAPH_SNAPSHOT_TEST("Snapshot of another graph type is rejected") {
+    const auto graph = read_edge_list<weighted_graph_t>();
+    write(graph, data_source{ snapshot_file_name });
+
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+    REQUIRE_THROWS_AS(dal::read<directed_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+}
+
+GRAPH_SNAPSHOT_TEST("Invalid snapshot file is rejected") {
+    write_file("0 1\n1 2\n");
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    write(graph, data_source{ snapshot_file_name });
+    std::string content;
+    {
+        std::ifstream stream(snapshot_file_name, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+    write_file(content.substr(0, content.size() / 2));
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ snapshot_file_name }),
+                      invalid_argument);
+}
+
+GRAPH_SNAPSHOT_TEST("Missing snapshot file is rejected") {
+    REQUIRE_THROWS_AS(dal::read<unweighted_graph_t>(data_source{ "missing_snapshot.bin" }),
+                      invalid_argument);
+}
+
+GRAPH_SNAPSHOT_TEST("Failure to create snapshot file is reported") {
+    const auto graph = read_edge_list<unweighted_graph_t>();
+    REQUIRE_THROWS_AS(write(graph, data_source{ "missing_directory/snapshot.bin" }),
+                      internal_error);
+}
+
+} // namespace oneapi::dal::preview::graph_snapshot::test
@@ -0,0 +1,36 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/graph_snapshot/common.hpp"
+#include "oneapi/dal/io/graph_snapshot/detail/write_graph_snapshot.hpp"
+
+namespace oneapi::dal::preview::graph_snapshot {
+
+/// Writes the graph in the binary snapshot format that can be read back
+/// with `dal::read<Graph>(graph_snapshot::data_source{ file_name })`
+///
+/// @tparam Graph Type of the graph
+///
+/// @param[in] graph The graph to write
+/// @param[in] ds    The data source that points to the snapshot file
+template <typename Graph>
+void write(const Graph& graph, const data_source& ds) {
+    detail::write_graph_snapshot(graph, ds);
+}
+
+} // namespace oneapi::dal::preview::graph_snapshot
@@ -17,6 +17,7 @@
 #include "oneapi/dal/table/backend/convert.hpp"
 
 #include <algorithm>
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/transfer.hpp"
 #include "oneapi/dal/backend/interop/data_conversion.hpp"
@@ -83,6 +84,119 @@ void convert_vector(const detail::default_host_policy& policy,
     }
 }
 
+/// The side of the square tile in elements used for transposition, so the
+/// source and destination tiles of the widest type fit into L1 cache together
+constexpr std::int64_t transpose_tile_size = 32;
+
+/// The number of elements in the tile used if the source and destination
+/// have the same layout, so the rows are converted by contiguous chunks
+constexpr std::int64_t copy_tile_element_count = 4096;
+
+/// The matrices with fewer elements are converted in the calling thread,
+/// as the threading overhead exceeds the conversion time
+constexpr std::int64_t min_parallel_element_count = 65536;
+
+template <typename T>
+constexpr bool is_tiled_conversion_type_v = std::is_same_v<T, float> ||
+                                            std::is_same_v<T, double> ||
+                                            std::is_same_v<T, std::int32_t>;
+
+template <typename Src, typename Dst>
+static void convert_tile(const Src* src,
+                         Dst* dst,
+                         std::int64_t src_row_stride,
+                         std::int64_t dst_row_stride,
+                         std::int64_t src_col_stride,
+                         std::int64_t dst_col_stride,
+                         std::int64_t row_count,
+                         std::int64_t col_count) {
+    // The inner loop goes along the contiguous dimension of the destination,
+    // so the stores are vectorized and the strided loads hit the cached tile
+    if (dst_row_stride == 1 && (dst_col_stride != 1 || col_count == 1)) {
+        for (std::int64_t j = 0; j < col_count; j++) {
+            const Src* src_col = src + j * src_col_stride;
+            Dst* dst_col = dst + j * dst_col_stride;
+            PRAGMA_IVDEP
+            for (std::int64_t i = 0; i < row_count; i++) {
+                dst_col[i] = static_cast<Dst>(src_col[i * src_row_stride]);
+            }
+        }
+    }
+    else {
+        for (std::int64_t i = 0; i < row_count; i++) {
+            const Src* src_row = src + i * src_row_stride;
+            Dst* dst_row = dst + i * dst_row_stride;
+            PRAGMA_IVDEP
+            for (std::int64_t j = 0; j < col_count; j++) {
+                dst_row[j * dst_col_stride] = static_cast<Dst>(src_row[j * src_col_stride]);
+            }
+        }
+    }
+}
+
+template <typename Src, typename Dst>
+static void convert_matrix_tiled(const Src* src,
+                                 Dst* dst,
+                                 std::int64_t src_row_stride,
+                                 std::int64_t dst_row_stride,
+                                 std::int64_t src_col_stride,
+                                 std::int64_t dst_col_stride,
+                                 std::int64_t row_count,
+                                 std::int64_t col_count) {
+    // Treat the matrices that are contiguous along rows as transposed ones,
+    // so the contiguous dimension is always the column one
+    if (src_row_stride == 1 && dst_row_stride == 1) {
+        std::swap(src_row_stride, src_col_stride);
+        std::swap(dst_row_stride, dst_col_stride);
+        std::swap(row_count, col_count);
+    }
+
+    // Dense matrices of the same layout are converted as a single row,
+    // so the tiles are of the same size regardless of the matrix shape
+    const bool same_dense_layout = (src_col_stride == 1 && dst_col_stride == 1 &&
+                                    src_row_stride == col_count && dst_row_stride == col_count);
+    if (same_dense_layout) {
+        col_count *= row_count;
+        row_count = 1;
+    }
+
+    std::int64_t tile_row_count = transpose_tile_size;
+    std::int64_t tile_col_count = transpose_tile_size;
+    if (src_col_stride == 1 && dst_col_stride == 1) {
+        tile_col_count = std::min(col_count, copy_tile_element_count);
+        tile_row_count = copy_tile_element_count / tile_col_count;
+    }
+
+    const std::int64_t row_tile_count = (row_count + tile_row_count - 1) / tile_row_count;
+    const std::int64_t col_tile_count = (col_count + tile_col_count - 1) / tile_col_count;
+    const std::int64_t tile_count = row_tile_count * col_tile_count;
+
+    const auto convert_tile_by_index = [&](std::int64_t tile_index) {
+        const std::int64_t row_start = (tile_index / col_tile_count) * tile_row_count;
+        const std::int64_t col_start = (tile_index % col_tile_count) * tile_col_count;
+        convert_tile(src + row_start * src_row_stride + col_start * src_col_stride,
+                     dst + row_start * dst_row_stride + col_start * dst_col_stride,
+                     src_row_stride,
+                     dst_row_stride,
+                     src_col_stride,
+                     dst_col_stride,
+                     std::min(tile_row_count, row_count - row_start),
+                     std::min(tile_col_count, col_count - col_start));
+    };
+
+    if (tile_count > 1 && row_count * col_count >= min_parallel_element_count) {
+        const auto tile_count_int32 = dal::detail::integral_cast<std::int32_t>(tile_count);
+        dal::detail::threader_for(tile_count_int32, tile_count_int32, [&](std::int32_t i) {
+            convert_tile_by_index(i);
+        });
+    }
+    else {
+        for (std::int64_t i = 0; i < tile_count; i++) {
+            convert_tile_by_index(i);
+        }
+    }
+}
+
 void convert_matrix(const detail::default_host_policy& policy,
                     const void* src,
                     void* dst,
@@ -94,21 +208,48 @@ void convert_matrix(const detail::default_host_policy& policy,
                     const std::int64_t dst_col_stride,
                     const std::int64_t dst_row_count,
                     const std::int64_t dst_col_count) {
+    if (dst_row_count == 0 || dst_col_count == 0) {
+        return;
+    }
+
     dispatch_by_data_type(src_type, [&](auto src_type_id) {
         dispatch_by_data_type(dst_type, [&](auto dst_type_id) {
             using src_t = decltype(src_type_id);
             using dst_t = decltype(dst_type_id);
             auto src_ptr = static_cast<const src_t*>(src);
             auto dst_ptr = static_cast<dst_t*>(dst);
-            for (std::int64_t i = 0; i < dst_row_count; i++) {
+
+            if constexpr (is_tiled_conversion_type_v<src_t> &&
+                          is_tiled_conversion_type_v<dst_t>) {
+                convert_matrix_tiled(src_ptr,
+                                     dst_ptr,
+                                     src_row_stride,
+                                     dst_row_stride,
+                                     src_col_stride,
+                                     dst_col_stride,
+                                     dst_row_count,
+                                     dst_col_count);
+            }
+            else if (src_col_stride == 1 && dst_col_stride == 1 &&
+                     src_row_stride == dst_col_count && dst_row_stride == dst_col_count) {
                 backend::convert_vector(policy,
-                                        src_ptr + i * src_row_stride,
-                                        dst_ptr + i * dst_row_stride,
+                                        src_ptr,
+                                        dst_ptr,
                                         src_type,
                                         dst_type,
-                                        src_col_stride,
-                                        dst_col_stride,
-                                        dst_col_count);
+                                        dst_row_count * dst_col_count);
+            }
+            else {
+                for (std::int64_t i = 0; i < dst_row_count; i++) {
+                    backend::convert_vector(policy,
+                                            src_ptr + i * src_row_stride,
+                                            dst_ptr + i * dst_row_stride,
+                                            src_type,
+                                            dst_type,
+                                            src_col_stride,
+                                            dst_col_stride,
+                                            dst_col_count);
+                }
             }
         });
     });
@@ -377,16 +518,17 @@ sycl::event convert_matrix_host2device(sycl::queue& q,
         dal::detail::check_mul_overflow(element_size_in_bytes, dst_count);
 
     const auto tmp_host_unique = make_unique_usm_host<Dst>(q, dst_count);
-    for (std::int64_t i = 0; i < dst_row_count; i++) {
-        backend::convert_vector(detail::default_host_policy{},
-                                src_host + i * src_row_stride,
-                                tmp_host_unique.get() + i * dst_row_stride,
-                                src_type,
-                                dst_type,
-                                src_col_stride,
-                                dst_col_stride,
-                                dst_col_count);
-    }
+    convert_matrix(detail::default_host_policy{},
+                   src_host,
+                   tmp_host_unique.get(),
+                   src_type,
+                   dst_type,
+                   src_row_stride,
+                   dst_row_stride,
+                   src_col_stride,
+                   dst_col_stride,
+                   dst_row_count,
+                   dst_col_count);
     auto copy_event = memcpy(q, dst_device, tmp_host_unique.get(), dst_size_in_bytes);
     return copy_event;
 }
@@ -402,6 +544,10 @@ void convert_matrix(const detail::data_parallel_policy& policy,
                     const std::int64_t dst_col_stride,
                     const std::int64_t dst_row_count,
                     const std::int64_t dst_col_count) {
+    if (dst_row_count == 0 || dst_col_count == 0) {
+        return;
+    }
+
     dispatch_by_data_type(src_type, [&](auto src_type_id) {
         dispatch_by_data_type(dst_type, [&](auto dst_type_id) {
             using src_t = decltype(src_type_id);
@@ -411,7 +557,33 @@ void convert_matrix(const detail::data_parallel_policy& policy,
             sycl::queue& q = policy.get_queue();
             const bool src_device_friendly = is_device_friendly_usm(q, src_ptr);
             const bool dst_device_friendly = is_device_friendly_usm(q, dst_ptr);
-            if (dst_device_friendly && !src_device_friendly) {
+            // The temporary host buffer is copied to device as a whole,
+            // so only the dense destination can be filled this way
+            const bool dst_dense = (dst_col_stride == 1 && dst_row_stride == dst_col_count);
+            const bool same_dense_layout = dst_dense && src_col_stride == 1 &&
+                                           src_row_stride == dst_col_count;
+            if (!src_device_friendly && !dst_device_friendly) {
+                convert_matrix(detail::default_host_policy{},
+                               src_ptr,
+                               dst_ptr,
+                               src_type,
+                               dst_type,
+                               src_row_stride,
+                               dst_row_stride,
+                               src_col_stride,
+                               dst_col_stride,
+                               dst_row_count,
+                               dst_col_count);
+            }
+            else if (same_dense_layout) {
+                backend::convert_vector(policy,
+                                        src_ptr,
+                                        dst_ptr,
+                                        src_type,
+                                        dst_type,
+                                        dst_row_count * dst_col_count);
+            }
+            else if (dst_device_friendly && !src_device_friendly && dst_dense) {
                 convert_matrix_host2device<src_t, dst_t>(q,
                                                          src_ptr,
                                                          dst_ptr,
@@ -131,33 +131,17 @@ static void pull_row_major_impl(const Policy& policy,
         auto src_data = origin_data.get_data() + origin_offset * origin_dtype_size;
         auto dst_data = block_data.get_mutable_data();
 
-        if (block_info.get_column_count() > 1) {
-            const std::int64_t subblocks_count =
-                contiguous_block_requested ? 1 : block_info.get_row_count();
-            const std::int64_t subblock_size = contiguous_block_requested
-                                                   ? block_info.get_element_count()
-                                                   : block_info.get_column_count();
-
-            for (std::int64_t i = 0; i < subblocks_count; i++) {
-                backend::convert_vector(
-                    policy,
-                    src_data + i * origin_info.get_column_count() * origin_dtype_size,
-                    dst_data + i * block_info.get_column_count(),
-                    origin_info.get_data_type(),
-                    block_dtype,
-                    subblock_size);
-            }
-        }
-        else {
-            backend::convert_vector(policy,
-                                    src_data,
-                                    dst_data,
-                                    origin_info.get_data_type(),
-                                    block_dtype,
-                                    origin_info.get_column_count(),
-                                    1,
-                                    block_info.get_element_count());
-        }
+        backend::convert_matrix(policy,
+                                src_data,
+                                dst_data,
+                                origin_info.get_data_type(),
+                                block_dtype,
+                                origin_info.get_column_count(),
+                                block_info.get_column_count(),
+                                1,
+                                1,
+                                block_info.get_row_count(),
+                                block_info.get_column_count());
     }
 }
 
@@ -250,33 +234,17 @@ static void push_row_major_impl(const Policy& policy,
         auto src_data = block_data.get_data();
         auto dst_data = origin_data.get_mutable_data() + origin_offset * origin_dtype_size;
 
-        if (block_info.get_column_count() > 1) {
-            const std::int64_t blocks_count =
-                contiguous_block_requested ? 1 : block_info.get_row_count();
-            const std::int64_t block_size = contiguous_block_requested
-                                                ? block_info.get_element_count()
-                                                : block_info.get_column_count();
-
-            for (std::int64_t block_idx = 0; block_idx < blocks_count; block_idx++) {
-                backend::convert_vector(
-                    policy,
-                    src_data + block_idx * block_info.get_column_count(),
-                    dst_data + block_idx * origin_info.get_column_count() * origin_dtype_size,
-                    block_dtype,
-                    origin_info.get_data_type(),
-                    block_size);
-            }
-        }
-        else {
-            backend::convert_vector(policy,
-                                    src_data,
-                                    dst_data,
-                                    block_dtype,
-                                    origin_info.get_data_type(),
-                                    1,
-                                    origin_info.get_column_count(),
-                                    block_info.get_element_count());
-        }
+        backend::convert_matrix(policy,
+                                src_data,
+                                dst_data,
+                                block_dtype,
+                                origin_info.get_data_type(),
+                                block_info.get_column_count(),
+                                origin_info.get_column_count(),
+                                1,
+                                1,
+                                block_info.get_row_count(),
+                                block_info.get_column_count());
     }
 }
 
@@ -307,16 +275,17 @@ static void push_column_major_impl(const Policy& policy,
     auto src_data = block_data.get_data();
     auto dst_data = origin_data.get_mutable_data() + origin_offset * origin_dtype_size;
 
-    for (std::int64_t row_idx = 0; row_idx < block_info.get_row_count(); row_idx++) {
-        backend::convert_vector(policy,
-                                src_data + row_idx * block_info.get_column_count(),
-                                dst_data + row_idx * origin_dtype_size,
-                                block_dtype,
-                                origin_info.get_data_type(),
-                                1,
-                                origin_info.get_row_count(),
-                                block_info.get_column_count());
-    }
+    backend::convert_matrix(policy,
+                            src_data,
+                            dst_data,
+                            block_dtype,
+                            origin_info.get_data_type(),
+                            block_info.get_column_count(),
+                            1,
+                            1,
+                            origin_info.get_row_count(),
+                            block_info.get_row_count(),
+                            block_info.get_column_count());
 }
 
 /// The function tries to select correct policy for pull/push implementation
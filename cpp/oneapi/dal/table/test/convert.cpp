@@ -18,6 +18,7 @@
 //       Test for conversion should be moved to dal/table/backend
 
 #include <array>
+#include <vector>
 
 #include "oneapi/dal/test/engine/common.hpp"
 #include "oneapi/dal/test/engine/linalg.hpp"
@@ -206,6 +207,88 @@ TEST_M(convert_test, "convert types of the different sizes host2host", "[host2ho
     }
 }
 
+template <typename TestType>
+class convert_matrix_test : public te::policy_fixture {
+public:
+    using src_t = std::tuple_element_t<0, TestType>;
+    using dst_t = std::tuple_element_t<1, TestType>;
+
+    /// Converts the submatrix of the source padded by `src_padding` elements
+    /// to the dense destination and compares the result to the direct conversion
+    void test_host_conversion(std::int64_t row_count,
+                              std::int64_t col_count,
+                              bool src_row_major,
+                              bool dst_row_major,
+                              std::int64_t src_padding) {
+        const std::int64_t src_leading_dim = (src_row_major ? col_count : row_count) + src_padding;
+        const std::int64_t src_row_stride = src_row_major ? src_leading_dim : 1;
+        const std::int64_t src_col_stride = src_row_major ? 1 : src_leading_dim;
+        const std::int64_t dst_row_stride = dst_row_major ? col_count : 1;
+        const std::int64_t dst_col_stride = dst_row_major ? 1 : row_count;
+
+        const std::int64_t src_outer_dim = src_row_major ? row_count : col_count;
+        std::vector<src_t> src(src_leading_dim * src_outer_dim, src_t(0));
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < col_count; j++) {
+                src[i * src_row_stride + j * src_col_stride] = get_value(i, j);
+            }
+        }
+
+        std::vector<dst_t> dst(row_count * col_count, dst_t(0));
+        convert_matrix(dal::detail::default_host_policy{},
+                       src.data(),
+                       dst.data(),
+                       dal::detail::make_data_type<src_t>(),
+                       dal::detail::make_data_type<dst_t>(),
+                       src_row_stride,
+                       dst_row_stride,
+                       src_col_stride,
+                       dst_col_stride,
+                       row_count,
+                       col_count);
+
+        for (std::int64_t i = 0; i < row_count; i++) {
+            for (std::int64_t j = 0; j < col_count; j++) {
+                REQUIRE(dst[i * dst_row_stride + j * dst_col_stride] == dst_t(get_value(i, j)));
+            }
+        }
+    }
+
+private:
+    static src_t get_value(std::int64_t i, std::int64_t j) {
+        return src_t((i * 7 + j * 13) % 1001) / src_t(4) - src_t(100);
+    }
+};
+
+using convert_matrix_types = std::tuple<std::tuple<float, float>,
+                                        std::tuple<float, double>,
+                                        std::tuple<double, float>,
+                                        std::tuple<double, std::int32_t>,
+                                        std::tuple<std::int32_t, double>,
+                                        std::tuple<std::int64_t, double>,
+                                        std::tuple<float, std::int64_t>>;
+
+TEMPLATE_LIST_TEST_M(convert_matrix_test,
+                     "host convert_matrix preserves values for any layouts",
+                     "[host2host][convert_matrix]",
+                     convert_matrix_types) {
+    // The large shape is not multiple of the tile size and is converted in parallel
+    const auto [row_count, col_count] = GENERATE(std::make_tuple(std::int64_t(1), 5),
+                                                 std::make_tuple(std::int64_t(7), 1),
+                                                 std::make_tuple(std::int64_t(37), 45),
+                                                 std::make_tuple(std::int64_t(301), 257));
+    const bool src_row_major = GENERATE(true, false);
+    const bool dst_row_major = GENERATE(true, false);
+    const std::int64_t src_padding = GENERATE(0, 3);
+    CAPTURE(row_count, col_count, src_row_major, dst_row_major, src_padding);
+
+    this->test_host_conversion(row_count,
+                               col_count,
+                               src_row_major,
+                               dst_row_major,
+                               src_padding);
+}
+
 // device -> device tests
 #ifdef ONEDAL_DATA_PARALLEL
 TEST_M(convert_test, "device2device convert identical types", "[device2device]") {
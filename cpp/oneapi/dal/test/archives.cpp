@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
 #include "oneapi/dal/array.hpp"
 #include "oneapi/dal/detail/array_utils.hpp"
 #include "oneapi/dal/detail/archives.hpp"
@@ -142,4 +146,239 @@ TEST("binary_input_archive throws if truncated data buffer is provided", "[binar
     REQUIRE(input_archive.is_valid() == false);
 }
 
+class file_archive_test {
+public:
+    template <typename T>
+    array<T> get_array(std::int64_t count) const {
+        const auto values = array<T>::empty(count);
+        for (std::int64_t i = 0; i < count; i++) {
+            values.get_mutable_data()[i] = T(i);
+        }
+        return values;
+    }
+
+    array<byte_t> read_file() const {
+        std::ifstream stream(file_name, std::ios::binary | std::ios::ate);
+        const std::int64_t size = stream.tellg();
+        auto content = array<byte_t>::empty(size);
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(content.get_mutable_data()), size);
+        return content;
+    }
+
+    void write_file(const byte_t* data, std::int64_t size) const {
+        std::ofstream stream(file_name, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(data), size);
+    }
+
+    const te::temp_file file{ "file_archive_test" };
+    const std::string& file_name = file.get_path();
+};
+
+TEST_M(file_archive_test, "can serialize arrays to file archives", "[file_archive]") {
+    // The small buffer makes the large arrays bypass it
+    const std::int64_t buffer_size = GENERATE(16, detail::file_archive_buffer_size);
+    const std::int64_t count = GENERATE(3, 1000);
+    CAPTURE(buffer_size, count);
+
+    const auto first = this->get_array<float>(count);
+    const auto second = this->get_array<std::int32_t>(count / 2);
+
+    INFO("serialize");
+    {
+        detail::file_output_archive output_archive{ this->file_name, buffer_size };
+        detail::serialize(first, output_archive);
+        detail::serialize(second, output_archive);
+        REQUIRE(output_archive.is_valid() == true);
+    }
+
+    INFO("deserialize");
+    array<float> deserialized_first;
+    array<std::int32_t> deserialized_second;
+    detail::file_input_archive input_archive{ this->file_name, buffer_size };
+    detail::deserialize(deserialized_first, input_archive);
+    detail::deserialize(deserialized_second, input_archive);
+    REQUIRE(input_archive.is_valid() == true);
+
+    REQUIRE(deserialized_first.get_count() == first.get_count());
+    for (std::int64_t i = 0; i < first.get_count(); i++) {
+        REQUIRE(deserialized_first[i] == first[i]);
+    }
+    REQUIRE(deserialized_second.get_count() == second.get_count());
+    for (std::int64_t i = 0; i < second.get_count(); i++) {
+        REQUIRE(deserialized_second[i] == second[i]);
+    }
+}
+
+TEST_M(file_archive_test,
+       "file archives are compatible with binary archives",
+       "[file_archive][binary_input_archive]") {
+    const auto original = this->get_array<double>(100);
+
+    INFO("file archive to binary archive");
+    {
+        detail::file_output_archive output_archive{ this->file_name, 64 };
+        detail::serialize(original, output_archive);
+        REQUIRE(output_archive.get_size() == this->read_file().get_count());
+    }
+    array<double> from_file;
+    detail::binary_input_archive binary_input{ this->read_file() };
+    detail::deserialize(from_file, binary_input);
+    REQUIRE(from_file.get_count() == original.get_count());
+    REQUIRE(from_file[99] == original[99]);
+
+    INFO("binary archive to file archive");
+    detail::binary_output_archive binary_output;
+    detail::serialize(original, binary_output);
+    const auto content = binary_output.to_array();
+    this->write_file(content.get_data(), content.get_count());
+
+    array<double> from_binary;
+    detail::file_input_archive input_archive{ this->file_name, 64 };
+    detail::deserialize(from_binary, input_archive);
+    REQUIRE(from_binary.get_count() == original.get_count());
+    REQUIRE(from_binary[99] == original[99]);
+}
+
+TEST_M(file_archive_test, "file_input_archive throws if file is truncated", "[file_archive]") {
+    const std::int64_t buffer_size = GENERATE(16, detail::file_archive_buffer_size);
+    CAPTURE(buffer_size);
+
+    detail::binary_output_archive binary_output;
+    detail::serialize(this->get_array<float>(100), binary_output);
+    const auto content = binary_output.to_array();
+    this->write_file(content.get_data(), content.get_count() / 2);
+
+    array<float> deserialized;
+    detail::file_input_archive input_archive{ this->file_name, buffer_size };
+    REQUIRE_THROWS_AS(detail::deserialize(deserialized, input_archive), invalid_argument);
+    REQUIRE(input_archive.is_valid() == false);
+}
+
+TEST("file_input_archive throws if file does not exist", "[file_archive]") {
+    REQUIRE_THROWS_AS(detail::file_input_archive{ "file_archive_test_missing.bin" },
+                      invalid_argument);
+}
+
+TEST_M(file_archive_test,
+       "file_output_archive throws if file cannot be created",
+       "[file_archive]") {
+    const auto missing_directory = std::filesystem::path{ this->file_name }.replace_extension();
+    const auto file_name = (missing_directory / "file_archive_test.bin").string();
+    REQUIRE_THROWS_AS(detail::file_output_archive{ file_name }, internal_error);
+}
+
+TEST_M(file_archive_test,
+       "deserialized arrays alias the content of mapped_file_input_archive",
+       "[mapped_file_input_archive]") {
+    const auto original = this->get_array<double>(100);
+    const auto misaligned = this->get_array<byte_t>(3);
+
+    INFO("serialize");
+    {
+        detail::file_output_archive output_archive{ this->file_name };
+        detail::serialize(original, output_archive);
+        detail::serialize(misaligned, output_archive);
+        detail::serialize(original, output_archive);
+    }
+
+    INFO("deserialize");
+    array<double> aligned_view;
+    array<byte_t> deserialized_misaligned;
+    array<double> misaligned_copy;
+    {
+        detail::mapped_file_input_archive input_archive{ this->file_name };
+        detail::deserialize(aligned_view, input_archive);
+        detail::deserialize(deserialized_misaligned, input_archive);
+        detail::deserialize(misaligned_copy, input_archive);
+        REQUIRE(input_archive.is_valid() == true);
+    }
+
+    // The first array starts at the aligned offset of the file, so it is
+    // not copied, while the third one is shifted by the byte array
+    REQUIRE(aligned_view.has_mutable_data() == false);
+    REQUIRE(misaligned_copy.has_mutable_data() == true);
+
+    // The arrays keep the file mapped after the archive is destroyed
+    for (std::int64_t i = 0; i < original.get_count(); i++) {
+        REQUIRE(aligned_view[i] == original[i]);
+        REQUIRE(misaligned_copy[i] == original[i]);
+    }
+    REQUIRE(deserialized_misaligned.get_count() == misaligned.get_count());
+    REQUIRE(deserialized_misaligned[2] == misaligned[2]);
+}
+
+template <typename T>
+void append_bytes(std::vector<byte_t>& content, const T& value) {
+    const auto bytes = reinterpret_cast<const byte_t*>(&value);
+    content.insert(content.end(), bytes, bytes + sizeof(T));
+}
+
+/// Builds the archive of the float array in the layout written by the released
+/// versions: the magic number, the serialization id of the array, its data type
+/// and size in bytes, followed by the payload. The layout must stay readable
+std::vector<byte_t> make_released_array_archive(const std::vector<float>& values) {
+    constexpr std::uint64_t array_serialization_id = 1000000000;
+    const std::int64_t size_in_bytes = values.size() * sizeof(float);
+
+    std::vector<byte_t> content;
+    append_bytes(content, detail::v1::binary_archive_magic);
+    append_bytes(content, array_serialization_id);
+    append_bytes(content, std::underlying_type_t<data_type>(data_type::float32));
+    append_bytes(content, size_in_bytes);
+    for (const float value : values) {
+        append_bytes(content, value);
+    }
+    return content;
+}
+
+TEST("binary_input_archive reads archives of released format", "[binary_input_archive]") {
+    const std::vector<float> values = { 0.5f, -1.25f, 3.0f };
+    const auto content = make_released_array_archive(values);
+
+    array<float> deserialized;
+    detail::binary_input_archive input_archive{ content.data(), std::int64_t(content.size()) };
+    detail::deserialize(deserialized, input_archive);
+    REQUIRE(input_archive.is_valid() == true);
+
+    REQUIRE(deserialized.get_count() == std::int64_t(values.size()));
+    for (std::size_t i = 0; i < values.size(); i++) {
+        REQUIRE(deserialized[i] == values[i]);
+    }
+}
+
+TEST_M(file_archive_test,
+       "mapped_file_input_archive reads archives of released format",
+       "[mapped_file_input_archive]") {
+    const std::vector<float> values = { 0.5f, -1.25f, 3.0f };
+    const auto content = make_released_array_archive(values);
+    this->write_file(content.data(), content.size());
+
+    array<float> deserialized;
+    {
+        detail::mapped_file_input_archive input_archive{ this->file_name };
+        detail::deserialize(deserialized, input_archive);
+        REQUIRE(input_archive.is_valid() == true);
+    }
+
+    REQUIRE(deserialized.get_count() == std::int64_t(values.size()));
+    for (std::size_t i = 0; i < values.size(); i++) {
+        REQUIRE(deserialized[i] == values[i]);
+    }
+}
+
+TEST_M(file_archive_test,
+       "mapped_file_input_archive throws if file is truncated",
+       "[mapped_file_input_archive]") {
+    detail::binary_output_archive binary_output;
+    detail::serialize(this->get_array<float>(100), binary_output);
+    const auto content = binary_output.to_array();
+    this->write_file(content.get_data(), content.get_count() / 2);
+
+    array<float> deserialized;
+    detail::mapped_file_input_archive input_archive{ this->file_name };
+    REQUIRE_THROWS_AS(detail::deserialize(deserialized, input_archive), invalid_argument);
+    REQUIRE(input_archive.is_valid() == false);
+}
+
 } // namespace oneapi::dal::test
@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include "oneapi/dal/array.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/test/engine/common.hpp"
 
 namespace oneapi::dal::test {
@@ -48,6 +50,66 @@ TEST("can_construct_array_of_ones") {
     }
 }
 
+class first_touch_mode_guard {
+public:
+    first_touch_mode_guard() {
+        detail::enable_first_touch_allocation();
+    }
+    ~first_touch_mode_guard() {
+        detail::enable_first_touch_allocation(false);
+    }
+};
+
+// Larger than the minimal size of the block initialized in parallel
+constexpr std::int64_t first_touch_count = 3 * 1024 * 1024 + 7;
+
+// In the first-touch mode calloc skips its serial zero-fill and relies on the
+// parallel fill, unless it is called inside a parallel region. The block is
+// dirtied and released first, so calloc is likely to reuse the same memory
+std::int64_t count_nonzero_after_calloc() {
+    const detail::default_host_policy policy;
+
+    float* dirty = detail::malloc<float>(policy, first_touch_count);
+    detail::memset(policy, dirty, 0xFF, first_touch_count * sizeof(float));
+    detail::free(policy, dirty);
+
+    float* ptr = detail::calloc<float>(policy, first_touch_count);
+    std::int64_t nonzero_count = 0;
+    for (std::int64_t i = 0; i < first_touch_count; i++) {
+        nonzero_count += (ptr[i] != 0.0f);
+    }
+    detail::free(policy, ptr);
+    return nonzero_count;
+}
+
+TEST("can switch first-touch allocation mode") {
+    REQUIRE(!detail::is_first_touch_allocation_enabled());
+    {
+        first_touch_mode_guard guard;
+        REQUIRE(detail::is_first_touch_allocation_enabled());
+    }
+    REQUIRE(!detail::is_first_touch_allocation_enabled());
+}
+
+TEST("calloc zero-fills large blocks in first-touch allocation mode") {
+    first_touch_mode_guard guard;
+    REQUIRE(count_nonzero_after_calloc() == 0);
+}
+
+TEST("calloc zero-fills large blocks inside parallel region in first-touch allocation mode") {
+    first_touch_mode_guard guard;
+
+    constexpr std::int32_t task_count = 2;
+    std::int64_t nonzero_counts[task_count] = { -1, -1 };
+    detail::threader_for(task_count, task_count, [&](std::int32_t i) {
+        nonzero_counts[i] = count_nonzero_after_calloc();
+    });
+
+    for (std::int32_t i = 0; i < task_count; i++) {
+        REQUIRE(nonzero_counts[i] == 0);
+    }
+}
+
 TEST("can_construct_array_from_raw_pointer") {
     constexpr int64_t size = 10;
     auto ptr = new float[size];
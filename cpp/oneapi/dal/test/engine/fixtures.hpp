@@ -160,6 +160,17 @@ class crtp_algo_fixture : public crtp_base_algo_fixture<TestType, Derived> {
 
 public:
     //    using crtp_base_algo_fixture<TestType, Derived>::not_float64_friendly;
+
+    /// Returns `true` if SPMD kernels that run on CPU cannot be reached with the
+    /// test policy. CPU kernels support SPMD mode only with the host policy.
+    bool not_spmd_cpu_friendly() {
+#ifdef ONEDAL_DATA_PARALLEL
+        return this->get_policy().is_cpu();
+#else
+        return false;
+#endif
+    }
+
     template <typename Descriptor, typename... Args>
     auto train_via_spmd_threads(std::int64_t thread_count, const Descriptor& desc, Args&&... args) {
         ONEDAL_ASSERT(thread_count > 0);
@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <cstdio>
+#include <filesystem>
+#include <random>
 #include <vector>
+
+#include "oneapi/dal/detail/archives.hpp"
 #include "oneapi/dal/detail/serialization.hpp"
 
 namespace oneapi::dal::test::engine {
@@ -195,4 +200,49 @@ T serialize_deserialize(const T& original) {
     return deserialized;
 }
 
+/// The file with the unique name in the temporary directory, which is removed
+/// with the object
+class temp_file {
+public:
+    explicit temp_file(const std::string& prefix) {
+        std::random_device device;
+        const std::string name =
+            prefix + "_" + std::to_string(device()) + std::to_string(device()) + ".bin";
+        path_ = (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    ~temp_file() {
+        std::remove(path_.c_str());
+    }
+
+    temp_file(const temp_file&) = delete;
+    temp_file& operator=(const temp_file&) = delete;
+
+    const std::string& get_path() const {
+        return path_;
+    }
+
+private:
+    std::string path_;
+};
+
+/// Serializes the object to the file and deserializes it from the memory
+/// mapping of the file, so the aligned arrays of the result alias the mapping
+template <typename T>
+T serialize_deserialize_mapped(const T& original) {
+    temp_file file{ "serialization_test" };
+
+    INFO("serialize") {
+        detail::file_output_archive ar{ file.get_path() };
+        detail::serialize(original, ar);
+    }
+
+    T deserialized;
+    INFO("deserialize") {
+        detail::mapped_file_input_archive ar{ file.get_path() };
+        detail::deserialize(deserialized, ar);
+    }
+    return deserialized;
+}
+
 } // namespace oneapi::dal::test::engine
@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dal/detail/profiler.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+#include "src/externals/service_profiler.h"
+
+namespace oneapi::dal::test {
+
+class profiler_fixture {
+public:
+    profiler_fixture() : initial_mode_(detail::profiler::get_mode()) {
+        detail::profiler::reset();
+    }
+
+    ~profiler_fixture() {
+        detail::profiler::set_mode(initial_mode_);
+        detail::profiler::reset();
+    }
+
+    void run_nested_tasks() {
+        ONEDAL_PROFILER_TASK(profiler_test_outer);
+        for (std::int64_t i = 0; i < 3; i++) {
+            ONEDAL_PROFILER_TASK(profiler_test_inner);
+        }
+    }
+
+    struct report_line {
+        double total_ms = -1.0;
+        long long count = -1;
+        double average_ms = -1.0;
+        std::string layer;
+        std::int64_t depth = -1;
+    };
+
+    report_line find_report_line(const std::string& report, const std::string& task_name) {
+        std::istringstream stream{ report };
+        for (std::string line; std::getline(stream, line);) {
+            if (line.size() <= task_name.size()) {
+                continue;
+            }
+            const auto name_pos = line.size() - task_name.size();
+            if (line.compare(name_pos, task_name.size(), task_name) != 0 ||
+                line[name_pos - 1] != ' ') {
+                continue;
+            }
+
+            report_line result;
+            char layer[16] = {};
+            int consumed = 0;
+            const int parsed_count = std::sscanf(line.c_str(),
+                                                 "%lf %lld %lf %15s%n",
+                                                 &result.total_ms,
+                                                 &result.count,
+                                                 &result.average_ms,
+                                                 layer,
+                                                 &consumed);
+            REQUIRE(parsed_count == 4);
+            result.layer = layer;
+            // The layer is followed by two spaces and two spaces per nesting level
+            result.depth = (std::int64_t(name_pos) - consumed - 2) / 2;
+            return result;
+        }
+        FAIL("Task " + task_name + " is not found in the report");
+        return report_line{};
+    }
+
+    struct trace_event {
+        std::int64_t tid = -1;
+        std::string parent;
+    };
+
+    std::vector<trace_event> find_trace_events(const std::string& trace,
+                                               const std::string& task_name) {
+        const std::string name_key = "{\"name\":\"" + task_name + "\"";
+        const std::string tid_key = "\"tid\":";
+        const std::string parent_key = "\"parent\":\"";
+
+        std::vector<trace_event> events;
+        for (auto pos = trace.find(name_key); pos != std::string::npos;
+             pos = trace.find(name_key, pos + 1)) {
+            const std::string event = trace.substr(pos, trace.find("}}", pos) - pos);
+            const auto tid_pos = event.find(tid_key);
+            const auto parent_pos = event.find(parent_key);
+            REQUIRE(tid_pos != std::string::npos);
+            REQUIRE(parent_pos != std::string::npos);
+
+            trace_event result;
+            result.tid = std::stoll(event.substr(tid_pos + tid_key.size()));
+            const auto parent_begin = parent_pos + parent_key.size();
+            const auto parent_end = event.find('"', parent_begin);
+            result.parent = event.substr(parent_begin, parent_end - parent_begin);
+            events.push_back(result);
+        }
+        return events;
+    }
+
+private:
+    detail::profiler_mode initial_mode_;
+};
+
+TEST_M(profiler_fixture, "profiler does not record tasks if disabled", "[profiler]") {
+    detail::profiler::set_mode(detail::profiler_mode::disabled);
+    run_nested_tasks();
+
+    REQUIRE_FALSE(detail::profiler::is_enabled());
+    REQUIRE(detail::profiler::get_report().find("profiler_test_outer") == std::string::npos);
+}
+
+TEST_M(profiler_fixture, "profiler reports nested tasks with call counts", "[profiler]") {
+    detail::profiler::set_mode(detail::profiler_mode::report);
+    run_nested_tasks();
+
+    const std::string report = detail::profiler::get_report();
+    const auto outer_pos = report.find("profiler_test_outer");
+    const auto inner_pos = report.find("  profiler_test_inner");
+
+    REQUIRE(outer_pos != std::string::npos);
+    REQUIRE(inner_pos != std::string::npos);
+    REQUIRE(outer_pos < inner_pos);
+
+    const auto inner_line_begin = report.rfind('\n', inner_pos) + 1;
+    const auto inner_line = report.substr(inner_line_begin, inner_pos - inner_line_begin);
+    REQUIRE(inner_line.find(" 3 ") != std::string::npos);
+}
+
+TEST_M(profiler_fixture,
+       "profiler nests DAAL tasks into oneDAL tasks and collects their timings",
+       "[profiler]") {
+    using std::chrono::milliseconds;
+    detail::profiler::set_mode(detail::profiler_mode::report);
+    {
+        ONEDAL_PROFILER_TASK(profiler_test_outer);
+        std::this_thread::sleep_for(milliseconds(20));
+        for (std::int64_t i = 0; i < 2; i++) {
+            DAAL_ITTNOTIFY_SCOPED_TASK(profiler_test_daal_kernel);
+            std::this_thread::sleep_for(milliseconds(10));
+        }
+    }
+
+    const std::string report = detail::profiler::get_report();
+    const auto outer = find_report_line(report, "profiler_test_outer");
+    const auto inner = find_report_line(report, "profiler_test_daal_kernel");
+
+    REQUIRE(outer.layer == "onedal");
+    REQUIRE(outer.depth == 0);
+    REQUIRE(outer.count == 1);
+    REQUIRE(inner.layer == "daal");
+    REQUIRE(inner.depth == 1);
+    REQUIRE(inner.count == 2);
+
+    REQUIRE(inner.total_ms >= 20.0);
+    REQUIRE(outer.total_ms >= inner.total_ms + 20.0);
+    REQUIRE(outer.average_ms == Approx(outer.total_ms).margin(1e-3));
+    REQUIRE(inner.average_ms == Approx(inner.total_ms / 2).margin(1e-3));
+}
+
+TEST_M(profiler_fixture, "profiler writes trace events for all threads", "[profiler]") {
+    detail::profiler::set_mode(detail::profiler_mode::trace);
+    const auto run_worker = []() {
+        ONEDAL_PROFILER_TASK(profiler_test_outer);
+        DAAL_ITTNOTIFY_SCOPED_TASK(profiler_test_daal_kernel);
+    };
+    std::thread first_worker(run_worker);
+    std::thread second_worker(run_worker);
+    first_worker.join();
+    second_worker.join();
+
+    const std::string trace = detail::profiler::get_trace();
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+
+    const auto outer_events = find_trace_events(trace, "profiler_test_outer");
+    const auto daal_events = find_trace_events(trace, "profiler_test_daal_kernel");
+    REQUIRE(outer_events.size() == 2);
+    REQUIRE(daal_events.size() == 2);
+    REQUIRE(outer_events[0].tid != outer_events[1].tid);
+
+    for (const auto& daal_event : daal_events) {
+        REQUIRE(daal_event.parent == "profiler_test_outer");
+        REQUIRE((daal_event.tid == outer_events[0].tid || daal_event.tid == outer_events[1].tid));
+    }
+    REQUIRE(daal_events[0].tid != daal_events[1].tid);
+}
+
+TEST_M(profiler_fixture, "profiler closes tasks that end after it is disabled", "[profiler]") {
+    detail::profiler::set_mode(detail::profiler_mode::report);
+    {
+        ONEDAL_PROFILER_TASK(profiler_test_outer);
+        detail::profiler::set_mode(detail::profiler_mode::disabled);
+    }
+    detail::profiler::set_mode(detail::profiler_mode::report);
+    run_nested_tasks();
+
+    // The outer task of the second run is not nested into the one of the first run
+    const std::string report = detail::profiler::get_report();
+    const auto outer = find_report_line(report, "profiler_test_outer");
+    REQUIRE(outer.depth == 0);
+    REQUIRE(outer.count == 2);
+}
+
+TEST_M(profiler_fixture, "profiler reset drops recorded tasks", "[profiler]") {
+    detail::profiler::set_mode(detail::profiler_mode::trace);
+    run_nested_tasks();
+    detail::profiler::reset();
+
+    REQUIRE(detail::profiler::get_report().find("profiler_test_outer") == std::string::npos);
+    REQUIRE(detail::profiler::get_trace().find("profiler_test_outer") == std::string::npos);
+}
+
+} // namespace oneapi::dal::test
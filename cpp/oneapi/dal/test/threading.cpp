@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <vector>
+
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/backend/dispatcher.hpp"
+#include "oneapi/dal/test/engine/common.hpp"
+
+namespace oneapi::dal::test {
+
+std::vector<std::int32_t> make_values(std::int64_t count) {
+    std::vector<std::int32_t> values(count);
+    for (std::int64_t i = 0; i < count; i++) {
+        values[i] = std::int32_t((i * 7919) % 101);
+    }
+    return values;
+}
+
+TEST("parallel_exclusive_scan matches serial prefix sum", "[threading]") {
+    const std::int64_t count = GENERATE(0, 1, 1000, 1000003);
+    const auto values = make_values(count);
+
+    std::vector<std::int64_t> offsets(count + 1, -1);
+    const std::int64_t total =
+        detail::parallel_exclusive_scan<std::int64_t>(values.data(), count, offsets.data());
+
+    std::int64_t expected = 0;
+    for (std::int64_t i = 0; i < count; i++) {
+        REQUIRE(offsets[i] == expected);
+        expected += values[i];
+    }
+    REQUIRE(offsets[count] == expected);
+    REQUIRE(total == expected);
+}
+
+TEST("parallel_exclusive_scan accepts atomic input and output", "[threading]") {
+    const std::int64_t count = 100003;
+    const auto values = make_values(count);
+
+    std::vector<std::atomic<std::int32_t>> atomic_values(count);
+    std::vector<std::atomic<std::int64_t>> offsets(count + 1);
+    for (std::int64_t i = 0; i < count; i++) {
+        atomic_values[i] = values[i];
+    }
+
+    const std::int64_t total =
+        detail::parallel_exclusive_scan<std::int64_t>(atomic_values.data(),
+                                                      count,
+                                                      offsets.data());
+
+    std::int64_t expected = 0;
+    for (std::int64_t i = 0; i < count; i++) {
+        REQUIRE(offsets[i].load() == expected);
+        expected += values[i];
+    }
+    REQUIRE(total == expected);
+}
+
+TEST("parallel_max finds maximum", "[threading]") {
+    const std::int64_t count = GENERATE(1, 1000, 1000003);
+    auto values = make_values(count);
+    values[count / 3] = 1000;
+
+    const std::int32_t max_value =
+        detail::parallel_max(count, values[0], [&](std::int64_t i) {
+            return values[i];
+        });
+    REQUIRE(max_value == 1000);
+}
+
+TEST("parallel_max returns initial value for empty range", "[threading]") {
+    const std::int32_t max_value = detail::parallel_max(0, std::int32_t(-5), [](std::int64_t i) {
+        return std::int32_t(0);
+    });
+    REQUIRE(max_value == -5);
+}
+
+TEST("threader_execute_in_arena limits the thread count", "[threading]") {
+    const std::int32_t max_threads = GENERATE(1, 2);
+
+    std::int32_t arena_max_threads = 0;
+    detail::threader_execute_in_arena(max_threads, nullptr, 0, [&]() {
+        arena_max_threads = detail::threader_get_max_threads();
+    });
+
+    REQUIRE(arena_max_threads <= max_threads);
+}
+
+TEST("threader_execute_in_arena uses one thread per pinned CPU", "[threading]") {
+    const std::vector<std::int32_t> cpu_ids = { 0 };
+
+    std::int64_t sum = 0;
+    std::int32_t arena_max_threads = 0;
+    detail::threader_execute_in_arena(0, cpu_ids.data(), 1, [&]() {
+        arena_max_threads = detail::threader_get_max_threads();
+        detail::threader_for(1000, 1000, [&](std::int32_t i) {
+            sum += i;
+        });
+    });
+
+    REQUIRE(arena_max_threads == 1);
+    REQUIRE(sum == 499500);
+}
+
+TEST("dispatch_by_threading returns the result and rethrows errors", "[threading]") {
+    const auto policy = detail::host_policy{}.set_max_threads(1).set_isolated(true);
+
+    const std::int32_t result = backend::dispatch_by_threading(policy, [&]() {
+        return detail::threader_get_max_threads();
+    });
+    REQUIRE(result == 1);
+
+    REQUIRE_THROWS_AS(backend::dispatch_by_threading(policy,
+                                                     [&]() {
+                                                         throw invalid_argument{ "error" };
+                                                     }),
+                      invalid_argument);
+}
+
+TEST("host_policy rejects negative threading settings", "[threading]") {
+    detail::host_policy policy;
+    REQUIRE(!policy.has_threading_constraints());
+
+    REQUIRE_THROWS_AS(policy.set_max_threads(-1), invalid_argument);
+    REQUIRE_THROWS_AS(policy.set_cpu_affinity({ 0, -1 }), invalid_argument);
+
+    policy.set_cpu_affinity({ 0 });
+    REQUIRE(policy.has_threading_constraints());
+}
+
+} // namespace oneapi::dal::test